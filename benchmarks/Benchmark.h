@@ -0,0 +1,50 @@
+#ifndef WACKYENGINE_BENCHMARKS_BENCHMARK_H_
+#define WACKYENGINE_BENCHMARKS_BENCHMARK_H_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace WackyEngine::Benchmark
+{
+    // Suites, each in its own file and listed in Main.cpp.
+    void RunJobSystem();
+    void RunMath();
+    void RunBroadphase();
+
+    // Fastest of several runs in seconds, the minimum is the least noisy estimate on a busy machine.
+    template<typename F>
+    double Measure(F&& function, std::uint32_t repetitions = 5)
+    {
+        double best = 1e30;
+
+        for (std::uint32_t i = 0; i < repetitions; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            if (seconds < best)
+            {
+                best = seconds;
+            }
+        }
+
+        return best;
+    }
+
+    inline void Report(const char* name, double seconds, double items)
+    {
+        std::printf("  %-44s %10.3f ms %10.2f ns/item\n", name, seconds * 1e3, seconds * 1e9 / items);
+    }
+
+    // Keeps results alive so the optimiser can't drop the work producing them.
+    inline volatile float g_Sink;
+
+    inline void Consume(float value)
+    {
+        g_Sink = value;
+    }
+}
+
+#endif
\ No newline at end of file
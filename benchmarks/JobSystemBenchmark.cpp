@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "WackyEngine/Core/JobSystem.h"
+
+#include "Benchmark.h"
+
+namespace WackyEngine::Benchmark
+{
+    static constexpr std::uint32_t EMPTY_JOB_COUNT = 1 << 17;
+    static constexpr std::uint32_t WORK_ITEMS = 1 << 22;
+    static constexpr std::uint32_t WORK_BATCH = 4096;
+
+    // Cost of Run, queueing, stealing and counting, with no work in the jobs themselves. Submitted in
+    // rounds that fit the per-thread ring so none of them fall back to running inline.
+    static void RunJobOverhead(std::uint32_t workerCount)
+    {
+        JobSystem jobSystem(workerCount);
+        JobCounter counter;
+
+        double seconds = Measure([&]()
+        {
+            for (std::uint32_t submitted = 0; submitted < EMPTY_JOB_COUNT; submitted += JobSystem::MAX_JOBS_PER_THREAD / 2)
+            {
+                for (std::uint32_t i = 0; i < JobSystem::MAX_JOBS_PER_THREAD / 2; ++i)
+                {
+                    jobSystem.Run(counter, []() { });
+                }
+
+                jobSystem.WaitForCounter(counter);
+            }
+        });
+
+        std::string name = "empty jobs, " + std::to_string(workerCount) + " workers";
+        Report(name.c_str(), seconds, EMPTY_JOB_COUNT);
+    }
+
+    // Fan out a fixed amount of arithmetic over ParallelFor and fan back in on one counter.
+    static double RunFanOut(std::uint32_t workerCount, std::vector<float>& data)
+    {
+        JobSystem jobSystem(workerCount);
+        JobCounter counter;
+        float* values = data.data();
+
+        double seconds = Measure([&]()
+        {
+            jobSystem.ParallelFor(counter, WORK_ITEMS, WORK_BATCH, [values](std::uint32_t begin, std::uint32_t end)
+            {
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    values[i] = std::sqrt(values[i] * 1.0001f + 0.5f);
+                }
+            });
+
+            jobSystem.WaitForCounter(counter);
+        });
+
+        Consume(values[WORK_ITEMS / 2]);
+
+        return seconds;
+    }
+
+    void RunJobSystem()
+    {
+        std::uint32_t maxWorkers = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+        RunJobOverhead(0);
+
+        if (maxWorkers > 0)
+        {
+            RunJobOverhead(maxWorkers);
+        }
+
+        std::vector<float> data(WORK_ITEMS, 1.0f);
+        double serial = RunFanOut(0, data);
+        Report("fan-out/fan-in, 0 workers", serial, WORK_ITEMS);
+
+        for (std::uint32_t workers = 1; workers <= maxWorkers; workers *= 2)
+        {
+            double seconds = RunFanOut(workers, data);
+            std::string name = "fan-out/fan-in, " + std::to_string(workers) + " workers";
+            Report(name.c_str(), seconds, WORK_ITEMS);
+            std::printf("  %-44s %10.2fx\n", "  speedup", serial / seconds);
+        }
+    }
+}
\ No newline at end of file
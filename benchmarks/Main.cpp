@@ -0,0 +1,40 @@
+#include <cstring>
+
+#include "Benchmark.h"
+
+using namespace WackyEngine;
+
+struct Suite
+{
+    const char* Name;
+    void (*Run)();
+};
+
+static const Suite SUITES[] =
+{
+    { "jobs", Benchmark::RunJobSystem },
+    { "math", Benchmark::RunMath },
+    { "broadphase", Benchmark::RunBroadphase },
+};
+
+// Runs every suite, or only the ones named on the command line.
+int main(int argc, char** argv)
+{
+    for (const Suite& suite : SUITES)
+    {
+        bool selected = argc < 2;
+
+        for (int i = 1; i < argc && !selected; ++i)
+        {
+            selected = std::strcmp(argv[i], suite.Name) == 0;
+        }
+
+        if (selected)
+        {
+            std::printf("%s\n", suite.Name);
+            suite.Run();
+        }
+    }
+
+    return 0;
+}
\ No newline at end of file
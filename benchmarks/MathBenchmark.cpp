@@ -0,0 +1,263 @@
+#include <random>
+#include <vector>
+
+#include "WackyEngine/Math/Matrix4.h"
+#include "WackyEngine/Math/Vector3.h"
+
+#include "Benchmark.h"
+
+#if defined(_MSC_VER)
+    #define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+    #define BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+namespace WackyEngine::Benchmark
+{
+    static constexpr std::size_t MATRIX_COUNT = 4096;
+    static constexpr std::uint32_t ROUNDS = 64;
+    static constexpr std::size_t PARTICLE_COUNT = 1 << 16;
+
+    // The plain float loops Matrix4 used before it went through the SIMD layer, on column-major data.
+
+    static void ScalarMultiply(const float* first, const float* second, float* result) noexcept
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = 0; row < 4; ++row)
+            {
+                float sum = 0.0f;
+
+                for (int k = 0; k < 4; ++k)
+                {
+                    sum += first[k * 4 + row] * second[column * 4 + k];
+                }
+
+                result[column * 4 + row] = sum;
+            }
+        }
+    }
+
+    static void ScalarTransform(const float* matrix, const float* vector, float* result) noexcept
+    {
+        for (int row = 0; row < 4; ++row)
+        {
+            result[row] = matrix[row] * vector[0] + matrix[4 + row] * vector[1] + matrix[8 + row] * vector[2] + matrix[12 + row] * vector[3];
+        }
+    }
+
+    static void ScalarTranspose(float* matrix) noexcept
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = column + 1; row < 4; ++row)
+            {
+                float value = matrix[column * 4 + row];
+                matrix[column * 4 + row] = matrix[row * 4 + column];
+                matrix[row * 4 + column] = value;
+            }
+        }
+    }
+
+    // Matrix4::CreateScale is still a stub returning the identity.
+    static Matrix4 Scale(float x, float y, float z)
+    {
+        return Matrix4(x,    0.0f, 0.0f, 0.0f,
+                       0.0f, y,    0.0f, 0.0f,
+                       0.0f, 0.0f, z,    0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f);
+    }
+
+    static std::vector<Matrix4> CreateMatrices()
+    {
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+        std::uniform_real_distribution<float> offset(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+
+        std::vector<Matrix4> matrices(MATRIX_COUNT);
+
+        for (Matrix4& matrix : matrices)
+        {
+            matrix = Matrix4::CreateTranslation(offset(random), offset(random), offset(random)) *
+                     Matrix4::CreateRotationY(angle(random)) * Matrix4::CreateRotationX(angle(random)) *
+                     Scale(scale(random), scale(random), scale(random));
+        }
+
+        return matrices;
+    }
+
+    static void RunMatrixOperations()
+    {
+        std::vector<Matrix4> matrices = CreateMatrices();
+        std::vector<Matrix4> results(MATRIX_COUNT);
+        std::vector<Vector4> vectors(MATRIX_COUNT, Vector4(1.0f, 2.0f, 3.0f, 1.0f));
+        std::vector<Vector4> transformed(MATRIX_COUNT);
+        double items = static_cast<double>(MATRIX_COUNT) * ROUNDS;
+
+        Matrix4 view = Matrix4::CreateRotationZ(0.3f) * Matrix4::CreateTranslation(1.0f, 2.0f, 3.0f);
+
+        double simd = Measure([&]()
+        {
+            for (std::uint32_t round = 0; round < ROUNDS; ++round)
+            {
+                for (std::size_t i = 0; i < MATRIX_COUNT; ++i)
+                {
+                    results[i] = view * matrices[i];
+                }
+            }
+        });
+
+        double scalar = Measure([&]()
+        {
+            for (std::uint32_t round = 0; round < ROUNDS; ++round)
+            {
+                for (std::size_t i = 0; i < MATRIX_COUNT; ++i)
+                {
+                    ScalarMultiply(view.GetData(), matrices[i].GetData(), results[i].GetData());
+                }
+            }
+        });
+
+        Consume(results[MATRIX_COUNT / 2].M11);
+        Report("Multiply, SIMD", simd, items);
+        Report("Multiply, scalar", scalar, items);
+
+        simd = Measure([&]()
+        {
+            for (std::uint32_t round = 0; round < ROUNDS; ++round)
+            {
+                for (std::size_t i = 0; i < MATRIX_COUNT; ++i)
+                {
+                    transformed[i] = matrices[i].Transform(vectors[i]);
+                }
+            }
+        });
+
+        scalar = Measure([&]()
+        {
+            for (std::uint32_t round = 0; round < ROUNDS; ++round)
+            {
+                for (std::size_t i = 0; i < MATRIX_COUNT; ++i)
+                {
+                    ScalarTransform(matrices[i].GetData(), &vectors[i].X, &transformed[i].X);
+                }
+            }
+        });
+
+        Consume(transformed[MATRIX_COUNT / 2].X);
+        Report("Transform Vector4, SIMD", simd, items);
+        Report("Transform Vector4, scalar", scalar, items);
+
+        results = matrices;
+
+        simd = Measure([&]()
+        {
+            for (std::uint32_t round = 0; round < ROUNDS; ++round)
+            {
+                for (Matrix4& matrix : results)
+                {
+                    matrix.Transpose();
+                }
+            }
+        });
+
+        scalar = Measure([&]()
+        {
+            for (std::uint32_t round = 0; round < ROUNDS; ++round)
+            {
+                for (Matrix4& matrix : results)
+                {
+                    ScalarTranspose(matrix.GetData());
+                }
+            }
+        });
+
+        Consume(results[MATRIX_COUNT / 2].M12);
+        Report("Transpose, SIMD", simd, items);
+        Report("Transpose, scalar", scalar, items);
+
+        // The old general inverse returned a zero matrix, so the comparison is general against affine.
+        double general = Measure([&]()
+        {
+            for (std::size_t i = 0; i < MATRIX_COUNT; ++i)
+            {
+                results[i] = matrices[i].GetInverse();
+            }
+        });
+
+        double affine = Measure([&]()
+        {
+            for (std::size_t i = 0; i < MATRIX_COUNT; ++i)
+            {
+                results[i] = matrices[i].GetAffineInverse();
+            }
+        });
+
+        Consume(results[MATRIX_COUNT / 2].M11);
+        Report("GetInverse", general, MATRIX_COUNT);
+        Report("GetAffineInverse", affine, MATRIX_COUNT);
+    }
+
+    // What every call cost when the vector and matrix operations lived in .cpp files and couldn't be inlined without LTO.
+    BENCHMARK_NOINLINE static Vector3 OutOfLineTransform(const Matrix4& matrix, const Vector3& vector) noexcept { return matrix.Transform(vector); }
+    BENCHMARK_NOINLINE static Vector3 OutOfLineAdd(const Vector3& first, const Vector3& second) noexcept { return first + second; }
+    BENCHMARK_NOINLINE static Vector3 OutOfLineScale(const Vector3& vector, float scalar) noexcept { return vector * scalar; }
+    BENCHMARK_NOINLINE static float OutOfLineDot(const Vector3& first, const Vector3& second) noexcept { return first.Dot(second); }
+
+    // A particle style update: move by velocity, take the result through a world matrix and accumulate a dot
+    // product per point, the mix of small calls a transform heavy loop is made of.
+    static void RunTransformLoop()
+    {
+        std::mt19937 random(99);
+        std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+
+        std::vector<Vector3> positions(PARTICLE_COUNT);
+        std::vector<Vector3> velocities(PARTICLE_COUNT);
+        std::vector<Vector3> results(PARTICLE_COUNT);
+
+        for (std::size_t i = 0; i < PARTICLE_COUNT; ++i)
+        {
+            positions[i] = Vector3(value(random), value(random), value(random));
+            velocities[i] = Vector3(value(random), value(random), value(random));
+        }
+
+        Matrix4 world = Matrix4::CreateTranslation(4.0f, -2.0f, 1.0f) * Matrix4::CreateRotationY(0.7f);
+        Vector3 light(0.3f, 0.9f, 0.1f);
+        constexpr float DELTA = 1.0f / 60.0f;
+
+        float inlinedSum = 0.0f;
+
+        double inlined = Measure([&]()
+        {
+            for (std::size_t i = 0; i < PARTICLE_COUNT; ++i)
+            {
+                Vector3 moved = positions[i] + velocities[i] * DELTA;
+                results[i] = world.Transform(moved);
+                inlinedSum += results[i].Dot(light);
+            }
+        });
+
+        float outOfLineSum = 0.0f;
+
+        double outOfLine = Measure([&]()
+        {
+            for (std::size_t i = 0; i < PARTICLE_COUNT; ++i)
+            {
+                Vector3 moved = OutOfLineAdd(positions[i], OutOfLineScale(velocities[i], DELTA));
+                results[i] = OutOfLineTransform(world, moved);
+                outOfLineSum += OutOfLineDot(results[i], light);
+            }
+        });
+
+        Consume(inlinedSum + outOfLineSum);
+        Report("Transform loop, header inlined", inlined, PARTICLE_COUNT);
+        Report("Transform loop, out of line calls", outOfLine, PARTICLE_COUNT);
+    }
+
+    void RunMath()
+    {
+        RunMatrixOperations();
+        RunTransformLoop();
+    }
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef WACKYENGINE_APPLICATION_H_
 #define WACKYENGINE_APPLICATION_H_
 
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -9,34 +10,52 @@
 #include "WackyEngine/Core/Window.h"
 #include "WackyEngine/Core/Debugger.h"
 #include "WackyEngine/Core/Device.h"
+#include "WackyEngine/Core/Timestep.h"
+#include "WackyEngine/Core/FrameLimiter.h"
+#include "WackyEngine/Core/Context.h"
 #include "WackyEngine/Graphics/RenderSystem.h"
+#include "WackyEngine/Graphics/FrameData.h"
 #include "WackyEngine/Graphics/Model.h"
 
 namespace WackyEngine
 {
-    struct FrameData
-    {
-        VkCommandBuffer CmdBuffer;
-        std::uint32_t FrameIndex;
-    };
-
     class Application
     {
     private:
         RenderSystem* m_RenderSystem;
 
+        bool m_Running;
+        bool m_FixedTimestep;
+        std::chrono::nanoseconds m_FixedStep;
+        std::uint32_t m_MaxUpdateSteps;
+
+        FrameLimiter m_FrameLimiter;
+
     protected:
         inline RenderSystem* GetRenderSystem() { return m_RenderSystem; }
 
+        // Update is called in steps of stepSeconds, at most maxSteps times per frame.
+        void SetFixedTimestep(double stepSeconds, std::uint32_t maxSteps = 5);
+        void SetVariableTimestep();
+
+        // Caps the loop to framesPerSecond independent of the present mode, 0 removes the cap.
+        inline void SetFrameRateLimit(double framesPerSecond) { m_FrameLimiter.SetTargetFrameRate(framesPerSecond); }
+
+        // Ends Run once the current frame is submitted. Headless applications have no window to close, so this is how they finish.
+        inline void Quit() noexcept { m_Running = false; }
+
     public:
-        Application(const int width, const int height, const std::string& windowTitle);
+        Application(const int width, const int height, const std::string& windowTitle, const GraphicsInformation& graphicsInfo = GraphicsInformation());
         ~Application();
 
         void Run();
 
         virtual void Initialise() = 0;
-        virtual void Update() = 0;
+        virtual void Update(const Timestep& timestep) = 0;
         virtual void Draw(const FrameData& frameData) = 0;
+
+        // Recorded before the render pass begins, for compute and transfer work such as MeshRenderer::Cull.
+        virtual void PreDraw(const FrameData& frameData) { }
         virtual void OnWindowResize(int newWidth, int newHeight) { }
     };
 }
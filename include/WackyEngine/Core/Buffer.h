@@ -17,7 +17,7 @@ namespace WackyEngine
         Buffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties);
         ~Buffer();
 
-        void SetData(void* data, const std::size_t size);
+        void SetData(const void* data, const std::size_t size, const std::size_t offset = 0);
         void CopyBuffer(Buffer& buffer, const std::size_t size);
 
         inline VkBuffer GetBufferObject() const noexcept { return m_Buffer; }
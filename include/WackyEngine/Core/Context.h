@@ -5,6 +5,7 @@
 
 #include "WackyEngine/Core/Device.h"
 #include "WackyEngine/Core/Debugger.h"
+#include "WackyEngine/Core/JobSystem.h"
 
 namespace WackyEngine
 {
@@ -23,21 +24,62 @@ namespace WackyEngine
         const char* Title;
     };
 
+    struct GraphicsInformation
+    {
+        static constexpr std::uint32_t MAX_FRAMES_IN_FLIGHT = 4;
+
+        // Preferred mode, falls back towards FIFO when unsupported.
+        VkPresentModeKHR PresentMode = VK_PRESENT_MODE_FIFO_KHR;
+
+        // Requested swap chain image count, 0 uses the surface minimum plus one.
+        std::uint32_t ImageCount = 0;
+
+        // Frames the CPU may record ahead of the GPU, 1 to MAX_FRAMES_IN_FLIGHT. Fewer means
+        // lower input latency, more keeps the GPU fed under heavy load.
+        std::uint32_t FramesInFlight = 3;
+
+        // Gives the swap chain render pass a depth attachment so pipelines can depth test.
+        bool DepthBuffer = true;
+
+        // No window, surface or swap chain. Frames render into offscreen images the size of the window
+        // information and are read back with OffscreenTarget, so it runs without a display.
+        bool Headless = false;
+
+        // Enables the Khronos validation layer and a debug messenger printing its warnings. Off in release builds,
+        // and skipped with a warning where the layer isn't installed, as on most machines outside development.
+#ifdef NDEBUG
+        bool Validation = false;
+#else
+        bool Validation = true;
+#endif
+    };
+
     class Context
     {
     private:
         static void InitialiseVulkan(const AppInformation& info);
 
     public:
-        static void Initialise(const AppInformation& appInfo, const WindowInformation& windowInfo);
+        static void Initialise(const AppInformation& appInfo, const WindowInformation& windowInfo, const GraphicsInformation& graphicsInfo);
 
         static void PrintExtensionInformation();
         static std::vector<const char*> GetRequiredExtensions();
 
         static VkInstance GetInstance();
         static Device* GetDevice();
+
+        // Null when headless.
         static Window* GetWindow();
+
+        // Null without validation.
         static Debugger* GetDebugger();
+        static JobSystem* GetJobSystem();
+        static const GraphicsInformation& GetGraphicsInformation();
+
+        inline static bool IsHeadless() { return GetGraphicsInformation().Headless; }
+
+        // Size requested through the window information, what offscreen targets are created with.
+        static VkExtent2D GetHeadlessExtent();
     };
 }
 
@@ -11,8 +11,6 @@ namespace WackyEngine
     {
     private:
         VkDebugUtilsMessengerEXT m_DebugMessenger; 
-
-        bool CheckValidationLayerSupport();
         
     public:
         const static std::vector<const char*> ValidationLayers;
@@ -20,6 +18,8 @@ namespace WackyEngine
         Debugger();
         ~Debugger();
 
+        // Whether every validation layer is installed. Safe to call before the instance exists.
+        static bool CheckValidationLayerSupport();
         static VkDebugUtilsMessengerCreateInfoEXT GetDefaultInfo();
     };
 }
@@ -1,6 +1,7 @@
 #ifndef WACKYENGINE_CORE_DEVICE_H_
 #define WACKYENGINE_CORE_DEVICE_H_
 
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -21,7 +22,15 @@ namespace WackyEngine
     class Device
     {
     private:
-        static const std::vector<const char*> RequiredExtensions;
+        // Swap chain support is only required when there is a window to present to.
+        static std::vector<const char*> GetRequiredExtensions();
+
+        struct PendingDeletion
+        {
+            VkObjectType Type;
+            std::uint64_t Handle;
+            std::uint64_t RetireValue;
+        };
 
         VkPhysicalDevice m_PhysicalDevice;
         VkDevice m_LogicalDevice;
@@ -29,9 +38,27 @@ namespace WackyEngine
         VkQueue m_PresentQueue;
         VkCommandPool m_CommandPool;
 
+        // Optional features, enabled when the physical device has them.
+        bool m_MultiDrawIndirect;
+        bool m_DrawIndirectCount;
+
+        // Every graphics queue submission signals the next value, so a value being reached means all work up to it is done.
+        VkSemaphore m_GraphicsTimeline;
+        std::uint64_t m_GraphicsTimelineValue;
+        std::mutex m_SubmitMutex;
+
+        // Ordered by retire value, entries released since the last frame submission sit at the back with no value yet.
+        std::vector<PendingDeletion> m_PendingDeletions;
+        std::size_t m_UnretiredDeletion;
+        std::mutex m_DeletionMutex;
+
+        void QueueDeletion(VkObjectType type, std::uint64_t handle);
+        void DestroyHandle(VkObjectType type, std::uint64_t handle) const;
+
         void InitialisePhysicalDevice();
         void InitialiseLogicalDevice();
         void InitialiseCommandPool();
+        void InitialiseTimeline();
 
     public:
         static QueueFamilyIndices LocateQueueFamilies(VkPhysicalDevice device);
@@ -46,21 +73,62 @@ namespace WackyEngine
         inline VkQueue GetGraphicsQueue() const noexcept { return m_GraphicsQueue; }
         inline VkQueue GetPresentQueue() const noexcept { return m_PresentQueue; }
         inline VkCommandPool GetCommandPool() const noexcept { return m_CommandPool; }
+        inline VkSemaphore GetGraphicsTimeline() const noexcept { return m_GraphicsTimeline; }
+        inline std::uint64_t GetLastSubmittedValue() const noexcept { return m_GraphicsTimelineValue; }
+
+        // Without it indirect draws have to be issued one command at a time.
+        inline bool SupportsMultiDrawIndirect() const noexcept { return m_MultiDrawIndirect; }
+
+        // Lets the GPU decide how many indirect commands are drawn, core in Vulkan 1.2 but still optional.
+        inline bool SupportsDrawIndirectCount() const noexcept { return m_DrawIndirectCount; }
+
+        // Submits to the graphics queue and returns the timeline value signalled on completion. The binary
+        // semaphores are for swap chain acquire/present, which can't use timeline semaphores.
+        std::uint64_t SubmitGraphics(VkCommandBuffer cmdBuffer, VkSemaphore waitSemaphore = VK_NULL_HANDLE, VkPipelineStageFlags waitStage = 0, VkSemaphore signalSemaphore = VK_NULL_HANDLE);
+        std::uint64_t GetCompletedValue() const;
+        void WaitForValue(std::uint64_t value) const;
+
+        // Releases a handle once the frame being recorded, and every frame before it, has finished on the GPU.
+        // Safe to call mid-frame and from any thread.
+        void DestroyDeferred(VkBuffer buffer);
+        void DestroyDeferred(VkDeviceMemory memory);
+        void DestroyDeferred(VkImage image);
+        void DestroyDeferred(VkImageView imageView);
+        void DestroyDeferred(VkSampler sampler);
+        void DestroyDeferred(VkPipeline pipeline);
+        void DestroyDeferred(VkPipelineLayout pipelineLayout);
+        void DestroyDeferred(VkRenderPass renderPass);
+        void DestroyDeferred(VkFramebuffer framebuffer);
+        void DestroyDeferred(VkDescriptorPool descriptorPool);
+        void DestroyDeferred(VkDescriptorSetLayout descriptorSetLayout);
+        void DestroyDeferred(VkSwapchainKHR swapchain);
+
+        // Tags everything released since the last call with the timeline value of the frame submission that could still use it.
+        void RetireDeletions(std::uint64_t submissionValue);
+
+        // Destroys everything whose frame has completed, or everything if forced.
+        void CollectDeletions(bool force = false);
 
         std::uint32_t FindMemoryType(std::uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+
+        // Whether any memory type has all of the properties, for picking optional ones such as host cached.
+        bool SupportsMemoryProperties(VkMemoryPropertyFlags properties) const;
         VkSurfaceCapabilitiesKHR GetSurfaceCapabilities() const noexcept;
         VkSurfaceFormatKHR SelectSwapSurfaceFormat() const noexcept;
-        VkPresentModeKHR SelectSwapPresentMode() const noexcept;
+        VkPresentModeKHR SelectSwapPresentMode(VkPresentModeKHR preferredMode) const noexcept;
         VkExtent2D SelectSwapExtent() const noexcept;
 
+        // First depth format usable as an optimally tiled attachment, undefined if there are none.
+        VkFormat SelectDepthFormat() const noexcept;
+
         void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& memory) const;
-        void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size) const;
+        void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
         void CreateImage(std::uint32_t width, std::uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory) const;
-        void TransitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout) const;
-        void CopyBufferToImage(VkBuffer buffer, VkImage image, std::uint32_t width, std::uint32_t height) const;
+        void TransitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout);
+        void CopyBufferToImage(VkBuffer buffer, VkImage image, std::uint32_t width, std::uint32_t height);
 
         VkCommandBuffer BeginSingleTimeCommands() const;
-        void EndSingleTimeCommands(VkCommandBuffer cmdBuffer) const;
+        void EndSingleTimeCommands(VkCommandBuffer cmdBuffer);
     };
 }
 
@@ -0,0 +1,38 @@
+#ifndef WACKYENGINE_CORE_FRAMEARENA_H_
+#define WACKYENGINE_CORE_FRAMEARENA_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "WackyEngine/Core/LinearArena.h"
+
+namespace WackyEngine
+{
+    class JobSystem;
+
+    // One linear arena per frame in flight per job system thread. A frame's arenas are reset once
+    // its fence has been waited on, so memory handed out stays valid until that frame slot comes round again.
+    class FrameArena
+    {
+    private:
+        std::vector<LinearArena*> m_Arenas;
+        const JobSystem* m_JobSystem;
+        std::uint32_t m_FrameCount;
+        std::uint32_t m_ThreadCount;
+        std::uint32_t m_CurrentFrame;
+
+    public:
+        FrameArena(std::uint32_t frameCount, const JobSystem* jobSystem, std::size_t bytesPerThread);
+        ~FrameArena();
+
+        void BeginFrame(std::uint32_t frameIndex);
+
+        // Arena for the calling thread in the current frame. Throws on threads the job system does not own.
+        LinearArena& GetArena();
+        LinearArena& GetArena(std::uint32_t threadIndex);
+
+        inline std::uint32_t GetCurrentFrame() const noexcept { return m_CurrentFrame; }
+    };
+}
+
+#endif
\ No newline at end of file
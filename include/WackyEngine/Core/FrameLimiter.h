@@ -0,0 +1,32 @@
+#ifndef WACKYENGINE_CORE_FRAMELIMITER_H_
+#define WACKYENGINE_CORE_FRAMELIMITER_H_
+
+#include <chrono>
+
+namespace WackyEngine
+{
+    // Caps the frame rate by sleeping most of the remaining frame time and spinning the rest,
+    // since OS sleeps routinely overshoot by a millisecond or more.
+    class FrameLimiter
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        std::chrono::nanoseconds m_FrameTime;
+        std::chrono::nanoseconds m_SpinThreshold;
+        Clock::time_point m_NextFrame;
+
+    public:
+        FrameLimiter(double framesPerSecond = 0.0);
+
+        // 0 disables the limiter.
+        void SetTargetFrameRate(double framesPerSecond);
+        inline void SetSpinThreshold(std::chrono::nanoseconds threshold) { m_SpinThreshold = threshold; }
+
+        void Wait();
+
+        inline bool IsEnabled() const noexcept { return m_FrameTime.count() > 0; }
+    };
+}
+
+#endif
\ No newline at end of file
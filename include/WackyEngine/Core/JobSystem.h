@@ -0,0 +1,194 @@
+#ifndef WACKYENGINE_CORE_JOBSYSTEM_H_
+#define WACKYENGINE_CORE_JOBSYSTEM_H_
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace WackyEngine
+{
+    class JobCounter
+    {
+    private:
+        friend class JobSystem;
+
+        std::atomic<std::uint32_t> m_Value { 0 };
+
+        // First exception thrown by one of the counter's jobs, rethrown from WaitForCounter.
+        std::exception_ptr m_Exception;
+        std::atomic<bool> m_HasException { false };
+
+        void SetException(std::exception_ptr exception) noexcept
+        {
+            if (!m_HasException.exchange(true, std::memory_order_acq_rel))
+            {
+                m_Exception = exception;
+            }
+        }
+
+    public:
+        inline bool IsDone() const noexcept { return m_Value.load(std::memory_order_acquire) == 0; }
+        inline std::uint32_t GetValue() const noexcept { return m_Value.load(std::memory_order_acquire); }
+    };
+
+    // A job is one cache line: entry point, completion counter and the callable stored inline.
+    struct alignas(64) Job
+    {
+        static constexpr std::size_t PAYLOAD_SIZE = 48;
+
+        void (*Entry)(Job& job);
+        JobCounter* Counter;
+        alignas(16) unsigned char Payload[PAYLOAD_SIZE];
+    };
+
+    // Chase-Lev deque. The owning thread pushes and pops at the bottom, any other thread steals from the top.
+    class WorkStealingQueue
+    {
+    public:
+        static constexpr std::int64_t CAPACITY = 4096;
+
+    private:
+        alignas(64) std::atomic<std::int64_t> m_Top { 0 };
+        alignas(64) std::atomic<std::int64_t> m_Bottom { 0 };
+        std::atomic<Job*> m_Jobs[CAPACITY];
+
+    public:
+        bool Push(Job* job);
+        Job* Pop();
+        Job* Steal();
+    };
+
+    class JobSystem
+    {
+    public:
+        // Jobs come from a per-thread ring. Once a thread has this many queued or running, Run executes
+        // further jobs inline instead of reusing a live slot.
+        static constexpr std::uint32_t MAX_JOBS_PER_THREAD = 4096;
+
+        // GetThreadIndex on a thread this job system did not start, such as a loader thread.
+        static constexpr std::uint32_t EXTERNAL_THREAD = UINT32_MAX;
+
+    private:
+        struct alignas(64) ThreadData
+        {
+            WorkStealingQueue Queue;
+            Job* Jobs;
+            std::atomic<bool>* LiveJobs;
+            std::uint32_t AllocatedJobs;
+            std::uint32_t RandomState;
+        };
+
+        std::vector<std::thread> m_Workers;
+
+        // One per thread, plus a last one shared by external threads. They take turns as its owner under
+        // m_ExternalMutex, while every other thread steals from it as usual.
+        ThreadData* m_ThreadData;
+        std::mutex m_ExternalMutex;
+
+        // Every thread's job ring in one allocation, so a job's slot can be found from its address.
+        // A slot is live while its job is queued or running, and cleared by whichever thread executes it.
+        Job* m_Jobs;
+        std::atomic<bool>* m_LiveJobs;
+        std::uint32_t m_ThreadCount;
+
+        std::atomic<bool> m_Running;
+        std::atomic<std::uint32_t> m_QueuedJobs;
+
+        // Registration the constructing thread had before it became this job system's thread 0.
+        const JobSystem* m_PreviousSystem;
+        std::uint32_t m_PreviousThreadIndex;
+
+        void WorkerLoop(std::uint32_t threadIndex);
+
+        static Job* AllocateJob(ThreadData& data);
+        Job* AllocateJob();
+        void Submit(Job* job);
+        Job* GetJob();
+        void Execute(Job* job);
+
+    public:
+        // The constructing thread becomes thread 0 and takes part in work through WaitForCounter. Any other
+        // thread may use the job system too, submitting through a locked queue and only stealing while it waits.
+        JobSystem(std::uint32_t workerCount);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        template<typename F>
+        void Run(JobCounter& counter, F&& function)
+        {
+            using Functor = std::decay_t<F>;
+            static_assert(sizeof(Functor) <= Job::PAYLOAD_SIZE, "Job function does not fit in the job payload.");
+            static_assert(alignof(Functor) <= 16, "Job function is over-aligned.");
+
+            Job* job = AllocateJob();
+
+            if (!job)
+            {
+                try
+                {
+                    function();
+                }
+                catch (...)
+                {
+                    counter.SetException(std::current_exception());
+                }
+
+                return;
+            }
+
+            job->Counter = &counter;
+            job->Entry = [](Job& job)
+            {
+                struct Destroyer
+                {
+                    Functor* Function;
+                    ~Destroyer() { Function->~Functor(); }
+                };
+
+                Destroyer destroyer { std::launder(reinterpret_cast<Functor*>(job.Payload)) };
+                (*destroyer.Function)();
+            };
+
+            new (job->Payload) Functor(std::forward<F>(function));
+
+            counter.m_Value.fetch_add(1, std::memory_order_relaxed);
+            Submit(job);
+        }
+
+        // Calls function(begin, end) over [0, count) in batches of batchSize.
+        template<typename F>
+        void ParallelFor(JobCounter& counter, std::uint32_t count, std::uint32_t batchSize, const F& function)
+        {
+            if (batchSize == 0)
+            {
+                batchSize = 1;
+            }
+
+            for (std::uint32_t begin = 0; begin < count; begin += batchSize)
+            {
+                std::uint32_t end = (count - begin > batchSize) ? begin + batchSize : count;
+                Run(counter, [function, begin, end]() { function(begin, end); });
+            }
+        }
+
+        // Runs queued jobs on the calling thread until the counter reaches zero, then rethrows the first
+        // exception any of its jobs threw.
+        void WaitForCounter(JobCounter& counter);
+
+        inline std::uint32_t GetThreadCount() const noexcept { return m_ThreadCount; }
+        inline std::uint32_t GetWorkerCount() const noexcept { return m_ThreadCount - 1; }
+
+        // 0 on the thread that created the job system, 1..N on its workers and EXTERNAL_THREAD anywhere else.
+        std::uint32_t GetThreadIndex() const noexcept;
+    };
+}
+
+#endif
\ No newline at end of file
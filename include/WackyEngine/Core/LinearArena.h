@@ -0,0 +1,88 @@
+#ifndef WACKYENGINE_CORE_LINEARARENA_H_
+#define WACKYENGINE_CORE_LINEARARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace WackyEngine
+{
+    // Bump allocator. Individual allocations are never freed, the whole arena is released with Reset.
+    // Requests that don't fit fall back to the heap and are released on the next Reset.
+    class LinearArena
+    {
+    private:
+        struct OverflowBlock
+        {
+            OverflowBlock* Next;
+            std::size_t Alignment;
+        };
+
+        std::byte* m_Buffer;
+        std::size_t m_Capacity;
+        std::size_t m_Offset;
+        std::size_t m_HighWaterMark;
+        bool m_OwnsBuffer;
+
+        OverflowBlock* m_Overflow;
+        std::size_t m_OverflowCount;
+
+        void* AllocateOverflow(std::size_t size, std::size_t alignment);
+
+    public:
+        LinearArena(std::size_t capacity);
+        LinearArena(void* buffer, std::size_t capacity);
+        ~LinearArena();
+
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+        void Reset();
+
+        template<typename T>
+        inline T* AllocateArray(std::size_t count)
+        {
+            return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        inline std::size_t GetCapacity() const noexcept { return m_Capacity; }
+        inline std::size_t GetUsed() const noexcept { return m_Offset; }
+        inline std::size_t GetHighWaterMark() const noexcept { return m_HighWaterMark; }
+
+        // Number of allocations since the last reset that had to go to the heap.
+        inline std::size_t GetOverflowCount() const noexcept { return m_OverflowCount; }
+    };
+
+    // Standard allocator over a LinearArena, for containers whose storage only needs to live until the arena resets.
+    template<typename T>
+    class ArenaAllocator
+    {
+    private:
+        template<typename U>
+        friend class ArenaAllocator;
+
+        LinearArena* m_Arena;
+
+    public:
+        using value_type = T;
+
+        ArenaAllocator(LinearArena& arena) noexcept : m_Arena(&arena) { }
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_Arena(other.m_Arena) { }
+
+        inline T* allocate(std::size_t count) { return m_Arena->AllocateArray<T>(count); }
+        inline void deallocate(T* pointer, std::size_t count) noexcept { }
+
+        inline LinearArena* GetArena() const noexcept { return m_Arena; }
+
+        template<typename U>
+        inline bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_Arena == other.m_Arena; }
+
+        template<typename U>
+        inline bool operator!=(const ArenaAllocator<U>& other) const noexcept { return m_Arena != other.m_Arena; }
+    };
+}
+
+#endif
\ No newline at end of file
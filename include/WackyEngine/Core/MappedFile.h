@@ -0,0 +1,29 @@
+#ifndef WACKYENGINE_CORE_MAPPEDFILE_H_
+#define WACKYENGINE_CORE_MAPPEDFILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace WackyEngine
+{
+    // Read only memory mapping of a whole file. Pages are faulted in by the OS as they are touched,
+    // so nothing is copied until the data is actually read.
+    class MappedFile
+    {
+    private:
+        const std::byte* m_Data;
+        std::size_t m_Size;
+
+    public:
+        MappedFile(const std::string& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        inline const std::byte* GetData() const noexcept { return m_Data; }
+        inline std::size_t GetSize() const noexcept { return m_Size; }
+    };
+}
+
+#endif
\ No newline at end of file
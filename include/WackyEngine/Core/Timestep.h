@@ -1,18 +1,21 @@
 #ifndef WACKYENGINE_CORE_TIMESTEP_H_
 #define WACKYENGINE_CORE_TIMESTEP_H_
 
+#include <chrono>
+
 namespace WackyEngine
 {
     class Timestep
     {
     private:
-        float m_Time;
+        std::chrono::nanoseconds m_Time;
 
     public:
-        inline Timestep(float time = 0.0f) : m_Time(time) { }
+        inline Timestep(std::chrono::nanoseconds time = std::chrono::nanoseconds::zero()) : m_Time(time) { }
 
-        inline float GetSeconds() { return m_Time * 1000.0f; }
-        inline float GetMilliseconds() { return m_Time; }
+        inline float GetSeconds() const noexcept { return std::chrono::duration<float>(m_Time).count(); }
+        inline float GetMilliseconds() const noexcept { return std::chrono::duration<float, std::milli>(m_Time).count(); }
+        inline std::chrono::nanoseconds GetDuration() const noexcept { return m_Time; }
     };
 }
 
@@ -35,7 +35,7 @@ namespace WackyEngine
         inline static void SetResizedCallback(std::function<void(GLFWwindow*, int, int)> callback) { m_ResizeCallbackExtension = callback; }
 
         inline int GetWidth() const noexcept { return m_Width; }
-        inline int GetHeight() const noexcept{ return m_Width; }
+        inline int GetHeight() const noexcept{ return m_Height; }
         inline std::string GetTitle() const noexcept{ return m_Title; }
         inline VkSurfaceKHR GetSurface() const noexcept{ return m_Surface; }
         inline GLFWwindow* GetGLFWWindow() const noexcept { return m_GLFWWindow; }
@@ -0,0 +1,57 @@
+#ifndef WACKYENGINE_GRAPHICS_CAMERA2D_H_
+#define WACKYENGINE_GRAPHICS_CAMERA2D_H_
+
+#include <cstdint>
+
+#include "WackyEngine/Math/Matrix4.h"
+#include "WackyEngine/Math/Rectangle.h"
+#include "WackyEngine/Math/Transform2D.h"
+#include "WackyEngine/Math/Vector2.h"
+
+namespace WackyEngine
+{
+    // Position is the world point shown at the centre of the viewport. Zoom scales about that point and rotation
+    // turns the view around it. A new camera centred on half the viewport size maps world units straight to pixels.
+    class Camera2D
+    {
+    private:
+        Vector2 m_Position;
+        float m_Zoom;
+        float m_Rotation;
+        std::uint32_t m_ViewportWidth;
+        std::uint32_t m_ViewportHeight;
+
+        Transform2D m_View;
+        Transform2D m_InverseView;
+        Matrix4 m_ViewProjection;
+        Rectangle m_VisibleBounds;
+
+        void Recalculate();
+
+    public:
+        Camera2D(const std::uint32_t viewportWidth, const std::uint32_t viewportHeight);
+
+        void SetPosition(const Vector2& position);
+        void Move(const Vector2& offset);
+        // Throw unless zoom is positive and finite and rotation is finite.
+        void SetZoom(const float zoom);
+        void SetRotation(const float rotation);
+
+        // Throws on an empty viewport, as does the constructor.
+        void SetViewportSize(const std::uint32_t width, const std::uint32_t height);
+
+        Vector2 ScreenToWorld(const Vector2& point) const noexcept;
+        Vector2 WorldToScreen(const Vector2& point) const noexcept;
+
+        inline const Vector2& GetPosition() const noexcept { return m_Position; }
+        inline float GetZoom() const noexcept { return m_Zoom; }
+        inline float GetRotation() const noexcept { return m_Rotation; }
+        inline const Transform2D& GetView() const noexcept { return m_View; }
+        inline const Matrix4& GetViewProjection() const noexcept { return m_ViewProjection; }
+
+        // World space bounds of everything on screen, rotated views give the enclosing axis aligned box.
+        inline const Rectangle& GetVisibleBounds() const noexcept { return m_VisibleBounds; }
+    };
+}
+
+#endif
\ No newline at end of file
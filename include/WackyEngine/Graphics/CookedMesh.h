@@ -0,0 +1,70 @@
+#ifndef WACKYENGINE_GRAPHICS_COOKEDMESH_H_
+#define WACKYENGINE_GRAPHICS_COOKEDMESH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace WackyEngine
+{
+    class Model;
+    struct MeshData;
+
+    // Start of a .wmesh file. The vertex and index blobs follow, each already in the layout the GPU buffers use,
+    // so loading is one copy from the mapped file into a staging buffer.
+    struct CookedMeshHeader
+    {
+        std::uint32_t Magic;
+        std::uint32_t Version;
+
+        // Checked against Vertex at load, a mismatch means the file needs recooking.
+        std::uint32_t VertexStride;
+        std::uint32_t VertexAttributes;
+
+        std::uint32_t VertexCount;
+        std::uint32_t IndexCount;
+
+        // 2 or 4, picked by the cooker the same way Model picks its index type.
+        std::uint32_t IndexSize;
+        std::uint32_t Reserved;
+
+        float BoundsMin[3];
+        float BoundsMax[3];
+
+        // From the start of the file, both multiples of BLOB_ALIGNMENT.
+        std::uint64_t VertexOffset;
+        std::uint64_t IndexOffset;
+    };
+
+    class CookedMesh
+    {
+    public:
+        static constexpr std::uint32_t MAGIC = 0x48534D57; // "WMSH"
+        static constexpr std::uint32_t VERSION = 1;
+
+        // Covers optimalBufferCopyOffsetAlignment and nonCoherentAtomSize on every device around.
+        static constexpr std::size_t BLOB_ALIGNMENT = 256;
+
+        struct LoadStatistics
+        {
+            std::size_t Bytes;
+            double Seconds;
+            double MegabytesPerSecond;
+        };
+
+        // CPU only, used by the MeshCooker tool.
+        static void Write(const std::string& path, const MeshData& mesh);
+
+        // Maps the file and uploads it straight from the mapping. Cooked models don't keep CPU copies of their data.
+        static Model* Load(const std::string& path, LoadStatistics* statistics = nullptr);
+
+        // Every check Load makes before touching the GPU, on the whole file's bytes. Returns the header once the
+        // blobs it describes are known to be in bounds and every index to be in range, throws otherwise.
+        static CookedMeshHeader Validate(const std::byte* data, std::size_t size);
+
+        // Vertex layout the running build expects, stored in VertexAttributes.
+        static std::uint32_t GetVertexAttributes() noexcept;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -36,12 +36,18 @@ namespace WackyEngine
 
     class DescriptorWriter
     {
+    public:
+        static constexpr std::uint32_t MAX_WRITES = 8;
+
     private:
         VkDescriptorSet m_DestinationSet;
-        std::vector<VkWriteDescriptorSet> m_DescriptorWrites;
+        VkWriteDescriptorSet m_DescriptorWrites[MAX_WRITES];
+        std::uint32_t m_WriteCount;
+
+        VkWriteDescriptorSet& AddWrite(std::uint32_t binding, std::uint32_t count, VkDescriptorType type);
 
     public:
-        DescriptorWriter(VkDescriptorSet destinationSet) : m_DestinationSet(destinationSet) { }
+        DescriptorWriter(VkDescriptorSet destinationSet) : m_DestinationSet(destinationSet), m_WriteCount(0) { }
 
         DescriptorWriter& WriteBuffer(std::uint32_t binding, std::uint32_t count, VkDescriptorType type, VkDescriptorBufferInfo* bufferInfo);
         DescriptorWriter& WriteImage(std::uint32_t binding, std::uint32_t count, VkDescriptorType type, VkDescriptorImageInfo* imageInfo);
@@ -0,0 +1,107 @@
+#ifndef WACKYENGINE_GRAPHICS_FRAMECAPTURE_H_
+#define WACKYENGINE_GRAPHICS_FRAMECAPTURE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "WackyEngine/Core/Buffer.h"
+#include "WackyEngine/Graphics/RenderSystem.h"
+
+namespace WackyEngine
+{
+    enum class CaptureFormat
+    {
+        PNG,
+        // Tightly packed RGBA8 rows, top row first, no header.
+        Raw
+    };
+
+    // Saves frames without stalling the render loop. Capture records a copy of the frame into one of a ring of
+    // persistently mapped buffers, Poll hands copies whose frames have finished on the GPU to encoder threads,
+    // and nothing on the render thread waits for either. A capture made while every buffer is busy is dropped.
+    // The render system has to outlive this.
+    class FrameCapture
+    {
+    private:
+        enum class SlotState : std::uint32_t
+        {
+            Free,
+            Recorded,
+            Encoding
+        };
+
+        struct Slot
+        {
+            std::atomic<SlotState> State { SlotState::Free };
+
+            Buffer* Readback = nullptr;
+            void* Mapped = nullptr;
+            VkDeviceSize Capacity = 0;
+
+            // Frame the copy was recorded in. Its timeline value is only known once the frame has been submitted.
+            std::uint64_t FrameNumber = 0;
+            std::uint32_t FrameIndex = 0;
+            std::uint64_t TimelineValue = 0;
+
+            VkExtent2D Extent { };
+            bool SwapRedBlue = false;
+            std::string Path;
+            CaptureFormat Format = CaptureFormat::PNG;
+        };
+
+        RenderSystem* m_RenderSystem;
+        VkMemoryPropertyFlags m_MemoryProperties;
+
+        Slot* m_Slots;
+        std::uint32_t m_SlotCount;
+
+        // Dedicated threads rather than jobs, the main thread runs jobs while it waits on counters and
+        // a long encode picked up there would stall the frame.
+        std::vector<std::thread> m_Encoders;
+        std::deque<Slot*> m_Queue;
+        std::mutex m_QueueMutex;
+        std::condition_variable m_QueueCondition;
+        bool m_Stopping;
+
+        std::atomic<std::uint32_t> m_PendingEncodes;
+        std::atomic<std::uint64_t> m_CompletedCount;
+        std::atomic<std::uint64_t> m_FailedCount;
+        std::uint64_t m_DroppedCount;
+
+        void EnsureCapacity(Slot& slot, VkDeviceSize size);
+        void EncoderLoop();
+        void Encode(Slot& slot);
+
+    public:
+        FrameCapture(RenderSystem* renderSystem, std::uint32_t slotCount = 3, std::uint32_t encoderCount = 2);
+        ~FrameCapture();
+
+        FrameCapture(const FrameCapture&) = delete;
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        // Records a copy of the image being rendered, call after EndRenderPass and before EndFrame.
+        // Returns false, dropping the capture, when every buffer is still waiting on the GPU or an encoder.
+        bool Capture(VkCommandBuffer cmdBuffer, const std::string& path, CaptureFormat format = CaptureFormat::PNG);
+
+        // Hands finished copies to the encoders. Never blocks, call once a frame.
+        void Poll();
+
+        // Waits for the GPU and the encoders to finish every submitted capture. For shutdown, not the render loop.
+        void Flush();
+
+        inline std::uint32_t GetSlotCount() const noexcept { return m_SlotCount; }
+        inline std::uint64_t GetCompletedCount() const noexcept { return m_CompletedCount.load(std::memory_order_relaxed); }
+        inline std::uint64_t GetFailedCount() const noexcept { return m_FailedCount.load(std::memory_order_relaxed); }
+        inline std::uint64_t GetDroppedCount() const noexcept { return m_DroppedCount; }
+    };
+}
+
+#endif
\ No newline at end of file
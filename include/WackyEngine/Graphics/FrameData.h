@@ -0,0 +1,31 @@
+#ifndef WACKYENGINE_GRAPHICS_FRAMEDATA_H_
+#define WACKYENGINE_GRAPHICS_FRAMEDATA_H_
+
+#include <cstdint>
+
+#include <vulkan/vulkan.h>
+
+#include "WackyEngine/Core/FrameArena.h"
+
+namespace WackyEngine
+{
+    struct FrameData
+    {
+        VkCommandBuffer CmdBuffer;
+
+        // Frame in flight slot, use for anything duplicated per frame (descriptor sets, uniform buffers).
+        std::uint32_t FrameIndex;
+
+        // Swap chain image being rendered to.
+        std::uint32_t ImageIndex;
+
+        // Fraction of a fixed step left in the accumulator, for blending between the
+        // previous and current simulation states. Always 1 with a variable timestep.
+        float InterpolationAlpha;
+
+        // Scratch memory valid until this frame slot is reused.
+        FrameArena* Arena;
+    };
+}
+
+#endif
\ No newline at end of file
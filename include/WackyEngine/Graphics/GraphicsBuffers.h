@@ -1,48 +1,56 @@
 #ifndef WACKYENGINE_GRAPHICS_GRAPHICSBUFFERS_H_
 #define WACKYENGINE_GRAPHICS_GRAPHICSBUFFERS_H_
 
+#include <vector>
+
 #include "WackyEngine/Core/Device.h"
 #include "WackyEngine/Core/Buffer.h"
 #include "WackyEngine/Graphics/Vertex.h"
 
 namespace WackyEngine
 {
+    // Streamed every frame, so each frame in flight gets its own host visible buffer. Flush writes the frame's
+    // buffer directly, it is only reused once that frame's fence has been waited on and needs no copy or stall.
     class VertexBuffer
     {
     private:
-        Buffer m_Buffer;
-        Buffer m_StagingBuffer;
-        Vertex* m_VertexArray;
-        Vertex* m_FrontHandle;
+        std::vector<Buffer*> m_Buffers;
+        Vertex2D* m_VertexArray;
+        Vertex2D* m_FrontHandle;
 
     public:
-        VertexBuffer(const std::size_t count);
+        VertexBuffer(const std::size_t count, const std::uint32_t frameCount);
         ~VertexBuffer();
 
+        VertexBuffer(const VertexBuffer&) = delete;
+        VertexBuffer& operator=(const VertexBuffer&) = delete;
+
         inline void Reset() { m_FrontHandle = m_VertexArray; }
-        inline VkBuffer GetBufferObject() const noexcept { return m_Buffer.GetBufferObject(); }
+        inline VkBuffer GetBufferObject(const std::uint32_t frameIndex) const noexcept { return m_Buffers[frameIndex]->GetBufferObject(); }
         inline std::size_t GetCount() const noexcept { return static_cast<std::size_t>(m_FrontHandle - m_VertexArray); }
-        void AddVertex(const Vertex& vertex);
-        void Flush();
+        void AddVertex(const Vertex2D& vertex);
+        void Flush(const std::uint32_t frameIndex);
     };
 
     class IndexBuffer
     {
     private:
-        Buffer m_Buffer;
-        Buffer m_StagingBuffer;
+        std::vector<Buffer*> m_Buffers;
         std::uint16_t* m_IndexArray;
         std::uint16_t* m_FrontHandle;
 
     public:
-        IndexBuffer(const std::size_t count);
+        IndexBuffer(const std::size_t count, const std::uint32_t frameCount);
         ~IndexBuffer();
 
+        IndexBuffer(const IndexBuffer&) = delete;
+        IndexBuffer& operator=(const IndexBuffer&) = delete;
+
         inline void Reset() { m_FrontHandle = m_IndexArray; }
-        inline VkBuffer GetBufferObject() const noexcept { return m_Buffer.GetBufferObject(); }
+        inline VkBuffer GetBufferObject(const std::uint32_t frameIndex) const noexcept { return m_Buffers[frameIndex]->GetBufferObject(); }
         inline std::size_t GetCount() const noexcept { return static_cast<std::size_t>(m_FrontHandle - m_IndexArray); }
         void AddIndex(const std::uint16_t index);
-        void Flush();
+        void Flush(const std::uint32_t frameIndex);
     };
 }
 
@@ -0,0 +1,25 @@
+#ifndef WACKYENGINE_GRAPHICS_IMAGEWRITER_H_
+#define WACKYENGINE_GRAPHICS_IMAGEWRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WackyEngine
+{
+    // Encoders for RGBA8 images, tightly packed rows with the top row first. Safe to call from any thread.
+    namespace ImageWriter
+    {
+        // Per row adaptive filtering and a single fixed Huffman deflate block, or stored blocks when that would be
+        // larger. Not as small as zlib's best, but fast enough to keep up with captures and readable everywhere.
+        std::vector<std::uint8_t> EncodePNG(std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels);
+
+        void WritePNG(const std::string& path, std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels);
+
+        // Pixels as they are, no header.
+        void WriteRaw(const std::string& path, const std::uint8_t* data, std::size_t size);
+    }
+}
+
+#endif
\ No newline at end of file
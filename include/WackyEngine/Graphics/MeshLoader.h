@@ -0,0 +1,35 @@
+#ifndef WACKYENGINE_GRAPHICS_MESHLOADER_H_
+#define WACKYENGINE_GRAPHICS_MESHLOADER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "WackyEngine/Core/JobSystem.h"
+#include "WackyEngine/Graphics/Model.h"
+#include "WackyEngine/Graphics/Vertex.h"
+
+namespace WackyEngine
+{
+    // CPU side result of a load, welded and optimised but not yet uploaded.
+    struct MeshData
+    {
+        std::string Name;
+        std::vector<Vertex> Vertices;
+        std::vector<std::uint32_t> Indices;
+    };
+
+    // Loads .obj and binary glTF (.glb) files. Every mesh in the file is welded down to unique vertices, then
+    // reordered for the vertex cache and vertex fetch. Meshes are processed in parallel on the job system.
+    class MeshLoader
+    {
+    public:
+        // Doesn't touch the GPU, so it can be used by offline tools. Runs serially when jobSystem is null.
+        static std::vector<MeshData> LoadData(const std::string& path, JobSystem* jobSystem = nullptr);
+
+        // One Model per mesh in the file. Uploads happen on the calling thread, the caller owns the models.
+        static std::vector<Model*> Load(const std::string& path);
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#ifndef WACKYENGINE_GRAPHICS_MESHOPTIMISER_H_
+#define WACKYENGINE_GRAPHICS_MESHOPTIMISER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "WackyEngine/Graphics/Vertex.h"
+
+namespace WackyEngine
+{
+    // Offline passes for triangle lists, run once at load. Order matters: vertex cache first, then overdraw, which
+    // works on the cache optimised order, then vertex fetch, since fetch order follows the final triangle order.
+    namespace MeshOptimiser
+    {
+        // Modelled LRU size, most GPUs behave close to this regardless of their real post-transform cache.
+        static constexpr std::uint32_t CACHE_SIZE = 32;
+
+        // Reorders triangles so shared vertices are reused while still in the post-transform cache, after
+        // Tom Forsyth's linear-speed vertex cache optimisation.
+        void OptimiseVertexCache(std::vector<std::uint32_t>& indices, std::size_t vertexCount);
+
+        // Splits the triangles into clusters where that costs little vertex cache efficiency, then sorts the clusters
+        // so outward facing ones far from the centre draw first and tend to occlude the rest, after Sander et al.'s
+        // view independent overdraw ordering. Face normals come from the positions, so no vertex normals are needed.
+        // threshold is how much worse than its hard cluster's ACMR a split point may be, 1.05 allows 5%.
+        void OptimiseOverdraw(std::vector<std::uint32_t>& indices, const std::vector<Vertex>& vertices, float threshold = 1.05f);
+
+        // Lays vertices out in the order they are first used and drops unreferenced ones, so fetches walk memory forwards.
+        void OptimiseVertexFetch(std::vector<Vertex>& vertices, std::vector<std::uint32_t>& indices);
+
+        // Average cache misses per triangle for a FIFO cache, 0.5 is the ideal for a regular grid and 3 the worst.
+        float GetACMR(const std::vector<std::uint32_t>& indices, std::size_t vertexCount, std::uint32_t cacheSize = 16);
+    }
+}
+
+#endif
\ No newline at end of file
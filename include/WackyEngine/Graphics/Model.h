@@ -1,7 +1,9 @@
 #ifndef WACKYENGINE_GRAPHICS_MODEL_H_
 #define WACKYENGINE_GRAPHICS_MODEL_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 
@@ -11,24 +13,46 @@
 
 namespace WackyEngine
 {
+    struct CookedMeshHeader;
+
+    // Standalone mesh with its own buffers. No CPU copy is kept once uploaded, merge the source data into a
+    // MeshRenderer with AddModel instead.
     class Model
     {
     private:
+        friend class CookedMesh;
+
+        // 16-bit on the GPU whenever the vertex count allows it.
+        VkIndexType m_IndexType;
+
         Buffer* m_VertexBuffer;
         Buffer* m_IndexBuffer;
 
         std::uint32_t m_VertexCount;
         std::uint32_t m_IndexCount;
 
+        void Upload(const std::vector<Vertex>& vertices, const std::vector<std::uint32_t>& indices);
+
+        // data is the whole cooked file, already validated against header.
+        Model(const CookedMeshHeader& header, const std::byte* data);
+
     public:
         static Model* GetTestCube();
         static Model* GetTestQuad();
 
-        Model(const std::vector<Vertex>& vertices, const std::vector<std::uint16_t> indices);
+        Model(const std::vector<Vertex>& vertices, const std::vector<std::uint16_t>& indices);
+        Model(const std::vector<Vertex>& vertices, const std::vector<std::uint32_t>& indices);
         ~Model();
 
+        Model(const Model&) = delete;
+        Model& operator=(const Model&) = delete;
+
         void Bind(VkCommandBuffer buffer) const noexcept;
         void Draw(VkCommandBuffer buffer) const noexcept;
+
+        inline VkIndexType GetIndexType() const noexcept { return m_IndexType; }
+        inline std::uint32_t GetVertexCount() const noexcept { return m_VertexCount; }
+        inline std::uint32_t GetIndexCount() const noexcept { return m_IndexCount; }
     };
 }
 
@@ -0,0 +1,86 @@
+#ifndef WACKYENGINE_GRAPHICS_OFFSCREENTARGET_H_
+#define WACKYENGINE_GRAPHICS_OFFSCREENTARGET_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "WackyEngine/Core/Buffer.h"
+#include "WackyEngine/Graphics/RenderPass.h"
+#include "WackyEngine/Graphics/RenderTarget.h"
+
+namespace WackyEngine
+{
+    // Swap chain stand in for headless rendering. Each frame in flight has its own colour image, so the image
+    // index is always the frame index, and nothing waits on a display.
+    class OffscreenTarget : public RenderTarget
+    {
+    private:
+        std::uint32_t m_CurrentFrame = 0;
+        std::uint32_t m_FramesInFlight;
+
+        // Image the last submitted frame rendered into, UINT32_MAX until the first submission.
+        std::uint32_t m_LastImage;
+
+        VkExtent2D m_Extent;
+
+        std::vector<VkImage> m_Images;
+        std::vector<VkDeviceMemory> m_ImageMemory;
+        std::vector<VkImageView> m_ImageViews;
+        std::vector<VkFramebuffer> m_Framebuffers;
+
+        VkFormat m_DepthFormat;
+        VkImage m_DepthImage = VK_NULL_HANDLE;
+        VkDeviceMemory m_DepthMemory = VK_NULL_HANDLE;
+        VkImageView m_DepthImageView = VK_NULL_HANDLE;
+
+        RenderPass* m_RenderPass;
+
+        std::vector<std::uint64_t> m_FrameTimelineValues;
+
+        // Host visible, sized for one full image.
+        Buffer* m_ReadbackBuffer;
+
+        void InitialiseImages();
+        void InitialiseDepthResources();
+        void InitialiseFramebuffers();
+
+    public:
+        // RGBA in memory order, encoded the same way a typical sRGB swap chain would display it.
+        static constexpr VkFormat FORMAT = VK_FORMAT_R8G8B8A8_SRGB;
+
+        OffscreenTarget(VkExtent2D extent);
+        ~OffscreenTarget() override;
+
+        OffscreenTarget(const OffscreenTarget&) = delete;
+        OffscreenTarget& operator=(const OffscreenTarget&) = delete;
+
+        // Recreates the images at the new size, call between frames.
+        void Resize(VkExtent2D extent);
+
+        VkResult AcquireNextImage(std::uint32_t& imageIndex) override;
+        VkResult SubmitCommandBuffers(const VkCommandBuffer buffer, const std::uint32_t imageIndex) override;
+        void Reinitialise() override;
+
+        // Copies the last submitted frame to pixels as tightly packed RGBA8 rows, top row first.
+        // Blocks until the frame and the copy have finished on the GPU.
+        void Readback(std::vector<std::uint8_t>& pixels);
+
+        inline bool HasFrame() const noexcept { return m_LastImage != UINT32_MAX; }
+        inline std::size_t GetImageSize() const noexcept { return static_cast<std::size_t>(m_Extent.width) * m_Extent.height * 4; }
+        inline const std::vector<VkImage>& GetImages() const noexcept { return m_Images; }
+
+        inline std::uint32_t GetCurrentFrame() const noexcept override { return m_CurrentFrame; }
+        inline std::uint32_t GetFramesInFlight() const noexcept override { return m_FramesInFlight; }
+        inline VkExtent2D GetExtent() const noexcept override { return m_Extent; }
+        inline const std::vector<VkFramebuffer>& GetFramebuffers() const noexcept override { return m_Framebuffers; }
+        inline RenderPass* GetRenderPass() const noexcept override { return m_RenderPass; }
+        inline VkImage GetImage(std::uint32_t imageIndex) const noexcept override { return m_Images[imageIndex]; }
+        inline VkFormat GetColourFormat() const noexcept override { return FORMAT; }
+        inline bool CanReadBack() const noexcept override { return true; }
+        inline std::uint64_t GetFrameValue(std::uint32_t frameIndex) const noexcept override { return m_FrameTimelineValues[frameIndex]; }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -1,6 +1,9 @@
 #ifndef WACKYENGINE_GRAPHICS_PIPELINE_H_
 #define WACKYENGINE_GRAPHICS_PIPELINE_H_
 
+#include <string>
+#include <vector>
+
 #include "WackyEngine/Core/Device.h"
 #include "WackyEngine/Graphics/RenderPass.h"
 #include "WackyEngine/Graphics/Texture.h"
@@ -22,25 +25,42 @@ namespace WackyEngine
         VkPipelineDepthStencilStateCreateInfo DepthStencilInfo;
         std::vector<VkDynamicState> DynamicStateEnables;
         VkPipelineDynamicStateCreateInfo DynamicStateInfo;
+        std::vector<VkVertexInputBindingDescription> BindingDescriptions;
+        std::vector<VkVertexInputAttributeDescription> AttributeDescriptions;
         VkPipelineLayout PipelineLayout = nullptr;
         VkRenderPass RenderPass = nullptr;
         uint32_t Subpass = 0;
+
+        // Compiled SPIR-V, relative to the working directory.
+        std::string VertexShader = "shaders/shader.vert.spv";
+        std::string FragmentShader = "shaders/shader.frag.spv";
     };
 
     class Pipeline
     {
     private:
         VkPipeline m_Pipeline;
+        VkPipelineBindPoint m_BindPoint;
 
-        VkShaderModule CreateShaderModule(const std::string& shaderFile);
+        Pipeline() { }
 
     public:
+        static VkShaderModule CreateShaderModule(const std::string& shaderFile);
+
+        // Single compute stage, the layout is owned by the caller like a graphics config's.
+        static Pipeline* CreateCompute(const std::string& shaderFile, VkPipelineLayout pipelineLayout);
+
         Pipeline(const PipelineConfig& config);
         ~Pipeline();
 
-        void GetDefaultConfig(PipelineConfig& config) const noexcept;
+        static void GetDefaultConfig(PipelineConfig& config) noexcept;
+
+        // Opaque geometry writes depth so anything behind it is rejected before shading, blended geometry
+        // should test without writing so it doesn't hide what is drawn after it.
+        static void EnableDepthTest(PipelineConfig& config, bool depthWrite = true, VkCompareOp compareOp = VK_COMPARE_OP_LESS_OR_EQUAL) noexcept;
 
         inline VkPipeline GetPipeline() const noexcept { return m_Pipeline; }
+        inline VkPipelineBindPoint GetBindPoint() const noexcept { return m_BindPoint; }
     };
 }
 
@@ -11,14 +11,23 @@ namespace WackyEngine
     {
     private:
         VkRenderPass m_RenderPass;
+        VkFormat m_DepthFormat = VK_FORMAT_UNDEFINED;
+        VkImageLayout m_FinalLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
     public:
-        static RenderPass* CreateSimplePass(VkFormat format);
+        // Single subpass presenting to the swap chain, with a cleared depth attachment unless the depth format is undefined.
+        // Offscreen targets end in a transfer source layout instead so they can be copied out.
+        static RenderPass* CreateSimplePass(VkFormat format, VkFormat depthFormat = VK_FORMAT_UNDEFINED, VkImageLayout finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
 
         RenderPass() { }
         ~RenderPass();
 
         inline VkRenderPass GetRenderPass() const noexcept { return m_RenderPass; }
+        inline VkFormat GetDepthFormat() const noexcept { return m_DepthFormat; }
+        inline bool HasDepth() const noexcept { return m_DepthFormat != VK_FORMAT_UNDEFINED; }
+
+        // Layout the colour attachment is left in when the pass ends.
+        inline VkImageLayout GetFinalLayout() const noexcept { return m_FinalLayout; }
     };
 }
 
@@ -2,6 +2,9 @@
 #define WACKYENGINE_GRAPHICS_RENDERSYSTEM_H_
 
 #include "WackyEngine/Core/Device.h"
+#include "WackyEngine/Core/FrameArena.h"
+#include "WackyEngine/Graphics/OffscreenTarget.h"
+#include "WackyEngine/Graphics/RenderTarget.h"
 #include "WackyEngine/Graphics/SwapChain.h"
 #include "WackyEngine/Math/Vector3.h"
 
@@ -12,10 +15,19 @@ namespace WackyEngine
     private:
         bool m_FrameStarted;
         std::uint32_t m_CurrentIndex;
+        std::uint32_t m_CurrentFrame;
         Vector3 m_ClearColour;
 
+        // Frames handed to the GPU so far, whether or not presenting them succeeded.
+        std::uint64_t m_SubmittedFrames;
+
+        // Exactly one of these exists, m_Target points at whichever it is.
         SwapChain* m_SwapChain;
+        OffscreenTarget* m_OffscreenTarget;
+        RenderTarget* m_Target;
+
         std::vector<VkCommandBuffer> m_CommandBuffers;
+        FrameArena* m_FrameArena;
 
         void InitialiseCommandBuffers();
 
@@ -29,12 +41,22 @@ namespace WackyEngine
         void EndRenderPass(VkCommandBuffer buffer);
 
         inline void SetClearColour(const Vector3& colour) { m_ClearColour = colour; }
+        // Ignored when headless.
+        inline void SetPresentMode(VkPresentModeKHR presentMode) { if (m_SwapChain) m_SwapChain->SetPresentMode(presentMode); }
 
         inline bool IsFrameStarted() const noexcept { return m_FrameStarted; }
         inline std::uint32_t GetCurrentIndex() const noexcept { return m_CurrentIndex; }
-        inline RenderPass* GetSwapRenderPass() const noexcept { return m_SwapChain->GetRenderPass(); }
+        inline std::uint32_t GetCurrentFrame() const noexcept { return m_CurrentFrame; }
+        inline std::uint64_t GetSubmittedFrameCount() const noexcept { return m_SubmittedFrames; }
+        inline FrameArena* GetFrameArena() const noexcept { return m_FrameArena; }
+        inline RenderPass* GetSwapRenderPass() const noexcept { return m_Target->GetRenderPass(); }
+        inline RenderTarget* GetRenderTarget() const noexcept { return m_Target; }
+
+        // Null when headless.
         inline SwapChain* GetSwapChain() const noexcept { return m_SwapChain; }
 
+        // Null unless headless.
+        inline OffscreenTarget* GetOffscreenTarget() const noexcept { return m_OffscreenTarget; }
     };
 }
 
@@ -0,0 +1,41 @@
+#ifndef WACKYENGINE_GRAPHICS_RENDERTARGET_H_
+#define WACKYENGINE_GRAPHICS_RENDERTARGET_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "WackyEngine/Graphics/RenderPass.h"
+
+namespace WackyEngine
+{
+    // What RenderSystem renders its frames into, the swap chain or an offscreen target when headless.
+    class RenderTarget
+    {
+    public:
+        virtual ~RenderTarget() { }
+
+        // Waits for the frame slot to be free, then picks the image to render into.
+        virtual VkResult AcquireNextImage(std::uint32_t& imageIndex) = 0;
+        virtual VkResult SubmitCommandBuffers(const VkCommandBuffer buffer, const std::uint32_t imageIndex) = 0;
+        virtual void Reinitialise() = 0;
+
+        virtual std::uint32_t GetCurrentFrame() const noexcept = 0;
+        virtual std::uint32_t GetFramesInFlight() const noexcept = 0;
+        virtual VkExtent2D GetExtent() const noexcept = 0;
+        virtual const std::vector<VkFramebuffer>& GetFramebuffers() const noexcept = 0;
+        virtual RenderPass* GetRenderPass() const noexcept = 0;
+
+        virtual VkImage GetImage(std::uint32_t imageIndex) const noexcept = 0;
+        virtual VkFormat GetColourFormat() const noexcept = 0;
+
+        // Whether images can be copied out, swap chains need the surface to allow transfer source usage.
+        virtual bool CanReadBack() const noexcept = 0;
+
+        // Timeline value the frame slot's last submission signals, 0 before its first.
+        virtual std::uint64_t GetFrameValue(std::uint32_t frameIndex) const noexcept = 0;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,156 @@
+#ifndef WACKYENGINE_GRAPHICS_RENDERERS_MESHRENDERER_H_
+#define WACKYENGINE_GRAPHICS_RENDERERS_MESHRENDERER_H_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "WackyEngine/Core/Buffer.h"
+#include "WackyEngine/Graphics/FrameData.h"
+#include "WackyEngine/Graphics/MeshLoader.h"
+#include "WackyEngine/Graphics/Pipeline.h"
+#include "WackyEngine/Graphics/RenderPass.h"
+#include "WackyEngine/Graphics/Vertex.h"
+#include "WackyEngine/Math/Matrix4.h"
+#include "WackyEngine/Math/Vector4.h"
+
+namespace WackyEngine
+{
+    // Every mesh lives in one shared vertex and index buffer, so a frame binds them once. Instances are
+    // gathered per mesh and drawn with one indirect command each, all issued in a single indirect draw
+    // where the device supports multi draw indirect. Cull moves frustum culling and command generation
+    // onto the GPU for scenes too large to test on the CPU each frame.
+    class MeshRenderer
+    {
+    public:
+        // Counts since the last Begin.
+        struct Statistics
+        {
+            std::uint32_t Instances;
+            std::uint32_t DrawCalls;
+        };
+
+    private:
+        struct PC
+        {
+            Matrix4 ViewProjection;
+        };
+
+        // Matches cull.comp and compact.comp. Planes point inwards, xyz normal and w distance.
+        struct CullPC
+        {
+            Vector4 Planes[6];
+            std::uint32_t InstanceCount;
+            std::uint32_t MeshCount;
+        };
+
+        // Where a mesh sits in the shared buffers.
+        struct MeshRange
+        {
+            std::uint32_t IndexCount;
+            std::uint32_t FirstIndex;
+            std::int32_t VertexOffset;
+        };
+
+        std::uint32_t m_FramesInFlight;
+        std::uint32_t m_MaxInstances;
+
+        Pipeline* m_Pipeline;
+        VkPipelineLayout m_PipelineLayout;
+
+        // Source data is only kept until Build.
+        std::vector<Vertex> m_Vertices;
+        std::vector<std::uint32_t> m_Indices;
+        std::vector<MeshRange> m_Meshes;
+
+        // Mesh space bounding sphere per mesh, xyz centre and w radius.
+        std::vector<Vector4> m_Bounds;
+
+        Buffer* m_VertexBuffer;
+        Buffer* m_IndexBuffer;
+
+        // 16-bit unless some mesh has more than 65536 vertices.
+        VkIndexType m_IndexType;
+        std::size_t m_LargestMesh;
+
+        // Per frame in flight, rewritten every End or Cull.
+        std::vector<Buffer*> m_InstanceBuffers;
+        std::vector<Buffer*> m_IndirectBuffers;
+
+        // GPU Culling
+        // The cull pass writes each visible instance into its mesh's run of the visible buffer, counting them
+        // in the indirect buffer's commands. The compact pass then packs commands with instances and their count.
+        Pipeline* m_CullPipeline;
+        Pipeline* m_CompactPipeline;
+        VkPipelineLayout m_CullPipelineLayout;
+        VkDescriptorPool m_CullDescriptorPool;
+        VkDescriptorSetLayout m_CullDescriptorSetLayout;
+        std::vector<VkDescriptorSet> m_CullDescriptorSets;
+
+        Buffer* m_BoundsBuffer;
+        std::vector<Buffer*> m_InstanceMeshBuffers;
+        std::vector<Buffer*> m_VisibleBuffers;
+        std::vector<Buffer*> m_CompactCommandBuffers;
+        std::vector<Buffer*> m_DrawCountBuffers;
+
+        // Set by Cull, End then draws what survived.
+        bool m_Culled;
+        std::uint32_t m_DrawCount;
+
+        // This frame's transforms, bucketed by mesh.
+        std::vector<std::vector<Matrix4>> m_Instances;
+        std::uint32_t m_InstanceCount;
+
+        Matrix4 m_ViewProjection;
+        Statistics m_Statistics;
+
+        // Uploads this frame's transforms mesh by mesh and the commands drawing them, returning the command count.
+        // For culling every mesh gets a command, with no instances until the cull pass counts them.
+        std::uint32_t WriteInstances(const FrameData& frameData, bool culling);
+        void DrawIndirect(VkCommandBuffer cmdBuffer, VkBuffer indirectBuffer, std::uint32_t drawCount);
+
+        void InitialisePipelineLayout();
+        void InitialisePipeline(const RenderPass* renderPass);
+        void InitialiseCulling();
+
+    public:
+        MeshRenderer(const RenderPass* renderPass, std::uint32_t maxInstances = 16384);
+        ~MeshRenderer();
+
+        MeshRenderer(const MeshRenderer&) = delete;
+        MeshRenderer& operator=(const MeshRenderer&) = delete;
+
+        // Only before Build. Returns the mesh's index for drawing.
+        std::uint32_t AddMesh(const std::vector<Vertex>& vertices, const std::vector<std::uint32_t>& indices);
+        // Loaded meshes go in from their source data, there is no need to create a Model for them first.
+        std::uint32_t AddModel(const MeshData& mesh);
+
+        // Uploads every mesh to device local memory and releases the CPU copies.
+        void Build();
+
+        void Begin();
+
+        // Tests every instance against the view projection's frustum on the GPU. Call once the frame's instances
+        // are submitted and before the render pass begins, End then draws only the visible ones.
+        void Cull(const FrameData& frameData);
+
+        // Copies a frame's compacted commands back and returns how many the cull pass kept, for tests and
+        // debugging. Call once that frame has been submitted, it stalls until the GPU has finished it.
+        std::uint32_t ReadCullResults(std::uint32_t frameIndex, std::vector<VkDrawIndexedIndirectCommand>& commands) const;
+
+        void End(const FrameData& frameData);
+
+        void DrawInstance(std::uint32_t mesh, const Matrix4& transform);
+        void DrawInstances(std::uint32_t mesh, std::span<const Matrix4> transforms);
+
+        inline void SetViewProjection(const Matrix4& viewProjection) noexcept { m_ViewProjection = viewProjection; }
+
+        inline bool IsBuilt() const noexcept { return m_VertexBuffer != nullptr; }
+        inline std::uint32_t GetMeshCount() const noexcept { return static_cast<std::uint32_t>(m_Meshes.size()); }
+        inline const Statistics& GetStatistics() const noexcept { return m_Statistics; }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -1,26 +1,76 @@
 #ifndef WACKYENGINE_GRAPHICS_RENDERERS_RENDERER2D_H_
 #define WACKYENGINE_GRAPHICS_RENDERERS_RENDERER2D_H_
 
+#include <span>
+
+#include "WackyEngine/Graphics/Camera2D.h"
 #include "WackyEngine/Graphics/Pipeline.h"
+#include "WackyEngine/Graphics/StaticBatch.h"
 #include "WackyEngine/Graphics/Model.h"
 #include "WackyEngine/Graphics/Vertex.h"
 #include "WackyEngine/Math/Matrix4.h"
 #include "WackyEngine/Math/Rectangle.h"
+#include "WackyEngine/Math/Vector4.h"
 #include "WackyEngine/Graphics/GraphicsBuffers.h"
+#include "WackyEngine/Graphics/FrameData.h"
 
 namespace WackyEngine
 {
     class Renderer2D
     {
-    private:
-        struct UBO
+    public:
+        // Alpha and Additive expect premultiplied textures and share one pipeline, additive quads are written
+        // with zero alpha so they add without covering what's behind.
+        enum class BlendMode
         {
-            Matrix4 ProjectionMatrix;
+            Opaque,
+            Alpha,
+            Additive
         };
 
+        // Counts since the last Begin.
+        struct Statistics
+        {
+            std::uint32_t DrawnQuads;
+            std::uint32_t CulledQuads;
+            std::uint32_t DrawCalls;
+        };
+
+    private:
+        // Pushed once per End, so moving the camera never touches the vertex data. Texture offset is added to
+        // each vertex's texture index, static batches index into their own texture list.
         struct PC
         {
-            std::uint32_t TextureIndex, test1, test2, test3;
+            Matrix4 ViewProjection;
+            std::uint32_t TextureOffset;
+        };
+
+        // Order is the submission index. Sorting on layer then order keeps equal layers in submission order
+        // without std::stable_sort, which allocates a scratch buffer every frame.
+        struct StaticDraw
+        {
+            const StaticBatch* Batch;
+            std::uint32_t TextureOffset;
+            std::uint32_t Order;
+        };
+
+        // Quads are recorded rather than written straight away so End can sort them per blend mode. Order counts
+        // across both blend mode lists, so the two can be merged back into submission order.
+        struct QuadCommand
+        {
+            Rectangle Rect;
+            std::uint32_t Colour;
+            std::uint16_t TextureIndex;
+            std::int32_t Layer;
+            std::uint32_t Order;
+        };
+
+        // Consecutive quads End draws with the same pipeline.
+        struct QuadRun
+        {
+            std::uint32_t FirstIndex;
+            std::uint32_t IndexCount;
+            bool Translucent;
         };
 
         const std::size_t MAX_TEXTURES = 8;
@@ -28,7 +78,13 @@ namespace WackyEngine
         const std::size_t MAX_VERTICES = MAX_QUADS * 4;
         const std::size_t MAX_INDICES = MAX_QUADS * 6;
 
-        Pipeline* m_Pipeline;
+        std::uint32_t m_FramesInFlight;
+
+        // Set when the render pass has a depth attachment, layers are then resolved by depth rather than draw order.
+        bool m_DepthTested;
+
+        Pipeline* m_OpaquePipeline;
+        Pipeline* m_TranslucentPipeline;
         VkPipelineLayout m_PipelineLayout;
 
         // Descriptors
@@ -36,29 +92,63 @@ namespace WackyEngine
         VkDescriptorSetLayout m_GlobalDescriptorSetLayout;
         std::vector<VkDescriptorSet> m_GlobalDescriptorSets;
 
-        // Buffers
+        // Buffers, the streamed vertices and indices have one per frame in flight.
         VertexBuffer* m_VertexBuffer;
         IndexBuffer* m_IndexBuffer;
-        std::vector<Buffer*> m_UniformBuffers;
         std::vector<Texture*> m_TextureBuffer;
+        std::vector<StaticDraw> m_StaticDraws;
+        std::vector<QuadCommand> m_OpaqueQuads;
+        std::vector<QuadCommand> m_TranslucentQuads;
+        std::vector<QuadRun> m_Runs;
         VkSampler m_Sampler;
 
+        Matrix4 m_ViewProjection;
+
+        // Quads entirely outside this are dropped before any vertices are written.
+        Rectangle m_Viewport;
+        Statistics m_Statistics;
+
+        std::uint16_t GetTextureIndex(Texture* texture);
+        void SubmitQuad(const Rectangle& rect, std::uint32_t colour, std::uint16_t textureIndex, BlendMode blendMode, std::int32_t layer);
+        void WriteQuad(const QuadCommand& quad);
+        void AppendQuad(const QuadCommand& quad, bool translucent);
+
         void InitialisePipelineLayout();
         void InitialisePipeline(const RenderPass* renderPass);
         void InitialiseDescriptors();
         void InitialiseSampler();
-        void InitialiseUniformBuffers();
 
     public:
         Renderer2D(const RenderPass* renderPass);
         ~Renderer2D();
 
         void Begin();
-        void End(VkCommandBuffer cmdBuffer, const std::uint32_t currentIndex);
+        void End(const FrameData& frameData);
 
+        // Opaque on layer 0.
         void DrawRectangle(const Rectangle& rect, const Vector3& colour, Texture* texture);
 
+        // Colour's W is alpha. Higher layers draw over lower ones, within a layer quads keep their submission order.
+        void DrawRectangle(const Rectangle& rect, const Vector4& colour, Texture* texture, BlendMode blendMode, std::int32_t layer = 0);
+
+        // Culls four rectangles at a time, prefer this over DrawRectangle in a loop for tile maps and other large sets.
+        void DrawRectangles(std::span<const Rectangle> rects, const Vector3& colour, Texture* texture);
+        void DrawRectangles(std::span<const Rectangle> rects, const Vector4& colour, Texture* texture, BlendMode blendMode, std::int32_t layer = 0);
+
+        // One bind and draw for the whole batch with the opaque pipeline, skipped if its bounds are off screen. Static
+        // batches are drawn before the frame's other quads, in the order they were submitted, or nearest layer first
+        // when depth tested so their layers sort against everything else. Must stay alive until End.
+        void DrawStaticBatch(const StaticBatch& batch);
+
+        // Screen space projection with no camera, also resets the viewport to cover the new resolution.
         void SetResolution(const std::uint32_t width, const std::uint32_t height);
+
+        // Takes the camera's view projection and culls against what it can see. Call again whenever the camera changes.
+        void SetCamera(const Camera2D& camera) noexcept;
+        inline void SetViewport(const Rectangle& viewport) noexcept { m_Viewport = viewport; }
+
+        inline const Rectangle& GetViewport() const noexcept { return m_Viewport; }
+        inline const Statistics& GetStatistics() const noexcept { return m_Statistics; }
     };
 }
 
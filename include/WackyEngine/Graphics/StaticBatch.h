@@ -0,0 +1,80 @@
+#ifndef WACKYENGINE_GRAPHICS_STATICBATCH_H_
+#define WACKYENGINE_GRAPHICS_STATICBATCH_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "WackyEngine/Core/Buffer.h"
+#include "WackyEngine/Graphics/FrameData.h"
+#include "WackyEngine/Graphics/Texture.h"
+#include "WackyEngine/Graphics/Vertex.h"
+#include "WackyEngine/Math/Rectangle.h"
+#include "WackyEngine/Math/Vector3.h"
+
+namespace WackyEngine
+{
+    // Quads built once and kept in device local memory, for tile layers and other geometry that rarely changes.
+    // Add everything, Build, then hand it to Renderer2D::DrawStaticBatch each frame. SetRectangle edits a quad
+    // in place and Upload copies only the range touched since the last upload.
+    class StaticBatch
+    {
+    public:
+        static constexpr std::size_t MAX_TEXTURES = 8;
+
+    private:
+        std::vector<Vertex2D> m_Vertices;
+        std::vector<Texture*> m_Textures;
+        Rectangle m_Bounds;
+        std::int32_t m_Layer;
+
+        Buffer* m_VertexBuffer;
+        Buffer* m_IndexBuffer;
+
+        // A region the size of the vertex buffer per frame in flight, so a patch never overwrites staging data
+        // an earlier frame's copy may still be reading.
+        Buffer* m_StagingBuffer;
+        std::uint32_t m_FramesInFlight;
+
+        // Quad range waiting for Upload, empty when begin == end.
+        std::uint32_t m_DirtyBegin;
+        std::uint32_t m_DirtyEnd;
+
+        std::uint32_t GetTextureIndex(Texture* texture);
+        void WriteQuad(std::uint32_t quad, const Rectangle& rect, const Vector3& colour, std::uint32_t textureIndex);
+
+    public:
+        // Every quad sits on one layer, which orders the batch against Renderer2D's quads when depth testing.
+        StaticBatch(std::int32_t layer = 0);
+        ~StaticBatch();
+
+        StaticBatch(const StaticBatch&) = delete;
+        StaticBatch& operator=(const StaticBatch&) = delete;
+
+        // Only before Build. Returns the quad's index for later SetRectangle calls.
+        std::uint32_t AddRectangle(const Rectangle& rect, const Vector3& colour, Texture* texture);
+
+        // Creates the GPU buffers and uploads every quad.
+        void Build();
+
+        void SetRectangle(std::uint32_t quad, const Rectangle& rect, const Vector3& colour, Texture* texture);
+
+        // Records the copy into the frame's command buffer, so call it before the render pass begins, from
+        // Application::PreDraw. Never waits on the GPU, earlier frames still draw the old quads. Does nothing
+        // when no quads have changed.
+        void Upload(const FrameData& frameData);
+
+        void Draw(VkCommandBuffer cmdBuffer) const;
+
+        inline bool IsBuilt() const noexcept { return m_VertexBuffer != nullptr; }
+        inline std::uint32_t GetQuadCount() const noexcept { return static_cast<std::uint32_t>(m_Vertices.size() / 4); }
+        inline const std::vector<Texture*>& GetTextures() const noexcept { return m_Textures; }
+        inline std::int32_t GetLayer() const noexcept { return m_Layer; }
+
+        // Covers every quad ever added or set, it doesn't shrink when quads move inwards.
+        inline const Rectangle& GetBounds() const noexcept { return m_Bounds; }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -8,56 +8,81 @@
 #include "WackyEngine/Core/Window.h"
 #include "WackyEngine/Core/Device.h"
 #include "WackyEngine/Graphics/RenderPass.h"
+#include "WackyEngine/Graphics/RenderTarget.h"
 
 namespace WackyEngine
 {
-    class SwapChain
+    class SwapChain : public RenderTarget
     {
     private:
         VkSwapchainKHR m_SwapChain;
 
         std::uint32_t m_CurrentFrame = 0;
+        std::uint32_t m_FramesInFlight;
 
         std::vector<VkImage> m_Images;
         std::vector<VkImageView> m_ImageViews;
         std::vector<VkFramebuffer> m_Framebuffers;
 
+        // One depth image shared by every swap chain image, the render pass orders its reuse between frames.
+        VkFormat m_DepthFormat;
+        VkImage m_DepthImage = VK_NULL_HANDLE;
+        VkDeviceMemory m_DepthMemory = VK_NULL_HANDLE;
+        VkImageView m_DepthImageView = VK_NULL_HANDLE;
+
         RenderPass* m_RenderPass;
 
         VkSurfaceFormatKHR m_Format;
         VkPresentModeKHR m_PresentMode;
         VkExtent2D m_Extent;
+        bool m_CanReadBack = false;
+
+        VkPresentModeKHR m_PreferredPresentMode;
+        std::uint32_t m_PreferredImageCount;
 
         std::vector<VkSemaphore> m_ImageAvailableSemaphores;
         std::vector<VkSemaphore> m_RenderCompleteSemaphores;
-        std::vector<VkFence> m_InFlightFences;
+        std::vector<std::uint64_t> m_FrameTimelineValues;
 
-        void CreateSwapchain();
+        void CreateSwapchain(VkSwapchainKHR oldSwapchain);
+        std::uint32_t SelectImageCount(const VkSurfaceCapabilitiesKHR& capabilities) const noexcept;
 
         void InitialiseImageViews();
+        void InitialiseDepthResources();
         void InitialiseFramebuffers();
         void InitialiseSyncObjects();
 
     public:
-        static const int MAX_FRAMES_IN_FLIGHT;
-
         SwapChain();
-        ~SwapChain();
+        ~SwapChain() override;
 
         void Initialise();
-        void Reinitialise();
+        void Reinitialise() override;
+
+        // Both recreate the swap chain, call between frames.
+        void SetPresentMode(VkPresentModeKHR presentMode);
+        void SetImageCount(std::uint32_t imageCount);
 
-        VkResult AcquireNextImage(std::uint32_t& imageIndex);
-        VkResult SubmitCommandBuffers(const VkCommandBuffer buffer, const std::uint32_t imageIndex);
+        VkResult AcquireNextImage(std::uint32_t& imageIndex) override;
+        VkResult SubmitCommandBuffers(const VkCommandBuffer buffer, const std::uint32_t imageIndex) override;
 
         inline VkSwapchainKHR GetSwapchainObject() const noexcept { return m_SwapChain; }
-        inline std::vector<VkImage> GetImages() const noexcept { return m_Images; }
-        inline std::vector<VkImageView> GetImageViews() const noexcept { return m_ImageViews; }
+        inline std::uint32_t GetCurrentFrame() const noexcept override { return m_CurrentFrame; }
+        inline std::uint32_t GetFramesInFlight() const noexcept override { return m_FramesInFlight; }
+        inline const std::vector<VkImage>& GetImages() const noexcept { return m_Images; }
+        inline const std::vector<VkImageView>& GetImageViews() const noexcept { return m_ImageViews; }
         inline VkSurfaceFormatKHR GetFormat() const noexcept { return m_Format; }
         inline VkPresentModeKHR GetPresentMode() const noexcept { return m_PresentMode; }
-        inline VkExtent2D GetExtent() const noexcept { return m_Extent; }
-        inline std::vector<VkFramebuffer> GetFramebuffers() const noexcept { return m_Framebuffers; }
-        inline RenderPass* GetRenderPass() const noexcept { return m_RenderPass; }
+        inline VkPresentModeKHR GetPreferredPresentMode() const noexcept { return m_PreferredPresentMode; }
+        inline VkExtent2D GetExtent() const noexcept override { return m_Extent; }
+        inline VkFormat GetDepthFormat() const noexcept { return m_DepthFormat; }
+        inline VkImageView GetDepthImageView() const noexcept { return m_DepthImageView; }
+        inline const std::vector<VkFramebuffer>& GetFramebuffers() const noexcept override { return m_Framebuffers; }
+        inline RenderPass* GetRenderPass() const noexcept override { return m_RenderPass; }
+        inline VkImage GetImage(std::uint32_t imageIndex) const noexcept override { return m_Images[imageIndex]; }
+        inline VkFormat GetColourFormat() const noexcept override { return m_Format.format; }
+        inline bool CanReadBack() const noexcept override { return m_CanReadBack; }
+        inline std::uint64_t GetFrameValue(std::uint32_t frameIndex) const noexcept override { return m_FrameTimelineValues[frameIndex]; }
     };
 }
 
@@ -1,6 +1,8 @@
 #ifndef WACKYENGINE_MATH_CALCULATOR_H_
 #define WACKYENGINE_MATH_CALCULATOR_H_
 
+#include <cmath>
+
 namespace WackyEngine
 {
     class Calculator
@@ -27,9 +29,55 @@ namespace WackyEngine
         static constexpr float RadiansToDegrees(float);
         static float WrapAngle(float);
         static float WrapAngle180(float);
-        static float Lerp(float, float, float);
+        static constexpr float Lerp(float, float, float);
         static constexpr float Clamp(const float, const float, const float);
     };
+
+    constexpr float Calculator::DegreesToRadians(float angle)
+    {
+        return angle * Pi / 180.0f;
+    }
+
+    constexpr float Calculator::RadiansToDegrees(float angle)
+    {
+        return angle * 180.0f / Pi;
+    }
+
+    inline float Calculator::WrapAngle(float angle)
+    {
+        return angle - (std::floor(angle / 360.0f) * 360.0f);
+    }
+
+    inline float Calculator::WrapAngle180(float angle)
+    {
+        float wrappedAngle = WrapAngle(angle);
+
+        if (wrappedAngle > 180.0f)
+        {
+            wrappedAngle = -(360.0f - wrappedAngle);
+        }
+
+        return wrappedAngle;
+    }
+
+    constexpr float Calculator::Lerp(float a, float b, float t)
+    {
+        return (1.0f - t) * a + t * b;
+    }
+
+    constexpr float Calculator::Clamp(const float value, const float lower, const float upper)
+    {
+        if (value < lower)
+        {
+            return lower;
+        }
+        else if (value > upper)
+        {
+            return upper;
+        }
+
+        return value;
+    }
 }
 
 #endif
\ No newline at end of file
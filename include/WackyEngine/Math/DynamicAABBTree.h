@@ -0,0 +1,239 @@
+#ifndef WACKYENGINE_MATH_DYNAMICAABBTREE_H_
+#define WACKYENGINE_MATH_DYNAMICAABBTREE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "WackyEngine/Math/Rectangle.h"
+#include "WackyEngine/Math/Vector2.h"
+
+namespace WackyEngine
+{
+    // Broadphase over Rectangles. Leaves store their bounds padded by a margin so objects can move a little without
+    // touching the tree, and the tree is kept height balanced with AVL style rotations. Proxies are node indices and
+    // stay valid until removed.
+    class DynamicAABBTree
+    {
+    public:
+        static constexpr std::int32_t NULL_NODE = -1;
+
+    private:
+        // Depth first traversal pushes at most one entry per level, and a balanced tree never gets near this tall.
+        static constexpr std::uint32_t STACK_SIZE = 128;
+
+        // Pair traversal leaves at most two entries behind per step down either side. Past this it spills into
+        // a vector, which only a badly unbalanced tree would need.
+        static constexpr std::uint32_t PAIR_STACK_SIZE = 512;
+
+        struct Node
+        {
+            Rectangle Bounds;
+            std::uint64_t UserData;
+
+            // Parent while in the tree, next free node while on the free list.
+            std::int32_t Parent;
+            std::int32_t Child1;
+            std::int32_t Child2;
+
+            // Leaves are 0, free nodes are -1.
+            std::int32_t Height;
+
+            inline bool IsLeaf() const noexcept { return Child1 == NULL_NODE; }
+        };
+
+        std::vector<Node> m_Nodes;
+        std::int32_t m_Root;
+        std::int32_t m_FreeList;
+        std::uint32_t m_ProxyCount;
+        int m_Margin;
+
+        std::int32_t AllocateNode();
+        void FreeNode(std::int32_t node);
+
+        void InsertLeaf(std::int32_t leaf);
+        void RemoveLeaf(std::int32_t leaf);
+        std::int32_t Balance(std::int32_t node);
+
+        static Rectangle Combine(const Rectangle& firstRect, const Rectangle& secondRect) noexcept;
+        static std::int64_t GetPerimeter(const Rectangle& rect) noexcept;
+
+        // Same test as Rectangle::Intersects, kept here so traversal doesn't call out of line for every node.
+        static inline bool Overlaps(const Rectangle& firstRect, const Rectangle& secondRect) noexcept
+        {
+            return (firstRect.X < secondRect.X + secondRect.Width) && (secondRect.X < firstRect.X + firstRect.Width) &&
+                   (firstRect.Y < secondRect.Y + secondRect.Height) && (secondRect.Y < firstRect.Y + firstRect.Height);
+        }
+
+        template<typename Test, typename Callback>
+        void Traverse(Test&& test, Callback&& callback) const;
+
+    public:
+        DynamicAABBTree(int margin = 4);
+
+        std::int32_t Insert(const Rectangle& bounds, std::uint64_t userData = 0);
+        void Remove(std::int32_t proxy);
+
+        // Returns true if the proxy had to be reinserted. Displacement stretches the padded bounds in the direction
+        // of travel so fast movers don't reinsert every frame.
+        bool Move(std::int32_t proxy, const Rectangle& bounds, const Vector2& displacement = Vector2::Zero);
+
+        void Clear() noexcept;
+
+        // Callbacks take the proxy (or pair of proxies) and return false to stop early. Results are tested against
+        // the padded bounds, so callers wanting exact overlaps should check their own rectangles.
+        template<typename Callback>
+        void Query(const Rectangle& region, Callback&& callback) const;
+
+        template<typename Callback>
+        void Query(const Vector2& point, Callback&& callback) const;
+
+        // Every overlapping pair once, lower proxy first.
+        template<typename Callback>
+        void QueryPairs(Callback&& callback) const;
+
+        std::int32_t GetHeight() const noexcept;
+
+        inline const Rectangle& GetFatBounds(std::int32_t proxy) const noexcept { return m_Nodes[proxy].Bounds; }
+        inline std::uint64_t GetUserData(std::int32_t proxy) const noexcept { return m_Nodes[proxy].UserData; }
+        inline std::uint32_t GetProxyCount() const noexcept { return m_ProxyCount; }
+    };
+
+    template<typename Test, typename Callback>
+    void DynamicAABBTree::Traverse(Test&& test, Callback&& callback) const
+    {
+        if (m_Root == NULL_NODE)
+        {
+            return;
+        }
+
+        std::int32_t stack[STACK_SIZE];
+        std::uint32_t count = 0;
+
+        stack[count++] = m_Root;
+
+        while (count > 0)
+        {
+            const Node& node = m_Nodes[stack[--count]];
+
+            if (!test(node.Bounds))
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                if (!callback(static_cast<std::int32_t>(&node - m_Nodes.data())))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                stack[count++] = node.Child1;
+                stack[count++] = node.Child2;
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::Query(const Rectangle& region, Callback&& callback) const
+    {
+        Traverse([&region](const Rectangle& bounds) { return Overlaps(bounds, region); }, callback);
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::Query(const Vector2& point, Callback&& callback) const
+    {
+        Traverse([&point](const Rectangle& bounds) { return bounds.Contains(point); }, callback);
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::QueryPairs(Callback&& callback) const
+    {
+        if (m_Root == NULL_NODE)
+        {
+            return;
+        }
+
+        // Descends the tree against itself, so whole subtrees that can't touch are skipped together rather than
+        // running a separate query from the root for every leaf. The stack lives on the call stack, so steady
+        // state queries never allocate and concurrent const queries stay safe.
+        std::pair<std::int32_t, std::int32_t> stack[PAIR_STACK_SIZE];
+        std::uint32_t count = 0;
+        std::vector<std::pair<std::int32_t, std::int32_t>> overflow;
+
+        // Overflow only grows while the array is full and drains first, so together they stay one stack.
+        auto push = [&](std::int32_t first, std::int32_t second)
+        {
+            if (count < PAIR_STACK_SIZE)
+            {
+                stack[count++] = { first, second };
+            }
+            else
+            {
+                overflow.emplace_back(first, second);
+            }
+        };
+
+        push(m_Root, m_Root);
+
+        while (count > 0)
+        {
+            std::pair<std::int32_t, std::int32_t> entry;
+
+            if (!overflow.empty())
+            {
+                entry = overflow.back();
+                overflow.pop_back();
+            }
+            else
+            {
+                entry = stack[--count];
+            }
+
+            auto [indexA, indexB] = entry;
+
+            const Node& a = m_Nodes[indexA];
+            const Node& b = m_Nodes[indexB];
+
+            if (indexA == indexB)
+            {
+                if (!a.IsLeaf())
+                {
+                    push(a.Child1, a.Child1);
+                    push(a.Child2, a.Child2);
+                    push(a.Child1, a.Child2);
+                }
+
+                continue;
+            }
+
+            if (!Overlaps(a.Bounds, b.Bounds))
+            {
+                continue;
+            }
+
+            if (a.IsLeaf() && b.IsLeaf())
+            {
+                if (!callback(std::min(indexA, indexB), std::max(indexA, indexB)))
+                {
+                    return;
+                }
+            }
+            else if (b.IsLeaf() || (!a.IsLeaf() && GetPerimeter(a.Bounds) >= GetPerimeter(b.Bounds)))
+            {
+                push(a.Child1, indexB);
+                push(a.Child2, indexB);
+            }
+            else
+            {
+                push(indexA, b.Child1);
+                push(indexA, b.Child2);
+            }
+        }
+    }
+}
+
+#endif
\ No newline at end of file
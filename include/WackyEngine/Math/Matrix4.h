@@ -1,12 +1,14 @@
 #ifndef WACKYENGINE_MATH_MATRIX4_H_
 #define WACKYENGINE_MATH_MATRIX4_H_
 
+#include "WackyEngine/Math/SIMD.h"
 #include "WackyEngine/Math/Vector3.h"
 #include "WackyEngine/Math/Vector4.h"
 
 namespace WackyEngine
 {
-    class Matrix4
+    // Stored column-major, each column is one aligned SIMD register.
+    class alignas(16) Matrix4
     {
     public:
         // float M11, M12, M13, M14,
@@ -22,27 +24,30 @@ namespace WackyEngine
         static const Matrix4 Zero;
         static const Matrix4 Identity;
 
-        Matrix4() noexcept;
-        Matrix4(const Matrix4& matrix);
-        Matrix4(const float m11, const float m12, const float m13, const float m14,
-                const float m21, const float m22, const float m23, const float m24,
-                const float m31, const float m32, const float m33, const float m34,
-                const float m41, const float m42, const float m43, const float m44) noexcept;
-        Matrix4(const Vector3& rightVector, const Vector3& upVector, const Vector3& forwardVector, const Vector3& translationVector) noexcept;
+        constexpr Matrix4() noexcept;
+        constexpr Matrix4(const Matrix4& matrix) noexcept = default;
+        constexpr Matrix4(const float m11, const float m12, const float m13, const float m14,
+                          const float m21, const float m22, const float m23, const float m24,
+                          const float m31, const float m32, const float m33, const float m34,
+                          const float m41, const float m42, const float m43, const float m44) noexcept;
+        constexpr Matrix4(const Vector3& rightVector, const Vector3& upVector, const Vector3& forwardVector, const Vector3& translationVector) noexcept;
 
         float GetDeterminant() const noexcept;
         Matrix4 GetInverse() const;
+
+        // Much cheaper than GetInverse, only valid when the bottom row is (0, 0, 0, 1), i.e. any mix of rotation, scale and translation.
+        Matrix4 GetAffineInverse() const;
         Matrix4 GetMinors() const;
         Matrix4 GetCofactors() const;
         Matrix4 GetAdjoint() const;
 
         void Transpose() noexcept;
-        void Add(const Matrix4& matrix) noexcept;
-        void Subtract(const Matrix4& matrix) noexcept;
-        void Multiply(const float scalar) noexcept;
+        constexpr void Add(const Matrix4& matrix) noexcept;
+        constexpr void Subtract(const Matrix4& matrix) noexcept;
+        constexpr void Multiply(const float scalar) noexcept;
         void Multiply(const Matrix4& matrix) noexcept;
-        void Divide(const float scalar);
-        bool Equals(const Matrix4& matrix) const noexcept;
+        constexpr void Divide(const float scalar);
+        constexpr bool Equals(const Matrix4& matrix) const noexcept;
         const std::vector<float> ToArray() const noexcept;
         std::string ToString() const noexcept;
         std::string ToStringInline() const noexcept;
@@ -50,26 +55,29 @@ namespace WackyEngine
         Vector3 Transform(const Vector3& vector) const noexcept;
         Vector4 Transform(const Vector4& vector) const noexcept;
 
-        void SetRight(const Vector3& rightVector) noexcept;
-        void SetUp(const Vector3& upVector) noexcept;
-        void SetForward(const Vector3& forwardVector) noexcept;
-        void SetTranslation(const Vector3& translationVector) noexcept;
-        void SetTranslation(const float translationX, const float translationY, const float translationZ) noexcept;
-        void SetScale(const float scale) noexcept;
-        void SetScale(const float scaleX, const float scaleY, const float scaleZ) noexcept;
+        inline const float* GetData() const noexcept { return &M11; }
+        inline float* GetData() noexcept { return &M11; }
+
+        constexpr void SetRight(const Vector3& rightVector) noexcept;
+        constexpr void SetUp(const Vector3& upVector) noexcept;
+        constexpr void SetForward(const Vector3& forwardVector) noexcept;
+        constexpr void SetTranslation(const Vector3& translationVector) noexcept;
+        constexpr void SetTranslation(const float translationX, const float translationY, const float translationZ) noexcept;
+        constexpr void SetScale(const float scale) noexcept;
+        constexpr void SetScale(const float scaleX, const float scaleY, const float scaleZ) noexcept;
         
-        Vector3 GetRight() const noexcept;
-        Vector3 GetUp() const noexcept;
-        Vector3 GetForward() const noexcept;
-        Vector3 GetTranslation() const noexcept;
-        Vector3 GetScale() const noexcept;
-
-        void operator+=(const Matrix4& matrix) noexcept;
-        void operator-=(const Matrix4& matrix) noexcept;
-        void operator*=(const float scalar) noexcept;
+        constexpr Vector3 GetRight() const noexcept;
+        constexpr Vector3 GetUp() const noexcept;
+        constexpr Vector3 GetForward() const noexcept;
+        constexpr Vector3 GetTranslation() const noexcept;
+        constexpr Vector3 GetScale() const noexcept;
+
+        constexpr void operator+=(const Matrix4& matrix) noexcept;
+        constexpr void operator-=(const Matrix4& matrix) noexcept;
+        constexpr void operator*=(const float scalar) noexcept;
         void operator*=(const Matrix4& matrix) noexcept;
-        void operator/=(const float scalar);
-        Matrix4 operator-() const noexcept;
+        constexpr void operator/=(const float scalar);
+        constexpr Matrix4 operator-() const noexcept;
 
         float operator[](int index) const;
         float& operator[](int index);
@@ -96,15 +104,372 @@ namespace WackyEngine
         static Matrix4 CreateTranslation(const Vector3& translation) noexcept;
         static Matrix4 Lerp(const Matrix4& firstMatrix, const Matrix4& secondMatrix, const float t) noexcept;
     };
+
+    // Initialisers follow the column-major member order.
+    constexpr Matrix4::Matrix4() noexcept : M11(0), M21(0), M31(0), M41(0),
+                                            M12(0), M22(0), M32(0), M42(0),
+                                            M13(0), M23(0), M33(0), M43(0),
+                                            M14(0), M24(0), M34(0), M44(0)
+    {
+    }
+
+    constexpr Matrix4::Matrix4(const float m11, const float m12, const float m13, const float m14,
+                               const float m21, const float m22, const float m23, const float m24,
+                               const float m31, const float m32, const float m33, const float m34,
+                               const float m41, const float m42, const float m43, const float m44) noexcept :
+                               M11(m11), M21(m21), M31(m31), M41(m41),
+                               M12(m12), M22(m22), M32(m32), M42(m42),
+                               M13(m13), M23(m23), M33(m33), M43(m43),
+                               M14(m14), M24(m24), M34(m34), M44(m44)
+    {
+    }
+
+    constexpr Matrix4::Matrix4(const Vector3& rightVector, const Vector3& upVector, const Vector3& forwardVector, const Vector3& translationVector) noexcept
+      : M11(rightVector.X),       M21(rightVector.Y),       M31(rightVector.Z),       M41(0),
+        M12(upVector.X),          M22(upVector.Y),          M32(upVector.Z),          M42(0),
+        M13(forwardVector.X),     M23(forwardVector.Y),     M33(forwardVector.Z),     M43(0),
+        M14(translationVector.X), M24(translationVector.Y), M34(translationVector.Z), M44(1)
+    {
+    }
+
+    inline void Matrix4::Transpose() noexcept
+    {
+        float* data = GetData();
+
+        SIMD::Float4 column0 = SIMD::Load(data);
+        SIMD::Float4 column1 = SIMD::Load(data + 4);
+        SIMD::Float4 column2 = SIMD::Load(data + 8);
+        SIMD::Float4 column3 = SIMD::Load(data + 12);
+
+        SIMD::Transpose(column0, column1, column2, column3);
+
+        SIMD::Store(data, column0);
+        SIMD::Store(data + 4, column1);
+        SIMD::Store(data + 8, column2);
+        SIMD::Store(data + 12, column3);
+    }
+
+    constexpr void Matrix4::Add(const Matrix4& matrix) noexcept
+    {
+        M11 += matrix.M11;
+        M12 += matrix.M12;
+        M13 += matrix.M13;
+        M14 += matrix.M14;
+        M21 += matrix.M21;
+        M22 += matrix.M22;
+        M23 += matrix.M23;
+        M24 += matrix.M24;
+        M31 += matrix.M31;
+        M32 += matrix.M32;
+        M33 += matrix.M33;
+        M34 += matrix.M34;
+        M41 += matrix.M41;
+        M42 += matrix.M42;
+        M43 += matrix.M43;
+        M44 += matrix.M44;
+    }
+
+    constexpr void Matrix4::Subtract(const Matrix4& matrix) noexcept
+    {
+        M11 -= matrix.M11;
+        M12 -= matrix.M12;
+        M13 -= matrix.M13;
+        M14 -= matrix.M14;
+        M21 -= matrix.M21;
+        M22 -= matrix.M22;
+        M23 -= matrix.M23;
+        M24 -= matrix.M24;
+        M31 -= matrix.M31;
+        M32 -= matrix.M32;
+        M33 -= matrix.M33;
+        M34 -= matrix.M34;
+        M41 -= matrix.M41;
+        M42 -= matrix.M42;
+        M43 -= matrix.M43;
+        M44 -= matrix.M44;
+    }
+
+    constexpr void Matrix4::Multiply(const float scalar) noexcept
+    {
+        M11 *= scalar;
+        M12 *= scalar;
+        M13 *= scalar;
+        M14 *= scalar;
+        M21 *= scalar;
+        M22 *= scalar;
+        M23 *= scalar;
+        M24 *= scalar;
+        M31 *= scalar;
+        M32 *= scalar;
+        M33 *= scalar;
+        M34 *= scalar;
+        M41 *= scalar;
+        M42 *= scalar;
+        M43 *= scalar;
+        M44 *= scalar;
+    }
+
+    inline void Matrix4::Multiply(const Matrix4& matrix) noexcept
+    {
+        // Column j of the product is this matrix's columns weighted by column j of the other.
+        const float* other = matrix.GetData();
+        float* data = GetData();
+
+        SIMD::Float4 column0 = SIMD::Load(data);
+        SIMD::Float4 column1 = SIMD::Load(data + 4);
+        SIMD::Float4 column2 = SIMD::Load(data + 8);
+        SIMD::Float4 column3 = SIMD::Load(data + 12);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            SIMD::Float4 weights = SIMD::Load(other + i * 4);
+
+            SIMD::Float4 result = SIMD::Multiply(column0, SIMD::SplatLane<0>(weights));
+            result = SIMD::MultiplyAdd(column1, SIMD::SplatLane<1>(weights), result);
+            result = SIMD::MultiplyAdd(column2, SIMD::SplatLane<2>(weights), result);
+            result = SIMD::MultiplyAdd(column3, SIMD::SplatLane<3>(weights), result);
+
+            SIMD::Store(data + i * 4, result);
+        }
+    }
+
+    constexpr void Matrix4::Divide(const float scalar)
+    {
+        if (scalar == 0)
+        {
+            throw std::string("Matrix4::Divide: Divisor cannot be zero.");
+        }
+
+        M11 /= scalar;
+        M12 /= scalar;
+        M13 /= scalar;
+        M14 /= scalar;
+        M21 /= scalar;
+        M22 /= scalar;
+        M23 /= scalar;
+        M24 /= scalar;
+        M31 /= scalar;
+        M32 /= scalar;
+        M33 /= scalar;
+        M34 /= scalar;
+        M41 /= scalar;
+        M42 /= scalar;
+        M43 /= scalar;
+        M44 /= scalar;
+    }
+
+    constexpr bool Matrix4::Equals(const Matrix4& matrix) const noexcept
+    {
+        return M11 == matrix.M11 && M12 == matrix.M12 && M13 == matrix.M13 && M14 == matrix.M14 &&
+               M21 == matrix.M21 && M22 == matrix.M22 && M23 == matrix.M23 && M24 == matrix.M24 &&
+               M31 == matrix.M31 && M32 == matrix.M32 && M33 == matrix.M33 && M34 == matrix.M34 &&
+               M41 == matrix.M41 && M42 == matrix.M42 && M43 == matrix.M43 && M44 == matrix.M44;
+    }
+
+    inline Vector3 Matrix4::Transform(const Vector3& vector) const noexcept
+    {
+        const float* data = GetData();
+        alignas(16) float result[4];
+
+        SIMD::Float4 point = SIMD::Load(data + 12);
+        point = SIMD::MultiplyAdd(SIMD::Load(data), SIMD::Splat(vector.X), point);
+        point = SIMD::MultiplyAdd(SIMD::Load(data + 4), SIMD::Splat(vector.Y), point);
+        point = SIMD::MultiplyAdd(SIMD::Load(data + 8), SIMD::Splat(vector.Z), point);
+        SIMD::Store(result, point);
+
+        return Vector3(result[0], result[1], result[2]);
+    }
+
+    inline Vector4 Matrix4::Transform(const Vector4& vector) const noexcept
+    {
+        const float* data = GetData();
+        alignas(16) float result[4];
+
+        SIMD::Float4 point = SIMD::Multiply(SIMD::Load(data), SIMD::Splat(vector.X));
+        point = SIMD::MultiplyAdd(SIMD::Load(data + 4), SIMD::Splat(vector.Y), point);
+        point = SIMD::MultiplyAdd(SIMD::Load(data + 8), SIMD::Splat(vector.Z), point);
+        point = SIMD::MultiplyAdd(SIMD::Load(data + 12), SIMD::Splat(vector.W), point);
+        SIMD::Store(result, point);
+
+        return Vector4(result[0], result[1], result[2], result[3]);
+    }
+
+    constexpr void Matrix4::SetRight(const Vector3& rightVector) noexcept
+    {
+        M11 = rightVector.X;
+        M21 = rightVector.Y;
+        M31 = rightVector.Z;
+    }
+
+    constexpr void Matrix4::SetUp(const Vector3& upVector) noexcept
+    {
+        M12 = upVector.X;
+        M22 = upVector.Y;
+        M32 = upVector.Z;
+    }
+
+    constexpr void Matrix4::SetForward(const Vector3& forwardVector) noexcept
+    {
+        M13 = forwardVector.X;
+        M23 = forwardVector.Y;
+        M33 = forwardVector.Z;
+    }
+
+    constexpr void Matrix4::SetTranslation(const Vector3& translationVector) noexcept
+    {
+        M14 = translationVector.X;
+        M24 = translationVector.Y;
+        M34 = translationVector.Z;
+    }
+
+    constexpr void Matrix4::SetTranslation(const float translationX, const float translationY, const float translationZ) noexcept
+    {
+        M14 = translationX;
+        M24 = translationY;
+        M34 = translationZ;
+    }
+
+    constexpr void Matrix4::SetScale(const float scale) noexcept
+    {
+        M11 = scale;
+        M22 = scale;
+        M33 = scale;
+    }
+
+    constexpr void Matrix4::SetScale(const float scaleX, const float scaleY, const float scaleZ) noexcept
+    {
+        M11 = scaleX;
+        M22 = scaleY;
+        M33 = scaleZ;
+    }
+
+    constexpr Vector3 Matrix4::GetRight() const noexcept
+    {
+        return Vector3(M11, M21, M31);
+    }
+
+    constexpr Vector3 Matrix4::GetUp() const noexcept
+    {
+        return Vector3(M12, M22, M32);
+    }
+
+    constexpr Vector3 Matrix4::GetForward() const noexcept
+    {
+        return Vector3(M13, M23, M33);
+    }
+
+    constexpr Vector3 Matrix4::GetTranslation() const noexcept
+    {
+        return Vector3(M14, M24, M34);
+    }
+
+    constexpr Vector3 Matrix4::GetScale() const noexcept
+    {
+        return Vector3(M11, M22, M33);
+    }
+
+    constexpr void Matrix4::operator+=(const Matrix4& matrix) noexcept
+    {
+        Add(matrix);
+    }
+
+    constexpr void Matrix4::operator-=(const Matrix4& matrix) noexcept
+    {
+        Subtract(matrix);
+    }
+
+    constexpr void Matrix4::operator*=(const float scalar) noexcept
+    {
+        Multiply(scalar);
+    }
+
+    inline void Matrix4::operator*=(const Matrix4& matrix) noexcept
+    {
+        Multiply(matrix);
+    }
+
+    constexpr void Matrix4::operator/=(const float scalar)
+    {
+        Divide(scalar);
+    }
+
+    constexpr Matrix4 Matrix4::operator-() const noexcept
+    {
+        Matrix4 matrix = Matrix4(*this);
+        matrix.Multiply(-1);
+        return matrix;
+    }
+
+    inline constexpr Matrix4 Matrix4::Zero = Matrix4(0, 0, 0, 0, 
+                                                     0, 0, 0, 0, 
+                                                     0, 0, 0, 0, 
+                                                     0, 0, 0, 0);
+
+    inline constexpr Matrix4 Matrix4::Identity = Matrix4(1, 0, 0, 0, 
+                                                         0, 1, 0, 0, 
+                                                         0, 0, 1, 0, 
+                                                         0, 0, 0, 1);
+}
+
+constexpr WackyEngine::Matrix4 operator+(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept
+{
+    WackyEngine::Matrix4 matrix(firstMatrix);
+    matrix.Add(secondMatrix);
+    return matrix;
+}
+
+constexpr WackyEngine::Matrix4 operator-(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept
+{
+    WackyEngine::Matrix4 matrix(firstMatrix);
+    matrix.Subtract(secondMatrix);
+    return matrix;
+}
+
+constexpr WackyEngine::Matrix4 operator*(const WackyEngine::Matrix4& matrix, const float scalar) noexcept
+{
+    WackyEngine::Matrix4 mat(matrix);
+    mat.Multiply(scalar);
+    return mat;
+}
+
+inline WackyEngine::Matrix4 operator*(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept
+{
+    WackyEngine::Matrix4 matrix(firstMatrix);
+    matrix.Multiply(secondMatrix);
+    return matrix;
+}
+
+constexpr WackyEngine::Matrix4 operator/(const WackyEngine::Matrix4& matrix, const float scalar) noexcept
+{
+    WackyEngine::Matrix4 mat(matrix);
+    mat.Divide(scalar);
+    return mat;
+}
+
+constexpr bool operator==(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept
+{
+    return firstMatrix.M11 == secondMatrix.M11 && firstMatrix.M12 == secondMatrix.M12 &&
+           firstMatrix.M13 == secondMatrix.M13 && firstMatrix.M14 == secondMatrix.M14 &&
+           firstMatrix.M21 == secondMatrix.M21 && firstMatrix.M22 == secondMatrix.M22 &&
+           firstMatrix.M23 == secondMatrix.M23 && firstMatrix.M24 == secondMatrix.M24 &&
+           firstMatrix.M31 == secondMatrix.M31 && firstMatrix.M32 == secondMatrix.M32 &&
+           firstMatrix.M33 == secondMatrix.M33 && firstMatrix.M34 == secondMatrix.M34 &&
+           firstMatrix.M41 == secondMatrix.M41 && firstMatrix.M42 == secondMatrix.M42 &&
+           firstMatrix.M43 == secondMatrix.M43 && firstMatrix.M44 == secondMatrix.M44;
+}
+
+constexpr bool operator!=(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept
+{
+    return firstMatrix.M11 != secondMatrix.M11 || firstMatrix.M12 != secondMatrix.M12 ||
+           firstMatrix.M13 != secondMatrix.M13 || firstMatrix.M14 != secondMatrix.M14 ||
+           firstMatrix.M21 != secondMatrix.M21 || firstMatrix.M22 != secondMatrix.M22 ||
+           firstMatrix.M23 != secondMatrix.M23 || firstMatrix.M24 != secondMatrix.M24 ||
+           firstMatrix.M31 != secondMatrix.M31 || firstMatrix.M32 != secondMatrix.M32 ||
+           firstMatrix.M33 != secondMatrix.M33 || firstMatrix.M34 != secondMatrix.M34 ||
+           firstMatrix.M41 != secondMatrix.M41 || firstMatrix.M42 != secondMatrix.M42 ||
+           firstMatrix.M43 != secondMatrix.M43 || firstMatrix.M44 != secondMatrix.M44;
 }
 
-WackyEngine::Matrix4 operator+(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept;
-WackyEngine::Matrix4 operator-(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept;
-WackyEngine::Matrix4 operator*(const WackyEngine::Matrix4& matrix, const float scalar) noexcept;
-WackyEngine::Matrix4 operator*(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept;
-WackyEngine::Matrix4 operator/(const WackyEngine::Matrix4& matrix, const float scalar) noexcept;
-bool operator==(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept;
-bool operator!=(const WackyEngine::Matrix4& firstMatrix, const WackyEngine::Matrix4& secondMatrix) noexcept;
 std::ostream& operator<<(std::ostream& cout, const WackyEngine::Matrix4& matrix);
 
 #endif
\ No newline at end of file
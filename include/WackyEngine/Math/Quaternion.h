@@ -0,0 +1,215 @@
+#ifndef WACKYENGINE_MATH_QUATERNION_H_
+#define WACKYENGINE_MATH_QUATERNION_H_
+
+#include <cmath>
+#include <string>
+#include <iostream>
+
+#include "WackyEngine/Math/SIMD.h"
+#include "WackyEngine/Math/Matrix4.h"
+#include "WackyEngine/Math/Vector3.h"
+
+namespace WackyEngine
+{
+    // Rotation quaternion, X/Y/Z is the vector part and W the scalar part. Aligned so it loads as one SIMD register.
+    class alignas(16) Quaternion
+    {
+    public:
+        float X;
+        float Y;
+        float Z;
+        float W;
+
+        static const Quaternion Identity;
+
+        constexpr Quaternion(const float x, const float y, const float z, const float w) noexcept;
+        constexpr Quaternion(const Vector3& vector, const float w) noexcept;
+        constexpr Quaternion() noexcept;
+
+        constexpr float Dot(const Quaternion& quaternion) const noexcept;
+        constexpr float LengthSquared() const noexcept;
+        float Length() const noexcept;
+        void Normalise() noexcept;
+
+        constexpr Quaternion GetConjugate() const noexcept;
+        constexpr Quaternion GetInverse() const;
+
+        // this * quaternion, so the given rotation is applied first.
+        constexpr void Multiply(const Quaternion& quaternion) noexcept;
+        constexpr Vector3 Rotate(const Vector3& vector) const noexcept;
+
+        // Expects a unit quaternion.
+        constexpr Matrix4 ToMatrix4() const noexcept;
+
+        std::string ToString() const noexcept;
+
+        constexpr void operator*=(const Quaternion& quaternion) noexcept;
+
+        static Quaternion CreateFromAxisAngle(const Vector3& axis, const float angle) noexcept;
+
+        // Normalised linear interpolation. Not constant velocity, but much cheaper and fine for small steps.
+        static Quaternion Nlerp(const Quaternion& firstQuaternion, const Quaternion& secondQuaternion, const float t) noexcept;
+        static Quaternion Slerp(const Quaternion& firstQuaternion, const Quaternion& secondQuaternion, const float t) noexcept;
+    };
+
+    constexpr Quaternion::Quaternion(const float x, const float y, const float z, const float w) noexcept : X(x), Y(y), Z(z), W(w)
+    {
+    }
+
+    constexpr Quaternion::Quaternion(const Vector3& vector, const float w) noexcept : X(vector.X), Y(vector.Y), Z(vector.Z), W(w)
+    {
+    }
+
+    constexpr Quaternion::Quaternion() noexcept : X(0), Y(0), Z(0), W(1)
+    {
+    }
+
+    constexpr float Quaternion::Dot(const Quaternion& quaternion) const noexcept
+    {
+        return X * quaternion.X + Y * quaternion.Y + Z * quaternion.Z + W * quaternion.W;
+    }
+
+    constexpr float Quaternion::LengthSquared() const noexcept
+    {
+        return Dot(*this);
+    }
+
+    inline float Quaternion::Length() const noexcept
+    {
+        return std::sqrt(LengthSquared());
+    }
+
+    inline void Quaternion::Normalise() noexcept
+    {
+        float length = Length();
+
+        if (length != 0)
+        {
+            SIMD::Store(&X, SIMD::Multiply(SIMD::Load(&X), SIMD::Splat(1.0f / length)));
+        }
+    }
+
+    constexpr Quaternion Quaternion::GetConjugate() const noexcept
+    {
+        return Quaternion(-X, -Y, -Z, W);
+    }
+
+    constexpr Quaternion Quaternion::GetInverse() const
+    {
+        float lengthSquared = LengthSquared();
+
+        if (lengthSquared == 0)
+        {
+            throw std::string("Quaternion::GetInverse(): Quaternion is not invertible as its length is zero.");
+        }
+
+        float inverseLength = 1.0f / lengthSquared;
+
+        return Quaternion(-X * inverseLength, -Y * inverseLength, -Z * inverseLength, W * inverseLength);
+    }
+
+    constexpr void Quaternion::Multiply(const Quaternion& quaternion) noexcept
+    {
+        Quaternion original = *this;
+
+        X = original.W * quaternion.X + original.X * quaternion.W + original.Y * quaternion.Z - original.Z * quaternion.Y;
+        Y = original.W * quaternion.Y - original.X * quaternion.Z + original.Y * quaternion.W + original.Z * quaternion.X;
+        Z = original.W * quaternion.Z + original.X * quaternion.Y - original.Y * quaternion.X + original.Z * quaternion.W;
+        W = original.W * quaternion.W - original.X * quaternion.X - original.Y * quaternion.Y - original.Z * quaternion.Z;
+    }
+
+    constexpr Vector3 Quaternion::Rotate(const Vector3& vector) const noexcept
+    {
+        // v + 2w(q x v) + 2q x (q x v), avoids building the full sandwich product.
+        Vector3 axis(X, Y, Z);
+        Vector3 t = axis.Cross(vector) * 2.0f;
+
+        return vector + t * W + axis.Cross(t);
+    }
+
+    constexpr Matrix4 Quaternion::ToMatrix4() const noexcept
+    {
+        float xx = X * X, yy = Y * Y, zz = Z * Z;
+        float xy = X * Y, xz = X * Z, yz = Y * Z;
+        float wx = W * X, wy = W * Y, wz = W * Z;
+
+        return Matrix4(1 - 2 * (yy + zz), 2 * (xy - wz),     2 * (xz + wy),     0,
+                       2 * (xy + wz),     1 - 2 * (xx + zz), 2 * (yz - wx),     0,
+                       2 * (xz - wy),     2 * (yz + wx),     1 - 2 * (xx + yy), 0,
+                       0,                 0,                 0,                 1);
+    }
+
+    inline std::string Quaternion::ToString() const noexcept
+    {
+        return "Quaternion[X: " + std::to_string(X) + ", Y: " + std::to_string(Y) + ", Z: " + std::to_string(Z) + ", W: " + std::to_string(W) + "]";
+    }
+
+    constexpr void Quaternion::operator*=(const Quaternion& quaternion) noexcept
+    {
+        Multiply(quaternion);
+    }
+
+    inline Quaternion Quaternion::CreateFromAxisAngle(const Vector3& axis, const float angle) noexcept
+    {
+        float halfAngle = angle * 0.5f;
+        return Quaternion(axis * std::sin(halfAngle), std::cos(halfAngle));
+    }
+
+    inline Quaternion Quaternion::Nlerp(const Quaternion& firstQuaternion, const Quaternion& secondQuaternion, const float t) noexcept
+    {
+        // Take the short way round, q and -q are the same rotation.
+        float secondWeight = firstQuaternion.Dot(secondQuaternion) < 0 ? -t : t;
+
+        Quaternion result;
+        SIMD::Store(&result.X, SIMD::MultiplyAdd(SIMD::Load(&firstQuaternion.X), SIMD::Splat(1.0f - t),
+                                                 SIMD::Multiply(SIMD::Load(&secondQuaternion.X), SIMD::Splat(secondWeight))));
+        result.Normalise();
+
+        return result;
+    }
+
+    inline Quaternion Quaternion::Slerp(const Quaternion& firstQuaternion, const Quaternion& secondQuaternion, const float t) noexcept
+    {
+        float cosTheta = firstQuaternion.Dot(secondQuaternion);
+        float sign = 1.0f;
+
+        if (cosTheta < 0)
+        {
+            cosTheta = -cosTheta;
+            sign = -1.0f;
+        }
+
+        // Nearly parallel, sin(theta) heads to zero so fall back to the linear blend.
+        if (cosTheta > 0.9995f)
+        {
+            return Nlerp(firstQuaternion, secondQuaternion, t);
+        }
+
+        float theta = std::acos(cosTheta);
+        float inverseSinTheta = 1.0f / std::sin(theta);
+        float firstWeight = std::sin((1.0f - t) * theta) * inverseSinTheta;
+        float secondWeight = std::sin(t * theta) * inverseSinTheta * sign;
+
+        Quaternion result;
+        SIMD::Store(&result.X, SIMD::MultiplyAdd(SIMD::Load(&firstQuaternion.X), SIMD::Splat(firstWeight),
+                                                 SIMD::Multiply(SIMD::Load(&secondQuaternion.X), SIMD::Splat(secondWeight))));
+
+        return result;
+    }
+
+    inline constexpr Quaternion Quaternion::Identity = Quaternion();
+}
+
+constexpr WackyEngine::Quaternion operator*(const WackyEngine::Quaternion& firstQuaternion, const WackyEngine::Quaternion& secondQuaternion) noexcept
+{
+    WackyEngine::Quaternion quaternion(firstQuaternion);
+    quaternion.Multiply(secondQuaternion);
+    return quaternion;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const WackyEngine::Quaternion& quaternion) noexcept
+{
+    return os << quaternion.ToString();
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,236 @@
+#ifndef WACKYENGINE_MATH_SIMD_H_
+#define WACKYENGINE_MATH_SIMD_H_
+
+#if defined(_MSC_VER)
+    #define WACKYENGINE_FORCEINLINE __forceinline
+#else
+    #define WACKYENGINE_FORCEINLINE inline __attribute__((always_inline))
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define WACKYENGINE_SIMD_SSE
+    #include <xmmintrin.h>
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define WACKYENGINE_SIMD_NEON
+    #include <arm_neon.h>
+#else
+    #define WACKYENGINE_SIMD_SCALAR
+#endif
+
+#if defined(__AVX__)
+    #define WACKYENGINE_SIMD_AVX
+    #include <immintrin.h>
+#endif
+
+#include <cstdint>
+
+namespace WackyEngine
+{
+    // Four wide float operations. Math code is written against these rather than intrinsics so it builds
+    // on SSE, AArch64 NEON, or falls back to plain floats everywhere else. Aligned loads and stores need 16 bytes.
+    namespace SIMD
+    {
+#if defined(WACKYENGINE_SIMD_SSE)
+        using Float4 = __m128;
+
+        WACKYENGINE_FORCEINLINE Float4 Load(const float* data) noexcept { return _mm_load_ps(data); }
+        WACKYENGINE_FORCEINLINE Float4 LoadUnaligned(const float* data) noexcept { return _mm_loadu_ps(data); }
+        WACKYENGINE_FORCEINLINE void Store(float* data, Float4 value) noexcept { _mm_store_ps(data, value); }
+        WACKYENGINE_FORCEINLINE void StoreUnaligned(float* data, Float4 value) noexcept { _mm_storeu_ps(data, value); }
+        WACKYENGINE_FORCEINLINE Float4 Set(float x, float y, float z, float w) noexcept { return _mm_setr_ps(x, y, z, w); }
+        WACKYENGINE_FORCEINLINE Float4 Splat(float value) noexcept { return _mm_set1_ps(value); }
+
+        WACKYENGINE_FORCEINLINE Float4 Add(Float4 a, Float4 b) noexcept { return _mm_add_ps(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Subtract(Float4 a, Float4 b) noexcept { return _mm_sub_ps(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Multiply(Float4 a, Float4 b) noexcept { return _mm_mul_ps(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Divide(Float4 a, Float4 b) noexcept { return _mm_div_ps(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Min(Float4 a, Float4 b) noexcept { return _mm_min_ps(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Max(Float4 a, Float4 b) noexcept { return _mm_max_ps(a, b); }
+
+        // a * b + c
+        WACKYENGINE_FORCEINLINE Float4 MultiplyAdd(Float4 a, Float4 b, Float4 c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+        template<int Lane>
+        WACKYENGINE_FORCEINLINE Float4 SplatLane(Float4 value) noexcept { return _mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane)); }
+
+        WACKYENGINE_FORCEINLINE void Transpose(Float4& row0, Float4& row1, Float4& row2, Float4& row3) noexcept { _MM_TRANSPOSE4_PS(row0, row1, row2, row3); }
+#elif defined(WACKYENGINE_SIMD_NEON)
+        using Float4 = float32x4_t;
+
+        WACKYENGINE_FORCEINLINE Float4 Load(const float* data) noexcept { return vld1q_f32(data); }
+        WACKYENGINE_FORCEINLINE Float4 LoadUnaligned(const float* data) noexcept { return vld1q_f32(data); }
+        WACKYENGINE_FORCEINLINE void Store(float* data, Float4 value) noexcept { vst1q_f32(data, value); }
+        WACKYENGINE_FORCEINLINE void StoreUnaligned(float* data, Float4 value) noexcept { vst1q_f32(data, value); }
+        WACKYENGINE_FORCEINLINE Float4 Set(float x, float y, float z, float w) noexcept { float data[4] = { x, y, z, w }; return vld1q_f32(data); }
+        WACKYENGINE_FORCEINLINE Float4 Splat(float value) noexcept { return vdupq_n_f32(value); }
+
+        WACKYENGINE_FORCEINLINE Float4 Add(Float4 a, Float4 b) noexcept { return vaddq_f32(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Subtract(Float4 a, Float4 b) noexcept { return vsubq_f32(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Multiply(Float4 a, Float4 b) noexcept { return vmulq_f32(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Divide(Float4 a, Float4 b) noexcept { return vdivq_f32(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Min(Float4 a, Float4 b) noexcept { return vminq_f32(a, b); }
+        WACKYENGINE_FORCEINLINE Float4 Max(Float4 a, Float4 b) noexcept { return vmaxq_f32(a, b); }
+
+        // a * b + c
+        WACKYENGINE_FORCEINLINE Float4 MultiplyAdd(Float4 a, Float4 b, Float4 c) noexcept { return vmlaq_f32(c, a, b); }
+
+        template<int Lane>
+        WACKYENGINE_FORCEINLINE Float4 SplatLane(Float4 value) noexcept { return vdupq_laneq_f32(value, Lane); }
+
+        WACKYENGINE_FORCEINLINE void Transpose(Float4& row0, Float4& row1, Float4& row2, Float4& row3) noexcept
+        {
+            float32x4x2_t upper = vtrnq_f32(row0, row1);
+            float32x4x2_t lower = vtrnq_f32(row2, row3);
+
+            row0 = vcombine_f32(vget_low_f32(upper.val[0]), vget_low_f32(lower.val[0]));
+            row1 = vcombine_f32(vget_low_f32(upper.val[1]), vget_low_f32(lower.val[1]));
+            row2 = vcombine_f32(vget_high_f32(upper.val[0]), vget_high_f32(lower.val[0]));
+            row3 = vcombine_f32(vget_high_f32(upper.val[1]), vget_high_f32(lower.val[1]));
+        }
+#else
+        struct Float4
+        {
+            float V[4];
+        };
+
+        WACKYENGINE_FORCEINLINE Float4 Load(const float* data) noexcept { return { data[0], data[1], data[2], data[3] }; }
+        WACKYENGINE_FORCEINLINE Float4 LoadUnaligned(const float* data) noexcept { return Load(data); }
+        WACKYENGINE_FORCEINLINE void Store(float* data, Float4 value) noexcept { data[0] = value.V[0]; data[1] = value.V[1]; data[2] = value.V[2]; data[3] = value.V[3]; }
+        WACKYENGINE_FORCEINLINE void StoreUnaligned(float* data, Float4 value) noexcept { Store(data, value); }
+        WACKYENGINE_FORCEINLINE Float4 Set(float x, float y, float z, float w) noexcept { return { x, y, z, w }; }
+        WACKYENGINE_FORCEINLINE Float4 Splat(float value) noexcept { return { value, value, value, value }; }
+
+        WACKYENGINE_FORCEINLINE Float4 Add(Float4 a, Float4 b) noexcept { return { a.V[0] + b.V[0], a.V[1] + b.V[1], a.V[2] + b.V[2], a.V[3] + b.V[3] }; }
+        WACKYENGINE_FORCEINLINE Float4 Subtract(Float4 a, Float4 b) noexcept { return { a.V[0] - b.V[0], a.V[1] - b.V[1], a.V[2] - b.V[2], a.V[3] - b.V[3] }; }
+        WACKYENGINE_FORCEINLINE Float4 Multiply(Float4 a, Float4 b) noexcept { return { a.V[0] * b.V[0], a.V[1] * b.V[1], a.V[2] * b.V[2], a.V[3] * b.V[3] }; }
+        WACKYENGINE_FORCEINLINE Float4 Divide(Float4 a, Float4 b) noexcept { return { a.V[0] / b.V[0], a.V[1] / b.V[1], a.V[2] / b.V[2], a.V[3] / b.V[3] }; }
+        WACKYENGINE_FORCEINLINE Float4 Min(Float4 a, Float4 b) noexcept { return { a.V[0] < b.V[0] ? a.V[0] : b.V[0], a.V[1] < b.V[1] ? a.V[1] : b.V[1], a.V[2] < b.V[2] ? a.V[2] : b.V[2], a.V[3] < b.V[3] ? a.V[3] : b.V[3] }; }
+        WACKYENGINE_FORCEINLINE Float4 Max(Float4 a, Float4 b) noexcept { return { a.V[0] > b.V[0] ? a.V[0] : b.V[0], a.V[1] > b.V[1] ? a.V[1] : b.V[1], a.V[2] > b.V[2] ? a.V[2] : b.V[2], a.V[3] > b.V[3] ? a.V[3] : b.V[3] }; }
+
+        // a * b + c
+        WACKYENGINE_FORCEINLINE Float4 MultiplyAdd(Float4 a, Float4 b, Float4 c) noexcept { return Add(Multiply(a, b), c); }
+
+        template<int Lane>
+        WACKYENGINE_FORCEINLINE Float4 SplatLane(Float4 value) noexcept { return Splat(value.V[Lane]); }
+
+        WACKYENGINE_FORCEINLINE void Transpose(Float4& row0, Float4& row1, Float4& row2, Float4& row3) noexcept
+        {
+            Float4 r0 = row0, r1 = row1, r2 = row2, r3 = row3;
+
+            row0 = { r0.V[0], r1.V[0], r2.V[0], r3.V[0] };
+            row1 = { r0.V[1], r1.V[1], r2.V[1], r3.V[1] };
+            row2 = { r0.V[2], r1.V[2], r2.V[2], r3.V[2] };
+            row3 = { r0.V[3], r1.V[3], r2.V[3], r3.V[3] };
+        }
+#endif
+
+        // Four wide 32-bit integer operations. Comparisons return all ones per passing lane, MoveMask packs the
+        // lanes' top bits into the low four bits of the result.
+#if defined(WACKYENGINE_SIMD_SSE)
+        using Int4 = __m128i;
+
+        WACKYENGINE_FORCEINLINE Int4 LoadIntUnaligned(const std::int32_t* data) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); }
+        WACKYENGINE_FORCEINLINE Int4 SplatInt(std::int32_t value) noexcept { return _mm_set1_epi32(value); }
+        WACKYENGINE_FORCEINLINE Int4 AddInt(Int4 a, Int4 b) noexcept { return _mm_add_epi32(a, b); }
+        WACKYENGINE_FORCEINLINE Int4 AndInt(Int4 a, Int4 b) noexcept { return _mm_and_si128(a, b); }
+        WACKYENGINE_FORCEINLINE Int4 LessThanInt(Int4 a, Int4 b) noexcept { return _mm_cmplt_epi32(a, b); }
+        WACKYENGINE_FORCEINLINE int MoveMaskInt(Int4 value) noexcept { return _mm_movemask_ps(_mm_castsi128_ps(value)); }
+
+        WACKYENGINE_FORCEINLINE void TransposeInt(Int4& row0, Int4& row1, Int4& row2, Int4& row3) noexcept
+        {
+            Int4 t0 = _mm_unpacklo_epi32(row0, row1);
+            Int4 t1 = _mm_unpacklo_epi32(row2, row3);
+            Int4 t2 = _mm_unpackhi_epi32(row0, row1);
+            Int4 t3 = _mm_unpackhi_epi32(row2, row3);
+
+            row0 = _mm_unpacklo_epi64(t0, t1);
+            row1 = _mm_unpackhi_epi64(t0, t1);
+            row2 = _mm_unpacklo_epi64(t2, t3);
+            row3 = _mm_unpackhi_epi64(t2, t3);
+        }
+#elif defined(WACKYENGINE_SIMD_NEON)
+        using Int4 = int32x4_t;
+
+        WACKYENGINE_FORCEINLINE Int4 LoadIntUnaligned(const std::int32_t* data) noexcept { return vld1q_s32(data); }
+        WACKYENGINE_FORCEINLINE Int4 SplatInt(std::int32_t value) noexcept { return vdupq_n_s32(value); }
+        WACKYENGINE_FORCEINLINE Int4 AddInt(Int4 a, Int4 b) noexcept { return vaddq_s32(a, b); }
+        WACKYENGINE_FORCEINLINE Int4 AndInt(Int4 a, Int4 b) noexcept { return vandq_s32(a, b); }
+        WACKYENGINE_FORCEINLINE Int4 LessThanInt(Int4 a, Int4 b) noexcept { return vreinterpretq_s32_u32(vcltq_s32(a, b)); }
+
+        WACKYENGINE_FORCEINLINE int MoveMaskInt(Int4 value) noexcept
+        {
+            static const std::int32_t shifts[4] = { 0, 1, 2, 3 };
+            uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_s32(value), 31);
+            return static_cast<int>(vaddvq_u32(vshlq_u32(bits, vld1q_s32(shifts))));
+        }
+
+        WACKYENGINE_FORCEINLINE void TransposeInt(Int4& row0, Int4& row1, Int4& row2, Int4& row3) noexcept
+        {
+            int32x4x2_t upper = vtrnq_s32(row0, row1);
+            int32x4x2_t lower = vtrnq_s32(row2, row3);
+
+            row0 = vcombine_s32(vget_low_s32(upper.val[0]), vget_low_s32(lower.val[0]));
+            row1 = vcombine_s32(vget_low_s32(upper.val[1]), vget_low_s32(lower.val[1]));
+            row2 = vcombine_s32(vget_high_s32(upper.val[0]), vget_high_s32(lower.val[0]));
+            row3 = vcombine_s32(vget_high_s32(upper.val[1]), vget_high_s32(lower.val[1]));
+        }
+#else
+        struct Int4
+        {
+            std::int32_t V[4];
+        };
+
+        WACKYENGINE_FORCEINLINE Int4 LoadIntUnaligned(const std::int32_t* data) noexcept { return { data[0], data[1], data[2], data[3] }; }
+        WACKYENGINE_FORCEINLINE Int4 SplatInt(std::int32_t value) noexcept { return { value, value, value, value }; }
+        WACKYENGINE_FORCEINLINE Int4 AddInt(Int4 a, Int4 b) noexcept { return { a.V[0] + b.V[0], a.V[1] + b.V[1], a.V[2] + b.V[2], a.V[3] + b.V[3] }; }
+        WACKYENGINE_FORCEINLINE Int4 AndInt(Int4 a, Int4 b) noexcept { return { a.V[0] & b.V[0], a.V[1] & b.V[1], a.V[2] & b.V[2], a.V[3] & b.V[3] }; }
+        WACKYENGINE_FORCEINLINE Int4 LessThanInt(Int4 a, Int4 b) noexcept { return { -(a.V[0] < b.V[0]), -(a.V[1] < b.V[1]), -(a.V[2] < b.V[2]), -(a.V[3] < b.V[3]) }; }
+        WACKYENGINE_FORCEINLINE int MoveMaskInt(Int4 value) noexcept 
+        {
+            return static_cast<int>((static_cast<std::uint32_t>(value.V[0]) >> 31) | ((static_cast<std::uint32_t>(value.V[1]) >> 31) << 1) |
+                                    ((static_cast<std::uint32_t>(value.V[2]) >> 31) << 2) | ((static_cast<std::uint32_t>(value.V[3]) >> 31) << 3));
+        }
+
+        WACKYENGINE_FORCEINLINE void TransposeInt(Int4& row0, Int4& row1, Int4& row2, Int4& row3) noexcept
+        {
+            Int4 r0 = row0, r1 = row1, r2 = row2, r3 = row3;
+
+            row0 = { r0.V[0], r1.V[0], r2.V[0], r3.V[0] };
+            row1 = { r0.V[1], r1.V[1], r2.V[1], r3.V[1] };
+            row2 = { r0.V[2], r1.V[2], r2.V[2], r3.V[2] };
+            row3 = { r0.V[3], r1.V[3], r2.V[3], r3.V[3] };
+        }
+#endif
+
+        // Widest register the target has, for batch kernels that stream over arrays. Loads and stores are unaligned.
+#if defined(WACKYENGINE_SIMD_AVX)
+        using FloatWide = __m256;
+        static constexpr int WIDE_LANES = 8;
+
+        WACKYENGINE_FORCEINLINE FloatWide LoadWide(const float* data) noexcept { return _mm256_loadu_ps(data); }
+        WACKYENGINE_FORCEINLINE void StoreWide(float* data, FloatWide value) noexcept { _mm256_storeu_ps(data, value); }
+        WACKYENGINE_FORCEINLINE FloatWide SplatWide(float value) noexcept { return _mm256_set1_ps(value); }
+        WACKYENGINE_FORCEINLINE FloatWide AddWide(FloatWide a, FloatWide b) noexcept { return _mm256_add_ps(a, b); }
+        WACKYENGINE_FORCEINLINE FloatWide MultiplyWide(FloatWide a, FloatWide b) noexcept { return _mm256_mul_ps(a, b); }
+
+    #if defined(__FMA__)
+        WACKYENGINE_FORCEINLINE FloatWide MultiplyAddWide(FloatWide a, FloatWide b, FloatWide c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+    #else
+        WACKYENGINE_FORCEINLINE FloatWide MultiplyAddWide(FloatWide a, FloatWide b, FloatWide c) noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+    #endif
+#else
+        using FloatWide = Float4;
+        static constexpr int WIDE_LANES = 4;
+
+        WACKYENGINE_FORCEINLINE FloatWide LoadWide(const float* data) noexcept { return LoadUnaligned(data); }
+        WACKYENGINE_FORCEINLINE void StoreWide(float* data, FloatWide value) noexcept { StoreUnaligned(data, value); }
+        WACKYENGINE_FORCEINLINE FloatWide SplatWide(float value) noexcept { return Splat(value); }
+        WACKYENGINE_FORCEINLINE FloatWide AddWide(FloatWide a, FloatWide b) noexcept { return Add(a, b); }
+        WACKYENGINE_FORCEINLINE FloatWide MultiplyWide(FloatWide a, FloatWide b) noexcept { return Multiply(a, b); }
+        WACKYENGINE_FORCEINLINE FloatWide MultiplyAddWide(FloatWide a, FloatWide b, FloatWide c) noexcept { return MultiplyAdd(a, b, c); }
+#endif
+    }
+}
+
+#endif
\ No newline at end of file
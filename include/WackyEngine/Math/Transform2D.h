@@ -0,0 +1,176 @@
+#ifndef WACKYENGINE_MATH_TRANSFORM2D_H_
+#define WACKYENGINE_MATH_TRANSFORM2D_H_
+
+#include <cmath>
+#include <string>
+
+#include "WackyEngine/Math/Matrix4.h"
+#include "WackyEngine/Math/Vector2.h"
+
+namespace WackyEngine
+{
+    // 2x3 affine transform for 2D, the implied bottom row is (0, 0, 1). Stored column-major like Matrix4,
+    // so 24 bytes rather than 64 and composing is 12 multiplies rather than 64.
+    class Transform2D
+    {
+    public:
+        float M11, M21,
+              M12, M22,
+              M13, M23;
+
+        static const Transform2D Identity;
+
+        constexpr Transform2D() noexcept;
+        constexpr Transform2D(const float m11, const float m12, const float m13,
+                              const float m21, const float m22, const float m23) noexcept;
+
+        constexpr float GetDeterminant() const noexcept;
+        constexpr Transform2D GetInverse() const;
+
+        // this * transform, so the given transform is applied first.
+        constexpr void Multiply(const Transform2D& transform) noexcept;
+
+        constexpr Vector2 TransformPoint(const Vector2& point) const noexcept;
+        constexpr Vector2 TransformDirection(const Vector2& direction) const noexcept;
+
+        constexpr Vector2 GetTranslation() const noexcept;
+        constexpr void SetTranslation(const Vector2& translation) noexcept;
+
+        constexpr Matrix4 ToMatrix4() const noexcept;
+
+        constexpr void operator*=(const Transform2D& transform) noexcept;
+
+        static constexpr Transform2D CreateTranslation(const Vector2& translation) noexcept;
+        static constexpr Transform2D CreateScale(const Vector2& scale) noexcept;
+        static Transform2D CreateRotation(const float angle) noexcept;
+
+        // Scale, then rotate, then translate, the usual sprite transform.
+        static Transform2D CreateTRS(const Vector2& translation, const float rotation, const Vector2& scale) noexcept;
+    };
+
+    constexpr Transform2D::Transform2D() noexcept : M11(1), M21(0),
+                                                    M12(0), M22(1),
+                                                    M13(0), M23(0)
+    {
+    }
+
+    constexpr Transform2D::Transform2D(const float m11, const float m12, const float m13,
+                                       const float m21, const float m22, const float m23) noexcept :
+                                       M11(m11), M21(m21),
+                                       M12(m12), M22(m22),
+                                       M13(m13), M23(m23)
+    {
+    }
+
+    constexpr float Transform2D::GetDeterminant() const noexcept
+    {
+        return M11 * M22 - M12 * M21;
+    }
+
+    constexpr Transform2D Transform2D::GetInverse() const
+    {
+        float determinant = GetDeterminant();
+
+        if (determinant == 0)
+        {
+            throw std::string("Transform2D::GetInverse(): Transform2D is not invertible as the determinant is zero.");
+        }
+
+        float inverseDeterminant = 1.0f / determinant;
+
+        float i11 = M22 * inverseDeterminant;
+        float i12 = -M12 * inverseDeterminant;
+        float i21 = -M21 * inverseDeterminant;
+        float i22 = M11 * inverseDeterminant;
+
+        return Transform2D(i11, i12, -(i11 * M13 + i12 * M23),
+                           i21, i22, -(i21 * M13 + i22 * M23));
+    }
+
+    constexpr void Transform2D::Multiply(const Transform2D& transform) noexcept
+    {
+        Transform2D original = *this;
+
+        M11 = original.M11 * transform.M11 + original.M12 * transform.M21;
+        M12 = original.M11 * transform.M12 + original.M12 * transform.M22;
+        M13 = original.M11 * transform.M13 + original.M12 * transform.M23 + original.M13;
+        M21 = original.M21 * transform.M11 + original.M22 * transform.M21;
+        M22 = original.M21 * transform.M12 + original.M22 * transform.M22;
+        M23 = original.M21 * transform.M13 + original.M22 * transform.M23 + original.M23;
+    }
+
+    constexpr Vector2 Transform2D::TransformPoint(const Vector2& point) const noexcept
+    {
+        return Vector2(M11 * point.X + M12 * point.Y + M13, M21 * point.X + M22 * point.Y + M23);
+    }
+
+    constexpr Vector2 Transform2D::TransformDirection(const Vector2& direction) const noexcept
+    {
+        return Vector2(M11 * direction.X + M12 * direction.Y, M21 * direction.X + M22 * direction.Y);
+    }
+
+    constexpr Vector2 Transform2D::GetTranslation() const noexcept
+    {
+        return Vector2(M13, M23);
+    }
+
+    constexpr void Transform2D::SetTranslation(const Vector2& translation) noexcept
+    {
+        M13 = translation.X;
+        M23 = translation.Y;
+    }
+
+    constexpr Matrix4 Transform2D::ToMatrix4() const noexcept
+    {
+        return Matrix4(M11, M12, 0, M13,
+                       M21, M22, 0, M23,
+                       0,   0,   1, 0,
+                       0,   0,   0, 1);
+    }
+
+    constexpr void Transform2D::operator*=(const Transform2D& transform) noexcept
+    {
+        Multiply(transform);
+    }
+
+    constexpr Transform2D Transform2D::CreateTranslation(const Vector2& translation) noexcept
+    {
+        return Transform2D(1, 0, translation.X,
+                           0, 1, translation.Y);
+    }
+
+    constexpr Transform2D Transform2D::CreateScale(const Vector2& scale) noexcept
+    {
+        return Transform2D(scale.X, 0,       0,
+                           0,       scale.Y, 0);
+    }
+
+    inline Transform2D Transform2D::CreateRotation(const float angle) noexcept
+    {
+        float cos = std::cos(angle);
+        float sin = std::sin(angle);
+
+        return Transform2D(cos, -sin, 0,
+                           sin, cos,  0);
+    }
+
+    inline Transform2D Transform2D::CreateTRS(const Vector2& translation, const float rotation, const Vector2& scale) noexcept
+    {
+        float cos = std::cos(rotation);
+        float sin = std::sin(rotation);
+
+        return Transform2D(cos * scale.X, -sin * scale.Y, translation.X,
+                           sin * scale.X, cos * scale.Y,  translation.Y);
+    }
+
+    inline constexpr Transform2D Transform2D::Identity = Transform2D();
+}
+
+constexpr WackyEngine::Transform2D operator*(const WackyEngine::Transform2D& firstTransform, const WackyEngine::Transform2D& secondTransform) noexcept
+{
+    WackyEngine::Transform2D transform(firstTransform);
+    transform.Multiply(secondTransform);
+    return transform;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef WACKYENGINE_MATH_TRANSFORMBATCH_H_
+#define WACKYENGINE_MATH_TRANSFORMBATCH_H_
+
+#include <span>
+
+#include "WackyEngine/Math/Matrix4.h"
+#include "WackyEngine/Math/Vector2.h"
+#include "WackyEngine/Math/Vector3.h"
+
+namespace WackyEngine
+{
+    // Transforms over structure-of-arrays data, each component in its own array. Processes as many lanes at once as
+    // the target allows (8 with AVX, 4 with SSE/NEON). Element count is taken from the first input, every other
+    // array must be at least as long. TransformPoints and TransformDirections write one output per input, so their
+    // outputs may alias the matching inputs. Nothing else may overlap.
+    class TransformBatch
+    {
+    public:
+        // Points take the translation, directions don't.
+        static void TransformPoints(const Matrix4& matrix, std::span<const float> x, std::span<const float> y,
+                                    std::span<float> outX, std::span<float> outY) noexcept;
+        static void TransformPoints(const Matrix4& matrix, std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                                    std::span<float> outX, std::span<float> outY, std::span<float> outZ) noexcept;
+
+        static void TransformDirections(const Matrix4& matrix, std::span<const float> x, std::span<const float> y,
+                                        std::span<float> outX, std::span<float> outY) noexcept;
+        static void TransformDirections(const Matrix4& matrix, std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                                        std::span<float> outX, std::span<float> outY, std::span<float> outZ) noexcept;
+
+        // Expands each rectangle into its four transformed corners. The outputs hold four planes of one corner
+        // per rectangle each, in the order top-left, top-right, bottom-right, bottom-left, so need 4 * count floats.
+        // Writing four outputs per input overwrites inputs not read yet, so no output may overlap any input.
+        static void TransformRects(const Matrix4& matrix, std::span<const float> x, std::span<const float> y,
+                                   std::span<const float> width, std::span<const float> height,
+                                   std::span<float> outX, std::span<float> outY) noexcept;
+
+        // Array-of-structures conversions.
+        static void ToSoA(std::span<const Vector2> vectors, std::span<float> x, std::span<float> y) noexcept;
+        static void ToSoA(std::span<const Vector3> vectors, std::span<float> x, std::span<float> y, std::span<float> z) noexcept;
+        static void ToAoS(std::span<const float> x, std::span<const float> y, std::span<Vector2> vectors) noexcept;
+        static void ToAoS(std::span<const float> x, std::span<const float> y, std::span<const float> z, std::span<Vector3> vectors) noexcept;
+    };
+}
+
+#endif
\ No newline at end of file
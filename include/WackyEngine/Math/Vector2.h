@@ -1,10 +1,14 @@
 #ifndef WACKYENGINE_MATH_VECTOR2_H_
 #define WACKYENGINE_MATH_VECTOR2_H_
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <string>
 #include <iostream>
 
+#include "WackyEngine/Math/SIMD.h"
+
 namespace WackyEngine
 {
     class Vector2
@@ -18,29 +22,29 @@ namespace WackyEngine
         static const Vector2 UnitX;
         static const Vector2 UnitY;
 
-        Vector2(const float x, const float y) noexcept;
-        Vector2(const float value) noexcept;
-        Vector2() noexcept;
+        constexpr Vector2(const float x, const float y) noexcept;
+        constexpr Vector2(const float value) noexcept;
+        constexpr Vector2() noexcept;
 
-        float Dot(const Vector2& vector) const noexcept;
+        constexpr float Dot(const Vector2& vector) const noexcept;
         float Magnitude() const noexcept;
         float Distance(const Vector2& vector) const noexcept;
-        float DistanceSquared(const Vector2& vector) const noexcept;
-        void Clamp(const Vector2& firstBound, const Vector2& secondBound) noexcept;
+        constexpr float DistanceSquared(const Vector2& vector) const noexcept;
+        constexpr void Clamp(const Vector2& firstBound, const Vector2& secondBound) noexcept;
         std::string ToString() const noexcept;
         const std::vector<float> ToStdVector() const noexcept;
 
         // Binary Operations
-        void Add(const Vector2& vector) noexcept;
-        void Subtract(const Vector2& vector) noexcept;
-        void Multiply(const float scalar) noexcept;
-        void Multiply(const Vector2& vector) noexcept;
-        void Divide(const float scalar);
-        void Divide(const Vector2& vector);
-        bool Equals(const Vector2& vector) const noexcept;
+        constexpr void Add(const Vector2& vector) noexcept;
+        constexpr void Subtract(const Vector2& vector) noexcept;
+        constexpr void Multiply(const float scalar) noexcept;
+        constexpr void Multiply(const Vector2& vector) noexcept;
+        constexpr void Divide(const float scalar);
+        constexpr void Divide(const Vector2& vector);
+        constexpr bool Equals(const Vector2& vector) const noexcept;
 
         // Unary Operations
-        void Negate() noexcept;
+        constexpr void Negate() noexcept;
         void Floor() noexcept;
         void Ceiling() noexcept;
         void Round() noexcept;
@@ -48,31 +52,297 @@ namespace WackyEngine
         void Normalise() noexcept;
 
         // Operators
-        void operator+=(const Vector2& vector) noexcept;
-        void operator-=(const Vector2& vector) noexcept;
-        void operator*=(const float scalar) noexcept;
-        void operator*=(const Vector2& vector) noexcept;
-        void operator/=(const float scalar);
-        void operator/=(const Vector2& vector);
-
-        Vector2 operator-() const noexcept;
-        float operator[](int index) const;
-        float& operator[](int index);
-
-        static Vector2 Max(const Vector2& firstVector, const Vector2& secondVector) noexcept;
-        static Vector2 Min(const Vector2& firstVector, const Vector2& secondVector) noexcept;
-        static Vector2 Lerp(const Vector2& firstVector, const Vector2& secondVector, const float t) noexcept;
+        constexpr void operator+=(const Vector2& vector) noexcept;
+        constexpr void operator-=(const Vector2& vector) noexcept;
+        constexpr void operator*=(const float scalar) noexcept;
+        constexpr void operator*=(const Vector2& vector) noexcept;
+        constexpr void operator/=(const float scalar);
+        constexpr void operator/=(const Vector2& vector);
+
+        constexpr Vector2 operator-() const noexcept;
+        constexpr float operator[](int index) const;
+        constexpr float& operator[](int index);
+
+        static constexpr Vector2 Max(const Vector2& firstVector, const Vector2& secondVector) noexcept;
+        static constexpr Vector2 Min(const Vector2& firstVector, const Vector2& secondVector) noexcept;
+        static constexpr Vector2 Lerp(const Vector2& firstVector, const Vector2& secondVector, const float t) noexcept;
     };
+
+    constexpr Vector2::Vector2(const float x, const float y) noexcept : X(x), Y(y)
+    {
+    }
+
+    constexpr Vector2::Vector2(const float value) noexcept : X(value), Y(value)
+    {
+    }
+
+    constexpr Vector2::Vector2() noexcept : X(0), Y(0)
+    {
+    }
+
+    constexpr float Vector2::Dot(const Vector2& vector) const noexcept
+    {
+        return (X * vector.X) + (Y * vector.Y);
+    }
+
+    inline float Vector2::Magnitude() const noexcept
+    {
+        return std::sqrt(Dot(*this));
+    }
+
+    inline float Vector2::Distance(const Vector2& vector) const noexcept
+    {
+        return std::sqrt(DistanceSquared(vector));
+    }
+
+    constexpr float Vector2::DistanceSquared(const Vector2& vector) const noexcept
+    {
+        return ((X - vector.X) * (X - vector.X)) + ((Y - vector.Y) * (Y - vector.Y));
+    }
+
+    constexpr void Vector2::Clamp(const Vector2& firstBound, const Vector2& secondBound) noexcept
+    {
+        X = std::clamp(X, std::min(firstBound.X, secondBound.X), std::max(firstBound.X, secondBound.X));
+        Y = std::clamp(Y, std::min(firstBound.Y, secondBound.Y), std::max(firstBound.Y, secondBound.Y));
+    }
+
+    inline std::string Vector2::ToString() const noexcept
+    {
+        return "Vector2[X: " + std::to_string(X) + ", Y: " + std::to_string(Y) + "]";
+    }
+
+    inline const std::vector<float> Vector2::ToStdVector() const noexcept
+    {
+        return { X, Y };
+    }
+
+    constexpr void Vector2::Add(const Vector2& vector) noexcept
+    {
+        X += vector.X;
+        Y += vector.Y;
+    }
+
+    constexpr void Vector2::Subtract(const Vector2& vector) noexcept
+    {
+        X -= vector.X;
+        Y -= vector.Y;
+    }
+
+    constexpr void Vector2::Multiply(const float scalar) noexcept
+    {
+        X *= scalar;
+        Y *= scalar;
+    }
+
+    constexpr void Vector2::Multiply(const Vector2& vector) noexcept
+    {
+        X *= vector.X;
+        Y *= vector.Y;
+    }
+
+    constexpr void Vector2::Divide(const float scalar)
+    {
+        if (scalar == 0)
+        {
+            throw std::string("Vector2::Divide: Divisor cannot be zero.");
+        }
+
+        X /= scalar;
+        Y /= scalar;
+    }
+
+    constexpr void Vector2::Divide(const Vector2& vector)
+    {
+        if (vector.X == 0 || vector.Y == 0)
+        {
+            throw std::string("Vector2::Divide: Divisor cannot be zero.");
+        }
+
+        X /= vector.X;
+        Y /= vector.Y;
+    }
+
+    constexpr bool Vector2::Equals(const Vector2& vector) const noexcept
+    {
+        return X == vector.X && Y == vector.Y;
+    }
+
+    constexpr void Vector2::Negate() noexcept
+    {
+        X = -X;
+        Y = -Y;
+    }
+
+    inline void Vector2::Floor() noexcept
+    {
+        X = std::floor(X);
+        Y = std::floor(Y);
+    }
+
+    inline void Vector2::Ceiling() noexcept
+    {
+        X = std::ceil(X);
+        Y = std::ceil(Y);
+    }
+
+    inline void Vector2::Round() noexcept
+    {
+        X = std::round(X);
+        Y = std::round(Y);
+    }
+
+    inline void Vector2::Abs() noexcept
+    {
+        X = std::abs(X);
+        Y = std::abs(Y);
+    }
+
+    inline void Vector2::Normalise() noexcept
+    {
+        float magnitude = Magnitude();
+
+        if (magnitude != 0)
+        {
+            X /= magnitude;
+            Y /= magnitude;
+        }
+    }
+
+    constexpr void Vector2::operator+=(const Vector2& vector) noexcept
+    {
+        Add(vector);
+    }
+
+    constexpr void Vector2::operator-=(const Vector2& vector) noexcept
+    {
+        Subtract(vector);
+    }
+
+    constexpr void Vector2::operator*=(const float scalar) noexcept
+    {
+        Multiply(scalar);
+    }
+
+    constexpr void Vector2::operator*=(const Vector2& vector) noexcept
+    {
+        Multiply(vector);
+    }
+
+    constexpr void Vector2::operator/=(const float scalar)
+    {
+        Divide(scalar);
+    }
+
+    constexpr void Vector2::operator/=(const Vector2& vector)
+    {
+        Divide(vector);
+    }
+
+    constexpr Vector2 Vector2::operator-() const noexcept
+    {
+        return Vector2(-X, -Y);
+    }
+
+    constexpr float Vector2::operator[](int index) const
+    {
+        switch (index)
+        {
+        case 0:
+            return X;
+        case 1:
+            return Y;
+        default:
+            throw std::string("Vector2::operator[]: Index out of bounds of Vector2.");
+        }
+    }
+
+    constexpr float& Vector2::operator[](int index)
+    {
+        switch (index)
+        {
+        case 0:
+            return X;
+        case 1:
+            return Y;
+        default:
+            throw std::string("Vector2::operator[]: Index out of bounds of Vector2.");
+        }
+    }
+
+    constexpr Vector2 Vector2::Max(const Vector2& firstVector, const Vector2& secondVector) noexcept
+    {
+        return Vector2(std::max(firstVector.X, secondVector.X), std::max(firstVector.Y, secondVector.Y));
+    }
+
+    constexpr Vector2 Vector2::Min(const Vector2& firstVector, const Vector2& secondVector) noexcept
+    {
+        return Vector2(std::min(firstVector.X, secondVector.X), std::min(firstVector.Y, secondVector.Y));
+    }
+
+    constexpr Vector2 Vector2::Lerp(const Vector2& firstVector, const Vector2& secondVector, const float t) noexcept
+    {
+        return Vector2(firstVector.X + (secondVector.X - firstVector.X) * t, firstVector.Y + (secondVector.Y - firstVector.Y) * t);
+    }
+
+    inline constexpr Vector2 Vector2::Zero = Vector2(0, 0);
+    inline constexpr Vector2 Vector2::One = Vector2(1, 1);
+    inline constexpr Vector2 Vector2::UnitX = Vector2(1, 0);
+    inline constexpr Vector2 Vector2::UnitY = Vector2(0, 1);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector2 operator+(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept
+{
+    return WackyEngine::Vector2(firstVector.X + secondVector.X, firstVector.Y + secondVector.Y);
 }
 
-WackyEngine::Vector2 operator+(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept;
-WackyEngine::Vector2 operator-(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept;
-WackyEngine::Vector2 operator*(const WackyEngine::Vector2& vector, const float scalar) noexcept;
-WackyEngine::Vector2 operator*(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept;
-WackyEngine::Vector2 operator/(const WackyEngine::Vector2& vector, const float scalar);
-WackyEngine::Vector2 operator/(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector);
-bool operator==(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept;
-bool operator!=(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept;
-std::ostream& operator<<(std::ostream& os, const WackyEngine::Vector2& vector) noexcept;
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector2 operator-(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept
+{
+    return WackyEngine::Vector2(firstVector.X - secondVector.X, firstVector.Y - secondVector.Y);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector2 operator*(const WackyEngine::Vector2& vector, const float scalar) noexcept
+{
+    return WackyEngine::Vector2(vector.X * scalar, vector.Y * scalar);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector2 operator*(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept
+{
+    return WackyEngine::Vector2(firstVector.X * secondVector.X, firstVector.Y * secondVector.Y);
+}
+
+constexpr WackyEngine::Vector2 operator/(const WackyEngine::Vector2& vector, const float scalar)
+{
+    if (scalar == 0)
+    {
+        throw std::string("Vector2 Division by zero.");
+    }
+
+    return WackyEngine::Vector2(vector.X / scalar, vector.Y / scalar);
+}
+
+constexpr WackyEngine::Vector2 operator/(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector)
+{
+    if (secondVector.X == 0 || secondVector.Y == 0)
+    {
+        throw std::string("Vector2 Division by zero.");
+    }
+
+    return WackyEngine::Vector2(firstVector.X / secondVector.X, firstVector.Y / secondVector.Y);
+}
+
+constexpr bool operator==(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept
+{
+    return firstVector.X == secondVector.X && firstVector.Y == secondVector.Y;
+}
+
+constexpr bool operator!=(const WackyEngine::Vector2& firstVector, const WackyEngine::Vector2& secondVector) noexcept
+{
+    return firstVector.X != secondVector.X || firstVector.Y != secondVector.Y;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const WackyEngine::Vector2& vector) noexcept
+{
+    return os << vector.ToString();
+}
 
 #endif
\ No newline at end of file
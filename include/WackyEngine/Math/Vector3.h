@@ -1,10 +1,13 @@
 #ifndef WACKYENGINE_MATH_VECTOR3_H_
 #define WACKYENGINE_MATH_VECTOR3_H_
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <string>
 #include <iostream>
 
+#include "WackyEngine/Math/SIMD.h"
 #include "WackyEngine/Math/Vector2.h"
 
 namespace WackyEngine
@@ -22,31 +25,31 @@ namespace WackyEngine
         static const Vector3 UnitY;
         static const Vector3 UnitZ;
 
-        Vector3(const float x, const float y, const float z) noexcept;
-        Vector3(const Vector2& vector, const float z) noexcept;
-        Vector3(const float value) noexcept;
-        Vector3() noexcept;
+        constexpr Vector3(const float x, const float y, const float z) noexcept;
+        constexpr Vector3(const Vector2& vector, const float z) noexcept;
+        constexpr Vector3(const float value) noexcept;
+        constexpr Vector3() noexcept;
 
-        float Dot(const Vector3& vector) const noexcept;
-        Vector3 Cross(const Vector3& vector) const noexcept;
+        constexpr float Dot(const Vector3& vector) const noexcept;
+        constexpr Vector3 Cross(const Vector3& vector) const noexcept;
         float Magnitude() const noexcept;
         float Distance(const Vector3& vector) const noexcept;
-        float DistanceSquared(const Vector3& vector) const noexcept;
-        void Clamp(const Vector3& firstBound, const Vector3& secondBound) noexcept;
+        constexpr float DistanceSquared(const Vector3& vector) const noexcept;
+        constexpr void Clamp(const Vector3& firstBound, const Vector3& secondBound) noexcept;
         std::string ToString() const noexcept;
         const std::vector<float> ToStdVector() const noexcept;
 
         // Binary Operations
-        void Add(const Vector3& vector) noexcept;
-        void Subtract(const Vector3& vector) noexcept;
-        void Multiply(const float scalar) noexcept;
-        void Multiply(const Vector3& vector) noexcept;
-        void Divide(const float scalar);
-        void Divide(const Vector3& vector);
-        bool Equals(const Vector3& vector) const noexcept;
+        constexpr void Add(const Vector3& vector) noexcept;
+        constexpr void Subtract(const Vector3& vector) noexcept;
+        constexpr void Multiply(const float scalar) noexcept;
+        constexpr void Multiply(const Vector3& vector) noexcept;
+        constexpr void Divide(const float scalar);
+        constexpr void Divide(const Vector3& vector);
+        constexpr bool Equals(const Vector3& vector) const noexcept;
 
         // Unary Operations
-        void Negate() noexcept;
+        constexpr void Negate() noexcept;
         void Floor() noexcept;
         void Ceiling() noexcept;
         void Round() noexcept;
@@ -54,31 +57,324 @@ namespace WackyEngine
         void Normalise() noexcept;
 
         // Operators
-        void operator+=(const Vector3& vector) noexcept;
-        void operator-=(const Vector3& vector) noexcept;
-        void operator*=(const float scalar) noexcept;
-        void operator*=(const Vector3& vector) noexcept;
-        void operator/=(const float scalar);
-        void operator/=(const Vector3& vector);
-
-        Vector3 operator-() const noexcept;
-        float operator[](int index) const;
-        float& operator[](int index);
-
-        static Vector3 Max(const Vector3& firstVector, const Vector3& secondVector) noexcept;
-        static Vector3 Min(const Vector3& firstVector, const Vector3& secondVector) noexcept;
-        static Vector3 Lerp(const Vector3& firstVector, const Vector3& secondVector, const float t) noexcept;
+        constexpr void operator+=(const Vector3& vector) noexcept;
+        constexpr void operator-=(const Vector3& vector) noexcept;
+        constexpr void operator*=(const float scalar) noexcept;
+        constexpr void operator*=(const Vector3& vector) noexcept;
+        constexpr void operator/=(const float scalar);
+        constexpr void operator/=(const Vector3& vector);
+
+        constexpr Vector3 operator-() const noexcept;
+        constexpr float operator[](int index) const;
+        constexpr float& operator[](int index);
+
+        static constexpr Vector3 Max(const Vector3& firstVector, const Vector3& secondVector) noexcept;
+        static constexpr Vector3 Min(const Vector3& firstVector, const Vector3& secondVector) noexcept;
+        static constexpr Vector3 Lerp(const Vector3& firstVector, const Vector3& secondVector, const float t) noexcept;
     };
+
+    constexpr Vector3::Vector3(const float x, const float y, const float z) noexcept : X(x), Y(y), Z(z)
+    {
+    }
+
+    constexpr Vector3::Vector3(const Vector2& vector, const float z) noexcept : X(vector.X), Y(vector.Y), Z(z)
+    {
+    }
+
+    constexpr Vector3::Vector3(const float value) noexcept : X(value), Y(value), Z(value)
+    {
+    }
+
+    constexpr Vector3::Vector3() noexcept : X(0), Y(0), Z(0)
+    {
+    }
+
+    constexpr float Vector3::Dot(const Vector3& vector) const noexcept
+    {
+        return (X * vector.X) + (Y * vector.Y) + (Z * vector.Z);
+    }
+
+    constexpr Vector3 Vector3::Cross(const Vector3& vector) const noexcept
+    {
+        return Vector3(Y * vector.Z - Z * vector.Y, Z * vector.X - X * vector.Z, X * vector.Y - Y * vector.X);
+    }
+
+    inline float Vector3::Magnitude() const noexcept
+    {
+        return std::sqrt(Dot(*this));
+    }
+
+    inline float Vector3::Distance(const Vector3& vector) const noexcept
+    {
+        return std::sqrt(DistanceSquared(vector));
+    }
+
+    constexpr float Vector3::DistanceSquared(const Vector3& vector) const noexcept
+    {
+        return ((X - vector.X) * (X - vector.X)) + ((Y - vector.Y) * (Y - vector.Y)) + ((Z - vector.Z) * (Z - vector.Z));
+    }
+
+    constexpr void Vector3::Clamp(const Vector3& firstBound, const Vector3& secondBound) noexcept
+    {
+        X = std::clamp(X, std::min(firstBound.X, secondBound.X), std::max(firstBound.X, secondBound.X));
+        Y = std::clamp(Y, std::min(firstBound.Y, secondBound.Y), std::max(firstBound.Y, secondBound.Y));
+        Z = std::clamp(Z, std::min(firstBound.Z, secondBound.Z), std::max(firstBound.Z, secondBound.Z));
+    }
+
+    inline std::string Vector3::ToString() const noexcept
+    {
+        return "Vector3[X: " + std::to_string(X) + ", Y: " + std::to_string(Y) + ", Z: " + std::to_string(Z) + "]";
+    }
+
+    inline const std::vector<float> Vector3::ToStdVector() const noexcept
+    {
+        return { X, Y, Z };
+    }
+
+    constexpr void Vector3::Add(const Vector3& vector) noexcept
+    {
+        X += vector.X;
+        Y += vector.Y;
+        Z += vector.Z;
+    }
+
+    constexpr void Vector3::Subtract(const Vector3& vector) noexcept
+    {
+        X -= vector.X;
+        Y -= vector.Y;
+        Z -= vector.Z;
+    }
+
+    constexpr void Vector3::Multiply(const float scalar) noexcept
+    {
+        X *= scalar;
+        Y *= scalar;
+        Z *= scalar;
+    }
+
+    constexpr void Vector3::Multiply(const Vector3& vector) noexcept
+    {
+        X *= vector.X;
+        Y *= vector.Y;
+        Z *= vector.Z;
+    }
+
+    constexpr void Vector3::Divide(const float scalar)
+    {
+        if (scalar == 0)
+        {
+            throw std::string("Vector3::Divide: Divisor cannot be zero.");
+        }
+
+        X /= scalar;
+        Y /= scalar;
+        Z /= scalar;
+    }
+
+    constexpr void Vector3::Divide(const Vector3& vector)
+    {
+        if (vector.X == 0 || vector.Y == 0 || vector.Z == 0)
+        {
+            throw std::string("Vector3::Divide: Divisor cannot be zero.");
+        }
+
+        X /= vector.X;
+        Y /= vector.Y;
+        Z /= vector.Z;
+    }
+
+    constexpr bool Vector3::Equals(const Vector3& vector) const noexcept
+    {
+        return X == vector.X && Y == vector.Y && Z == vector.Z;
+    }
+
+    constexpr void Vector3::Negate() noexcept
+    {
+        X = -X;
+        Y = -Y;
+        Z = -Z;
+    }
+
+    inline void Vector3::Floor() noexcept
+    {
+        X = std::floor(X);
+        Y = std::floor(Y);
+        Z = std::floor(Z);
+    }
+
+    inline void Vector3::Ceiling() noexcept
+    {
+        X = std::ceil(X);
+        Y = std::ceil(Y);
+        Z = std::ceil(Z);
+    }
+
+    inline void Vector3::Round() noexcept
+    {
+        X = std::round(X);
+        Y = std::round(Y);
+        Z = std::round(Z);
+    }
+
+    inline void Vector3::Abs() noexcept
+    {
+        X = std::abs(X);
+        Y = std::abs(Y);
+        Z = std::abs(Z);
+    }
+
+    inline void Vector3::Normalise() noexcept
+    {
+        float magnitude = Magnitude();
+
+        if (magnitude != 0)
+        {
+            X /= magnitude;
+            Y /= magnitude;
+            Z /= magnitude;
+        }
+    }
+
+    constexpr void Vector3::operator+=(const Vector3& vector) noexcept
+    {
+        Add(vector);
+    }
+
+    constexpr void Vector3::operator-=(const Vector3& vector) noexcept
+    {
+        Subtract(vector);
+    }
+
+    constexpr void Vector3::operator*=(const float scalar) noexcept
+    {
+        Multiply(scalar);
+    }
+
+    constexpr void Vector3::operator*=(const Vector3& vector) noexcept
+    {
+        Multiply(vector);
+    }
+
+    constexpr void Vector3::operator/=(const float scalar)
+    {
+        Divide(scalar);
+    }
+
+    constexpr void Vector3::operator/=(const Vector3& vector)
+    {
+        Divide(vector);
+    }
+
+    constexpr Vector3 Vector3::operator-() const noexcept
+    {
+        return Vector3(-X, -Y, -Z);
+    }
+
+    constexpr float Vector3::operator[](int index) const
+    {
+        switch (index)
+        {
+        case 0:
+            return X;
+        case 1:
+            return Y;
+        case 2:
+            return Z;
+        default:
+            throw std::string("Vector3::operator[]: Index out of bounds of Vector3.");
+        }
+    }
+
+    constexpr float& Vector3::operator[](int index)
+    {
+        switch (index)
+        {
+        case 0:
+            return X;
+        case 1:
+            return Y;
+        case 2:
+            return Z;
+        default:
+            throw std::string("Vector3::operator[]: Index out of bounds of Vector3.");
+        }
+    }
+
+    constexpr Vector3 Vector3::Max(const Vector3& firstVector, const Vector3& secondVector) noexcept
+    {
+        return Vector3(std::max(firstVector.X, secondVector.X), std::max(firstVector.Y, secondVector.Y), std::max(firstVector.Z, secondVector.Z));
+    }
+
+    constexpr Vector3 Vector3::Min(const Vector3& firstVector, const Vector3& secondVector) noexcept
+    {
+        return Vector3(std::min(firstVector.X, secondVector.X), std::min(firstVector.Y, secondVector.Y), std::min(firstVector.Z, secondVector.Z));
+    }
+
+    constexpr Vector3 Vector3::Lerp(const Vector3& firstVector, const Vector3& secondVector, const float t) noexcept
+    {
+        return Vector3(firstVector.X + (secondVector.X - firstVector.X) * t, firstVector.Y + (secondVector.Y - firstVector.Y) * t, firstVector.Z + (secondVector.Z - firstVector.Z) * t);
+    }
+
+    inline constexpr Vector3 Vector3::Zero = Vector3(0, 0, 0);
+    inline constexpr Vector3 Vector3::One = Vector3(1, 1, 1);
+    inline constexpr Vector3 Vector3::UnitX = Vector3(1, 0, 0);
+    inline constexpr Vector3 Vector3::UnitY = Vector3(0, 1, 0);
+    inline constexpr Vector3 Vector3::UnitZ = Vector3(0, 0, 1);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector3 operator+(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept
+{
+    return WackyEngine::Vector3(firstVector.X + secondVector.X, firstVector.Y + secondVector.Y, firstVector.Z + secondVector.Z);
 }
 
-WackyEngine::Vector3 operator+(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept;
-WackyEngine::Vector3 operator-(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept;
-WackyEngine::Vector3 operator*(const WackyEngine::Vector3& vector, const float scalar) noexcept;
-WackyEngine::Vector3 operator*(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept;
-WackyEngine::Vector3 operator/(const WackyEngine::Vector3& vector, const float scalar);
-WackyEngine::Vector3 operator/(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector);
-bool operator==(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept;
-bool operator!=(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept;
-std::ostream& operator<<(std::ostream& os, const WackyEngine::Vector3& vector) noexcept;
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector3 operator-(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept
+{
+    return WackyEngine::Vector3(firstVector.X - secondVector.X, firstVector.Y - secondVector.Y, firstVector.Z - secondVector.Z);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector3 operator*(const WackyEngine::Vector3& vector, const float scalar) noexcept
+{
+    return WackyEngine::Vector3(vector.X * scalar, vector.Y * scalar, vector.Z * scalar);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector3 operator*(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept
+{
+    return WackyEngine::Vector3(firstVector.X * secondVector.X, firstVector.Y * secondVector.Y, firstVector.Z * secondVector.Z);
+}
+
+constexpr WackyEngine::Vector3 operator/(const WackyEngine::Vector3& vector, const float scalar)
+{
+    if (scalar == 0)
+    {
+        throw std::string("Vector3 Division by zero.");
+    }
+
+    return WackyEngine::Vector3(vector.X / scalar, vector.Y / scalar, vector.Z / scalar);
+}
+
+constexpr WackyEngine::Vector3 operator/(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector)
+{
+    if (secondVector.X == 0 || secondVector.Y == 0 || secondVector.Z == 0)
+    {
+        throw std::string("Vector3 Division by zero.");
+    }
+
+    return WackyEngine::Vector3(firstVector.X / secondVector.X, firstVector.Y / secondVector.Y, firstVector.Z / secondVector.Z);
+}
+
+constexpr bool operator==(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept
+{
+    return firstVector.X == secondVector.X && firstVector.Y == secondVector.Y && firstVector.Z == secondVector.Z;
+}
+
+constexpr bool operator!=(const WackyEngine::Vector3& firstVector, const WackyEngine::Vector3& secondVector) noexcept
+{
+    return firstVector.X != secondVector.X || firstVector.Y != secondVector.Y || firstVector.Z != secondVector.Z;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const WackyEngine::Vector3& vector) noexcept
+{
+    return os << vector.ToString();
+}
 
 #endif
\ No newline at end of file
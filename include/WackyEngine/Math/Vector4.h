@@ -1,10 +1,13 @@
 #ifndef WACKYENGINE_MATH_VECTOR4_H_
 #define WACKYENGINE_MATH_VECTOR4_H_
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <string>
 #include <iostream>
 
+#include "WackyEngine/Math/SIMD.h"
 #include "WackyEngine/Math/Vector2.h"
 #include "WackyEngine/Math/Vector3.h"
 
@@ -25,31 +28,31 @@ namespace WackyEngine
         static const Vector4 UnitZ;
         static const Vector4 UnitW;
 
-        Vector4(const float x, const float y, const float z, const float w) noexcept;
-        Vector4(const Vector2& vector, const float z, const float w) noexcept;
-        Vector4(const Vector3& vector, const float w) noexcept;
-        Vector4(const float value) noexcept;
-        Vector4() noexcept;
+        constexpr Vector4(const float x, const float y, const float z, const float w) noexcept;
+        constexpr Vector4(const Vector2& vector, const float z, const float w) noexcept;
+        constexpr Vector4(const Vector3& vector, const float w) noexcept;
+        constexpr Vector4(const float value) noexcept;
+        constexpr Vector4() noexcept;
 
-        float Dot(const Vector4& vector) const noexcept;
+        constexpr float Dot(const Vector4& vector) const noexcept;
         float Magnitude() const noexcept;
         float Distance(const Vector4& vector) const noexcept;
-        float DistanceSquared(const Vector4& vector) const noexcept;
-        void Clamp(const Vector4& firstBound, const Vector4& secondBound) noexcept;
+        constexpr float DistanceSquared(const Vector4& vector) const noexcept;
+        constexpr void Clamp(const Vector4& firstBound, const Vector4& secondBound) noexcept;
         std::string ToString() const noexcept;
         const std::vector<float> ToStdVector() const noexcept;
 
         // Binary Operations
-        void Add(const Vector4& vector) noexcept;
-        void Subtract(const Vector4& vector) noexcept;
-        void Multiply(const float scalar) noexcept;
-        void Multiply(const Vector4& vector) noexcept;
-        void Divide(const float scalar);
-        void Divide(const Vector4& vector);
-        bool Equals(const Vector4& vector) const noexcept;
+        constexpr void Add(const Vector4& vector) noexcept;
+        constexpr void Subtract(const Vector4& vector) noexcept;
+        constexpr void Multiply(const float scalar) noexcept;
+        constexpr void Multiply(const Vector4& vector) noexcept;
+        constexpr void Divide(const float scalar);
+        constexpr void Divide(const Vector4& vector);
+        constexpr bool Equals(const Vector4& vector) const noexcept;
 
         // Unary Operations
-        void Negate() noexcept;
+        constexpr void Negate() noexcept;
         void Floor() noexcept;
         void Ceiling() noexcept;
         void Round() noexcept;
@@ -57,31 +60,341 @@ namespace WackyEngine
         void Normalise() noexcept;
 
         // Operators
-        void operator+=(const Vector4& vector) noexcept;
-        void operator-=(const Vector4& vector) noexcept;
-        void operator*=(const float scalar) noexcept;
-        void operator*=(const Vector4& vector) noexcept;
-        void operator/=(const float scalar);
-        void operator/=(const Vector4& vector);
-
-        Vector4 operator-() const noexcept;
-        float operator[](int index) const;
-        float& operator[](int index);
-
-        static Vector4 Max(const Vector4& firstVector, const Vector4& secondVector) noexcept;
-        static Vector4 Min(const Vector4& firstVector, const Vector4& secondVector) noexcept;
-        static Vector4 Lerp(const Vector4& firstVector, const Vector4& secondVector, const float t) noexcept;
+        constexpr void operator+=(const Vector4& vector) noexcept;
+        constexpr void operator-=(const Vector4& vector) noexcept;
+        constexpr void operator*=(const float scalar) noexcept;
+        constexpr void operator*=(const Vector4& vector) noexcept;
+        constexpr void operator/=(const float scalar);
+        constexpr void operator/=(const Vector4& vector);
+
+        constexpr Vector4 operator-() const noexcept;
+        constexpr float operator[](int index) const;
+        constexpr float& operator[](int index);
+
+        static constexpr Vector4 Max(const Vector4& firstVector, const Vector4& secondVector) noexcept;
+        static constexpr Vector4 Min(const Vector4& firstVector, const Vector4& secondVector) noexcept;
+        static constexpr Vector4 Lerp(const Vector4& firstVector, const Vector4& secondVector, const float t) noexcept;
     };
+
+    constexpr Vector4::Vector4(const float x, const float y, const float z, const float w) noexcept : X(x), Y(y), Z(z), W(w)
+    {
+    }
+
+    constexpr Vector4::Vector4(const Vector2& vector, const float z, const float w) noexcept : X(vector.X), Y(vector.Y), Z(z), W(w)
+    {
+    }
+
+    constexpr Vector4::Vector4(const Vector3& vector, const float w) noexcept : X(vector.X), Y(vector.Y), Z(vector.Z), W(w)
+    {
+    }
+
+    constexpr Vector4::Vector4(const float value) noexcept : X(value), Y(value), Z(value), W(value)
+    {
+    }
+
+    constexpr Vector4::Vector4() noexcept : X(0), Y(0), Z(0), W(0)
+    {
+    }
+
+    constexpr float Vector4::Dot(const Vector4& vector) const noexcept
+    {
+        return (X * vector.X) + (Y * vector.Y) + (Z * vector.Z) + (W * vector.W);
+    }
+
+    inline float Vector4::Magnitude() const noexcept
+    {
+        return std::sqrt(Dot(*this));
+    }
+
+    inline float Vector4::Distance(const Vector4& vector) const noexcept
+    {
+        return std::sqrt(DistanceSquared(vector));
+    }
+
+    constexpr float Vector4::DistanceSquared(const Vector4& vector) const noexcept
+    {
+        return ((X - vector.X) * (X - vector.X)) + ((Y - vector.Y) * (Y - vector.Y)) + ((Z - vector.Z) * (Z - vector.Z)) + ((W - vector.W) * (W - vector.W));
+    }
+
+    constexpr void Vector4::Clamp(const Vector4& firstBound, const Vector4& secondBound) noexcept
+    {
+        X = std::clamp(X, std::min(firstBound.X, secondBound.X), std::max(firstBound.X, secondBound.X));
+        Y = std::clamp(Y, std::min(firstBound.Y, secondBound.Y), std::max(firstBound.Y, secondBound.Y));
+        Z = std::clamp(Z, std::min(firstBound.Z, secondBound.Z), std::max(firstBound.Z, secondBound.Z));
+        W = std::clamp(W, std::min(firstBound.W, secondBound.W), std::max(firstBound.W, secondBound.W));
+    }
+
+    inline std::string Vector4::ToString() const noexcept
+    {
+        return "Vector4[X: " + std::to_string(X) + ", Y: " + std::to_string(Y) + ", Z: " + std::to_string(Z) + ", W: " + std::to_string(W) + "]";
+    }
+
+    inline const std::vector<float> Vector4::ToStdVector() const noexcept
+    {
+        return { X, Y, Z, W };
+    }
+
+    constexpr void Vector4::Add(const Vector4& vector) noexcept
+    {
+        X += vector.X;
+        Y += vector.Y;
+        Z += vector.Z;
+        W += vector.W;
+    }
+
+    constexpr void Vector4::Subtract(const Vector4& vector) noexcept
+    {
+        X -= vector.X;
+        Y -= vector.Y;
+        Z -= vector.Z;
+        W -= vector.W;
+    }
+
+    constexpr void Vector4::Multiply(const float scalar) noexcept
+    {
+        X *= scalar;
+        Y *= scalar;
+        Z *= scalar;
+        W *= scalar;
+    }
+
+    constexpr void Vector4::Multiply(const Vector4& vector) noexcept
+    {
+        X *= vector.X;
+        Y *= vector.Y;
+        Z *= vector.Z;
+        W *= vector.W;
+    }
+
+    constexpr void Vector4::Divide(const float scalar)
+    {
+        if (scalar == 0)
+        {
+            throw std::string("Vector4::Divide: Divisor cannot be zero.");
+        }
+
+        X /= scalar;
+        Y /= scalar;
+        Z /= scalar;
+        W /= scalar;
+    }
+
+    constexpr void Vector4::Divide(const Vector4& vector)
+    {
+        if (vector.X == 0 || vector.Y == 0 || vector.Z == 0 || vector.W == 0)
+        {
+            throw std::string("Vector4::Divide: Divisor cannot be zero.");
+        }
+
+        X /= vector.X;
+        Y /= vector.Y;
+        Z /= vector.Z;
+        W /= vector.W;
+    }
+
+    constexpr bool Vector4::Equals(const Vector4& vector) const noexcept
+    {
+        return X == vector.X && Y == vector.Y && Z == vector.Z && W == vector.W;
+    }
+
+    constexpr void Vector4::Negate() noexcept
+    {
+        X = -X;
+        Y = -Y;
+        Z = -Z;
+        W = -W;
+    }
+
+    inline void Vector4::Floor() noexcept
+    {
+        X = std::floor(X);
+        Y = std::floor(Y);
+        Z = std::floor(Z);
+        W = std::floor(W);
+    }
+
+    inline void Vector4::Ceiling() noexcept
+    {
+        X = std::ceil(X);
+        Y = std::ceil(Y);
+        Z = std::ceil(Z);
+        W = std::ceil(W);
+    }
+
+    inline void Vector4::Round() noexcept
+    {
+        X = std::round(X);
+        Y = std::round(Y);
+        Z = std::round(Z);
+        W = std::round(W);
+    }
+
+    inline void Vector4::Abs() noexcept
+    {
+        X = std::abs(X);
+        Y = std::abs(Y);
+        Z = std::abs(Z);
+        W = std::abs(W);
+    }
+
+    inline void Vector4::Normalise() noexcept
+    {
+        float magnitude = Magnitude();
+
+        if (magnitude != 0)
+        {
+            X /= magnitude;
+            Y /= magnitude;
+            Z /= magnitude;
+            W /= magnitude;
+        }
+    }
+
+    constexpr void Vector4::operator+=(const Vector4& vector) noexcept
+    {
+        Add(vector);
+    }
+
+    constexpr void Vector4::operator-=(const Vector4& vector) noexcept
+    {
+        Subtract(vector);
+    }
+
+    constexpr void Vector4::operator*=(const float scalar) noexcept
+    {
+        Multiply(scalar);
+    }
+
+    constexpr void Vector4::operator*=(const Vector4& vector) noexcept
+    {
+        Multiply(vector);
+    }
+
+    constexpr void Vector4::operator/=(const float scalar)
+    {
+        Divide(scalar);
+    }
+
+    constexpr void Vector4::operator/=(const Vector4& vector)
+    {
+        Divide(vector);
+    }
+
+    constexpr Vector4 Vector4::operator-() const noexcept
+    {
+        return Vector4(-X, -Y, -Z, -W);
+    }
+
+    constexpr float Vector4::operator[](int index) const
+    {
+        switch (index)
+        {
+        case 0:
+            return X;
+        case 1:
+            return Y;
+        case 2:
+            return Z;
+        case 3:
+            return W;
+        default:
+            throw std::string("Vector4::operator[]: Index out of bounds of Vector4.");
+        }
+    }
+
+    constexpr float& Vector4::operator[](int index)
+    {
+        switch (index)
+        {
+        case 0:
+            return X;
+        case 1:
+            return Y;
+        case 2:
+            return Z;
+        case 3:
+            return W;
+        default:
+            throw std::string("Vector4::operator[]: Index out of bounds of Vector4.");
+        }
+    }
+
+    constexpr Vector4 Vector4::Max(const Vector4& firstVector, const Vector4& secondVector) noexcept
+    {
+        return Vector4(std::max(firstVector.X, secondVector.X), std::max(firstVector.Y, secondVector.Y), std::max(firstVector.Z, secondVector.Z), std::max(firstVector.W, secondVector.W));
+    }
+
+    constexpr Vector4 Vector4::Min(const Vector4& firstVector, const Vector4& secondVector) noexcept
+    {
+        return Vector4(std::min(firstVector.X, secondVector.X), std::min(firstVector.Y, secondVector.Y), std::min(firstVector.Z, secondVector.Z), std::min(firstVector.W, secondVector.W));
+    }
+
+    constexpr Vector4 Vector4::Lerp(const Vector4& firstVector, const Vector4& secondVector, const float t) noexcept
+    {
+        return Vector4(firstVector.X + (secondVector.X - firstVector.X) * t, firstVector.Y + (secondVector.Y - firstVector.Y) * t, firstVector.Z + (secondVector.Z - firstVector.Z) * t, firstVector.W + (secondVector.W - firstVector.W) * t);
+    }
+
+    inline constexpr Vector4 Vector4::Zero = Vector4(0, 0, 0, 0);
+    inline constexpr Vector4 Vector4::One = Vector4(1, 1, 1, 1);
+    inline constexpr Vector4 Vector4::UnitX = Vector4(1, 0, 0, 0);
+    inline constexpr Vector4 Vector4::UnitY = Vector4(0, 1, 0, 0);
+    inline constexpr Vector4 Vector4::UnitZ = Vector4(0, 0, 1, 0);
+    inline constexpr Vector4 Vector4::UnitW = Vector4(0, 0, 0, 1);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector4 operator+(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept
+{
+    return WackyEngine::Vector4(firstVector.X + secondVector.X, firstVector.Y + secondVector.Y, firstVector.Z + secondVector.Z, firstVector.W + secondVector.W);
 }
 
-WackyEngine::Vector4 operator+(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept;
-WackyEngine::Vector4 operator-(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept;
-WackyEngine::Vector4 operator*(const WackyEngine::Vector4& vector, const float scalar) noexcept;
-WackyEngine::Vector4 operator*(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept;
-WackyEngine::Vector4 operator/(const WackyEngine::Vector4& vector, const float scalar);
-WackyEngine::Vector4 operator/(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector);
-bool operator==(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept;
-bool operator!=(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept;
-std::ostream& operator<<(std::ostream& os, const WackyEngine::Vector4& vector) noexcept;
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector4 operator-(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept
+{
+    return WackyEngine::Vector4(firstVector.X - secondVector.X, firstVector.Y - secondVector.Y, firstVector.Z - secondVector.Z, firstVector.W - secondVector.W);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector4 operator*(const WackyEngine::Vector4& vector, const float scalar) noexcept
+{
+    return WackyEngine::Vector4(vector.X * scalar, vector.Y * scalar, vector.Z * scalar, vector.W * scalar);
+}
+
+WACKYENGINE_FORCEINLINE constexpr WackyEngine::Vector4 operator*(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept
+{
+    return WackyEngine::Vector4(firstVector.X * secondVector.X, firstVector.Y * secondVector.Y, firstVector.Z * secondVector.Z, firstVector.W * secondVector.W);
+}
+
+constexpr WackyEngine::Vector4 operator/(const WackyEngine::Vector4& vector, const float scalar)
+{
+    if (scalar == 0)
+    {
+        throw std::string("Vector4 Division by zero.");
+    }
+
+    return WackyEngine::Vector4(vector.X / scalar, vector.Y / scalar, vector.Z / scalar, vector.W / scalar);
+}
+
+constexpr WackyEngine::Vector4 operator/(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector)
+{
+    if (secondVector.X == 0 || secondVector.Y == 0 || secondVector.Z == 0 || secondVector.W == 0)
+    {
+        throw std::string("Vector4 Division by zero.");
+    }
+
+    return WackyEngine::Vector4(firstVector.X / secondVector.X, firstVector.Y / secondVector.Y, firstVector.Z / secondVector.Z, firstVector.W / secondVector.W);
+}
+
+constexpr bool operator==(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept
+{
+    return firstVector.X == secondVector.X && firstVector.Y == secondVector.Y && firstVector.Z == secondVector.Z && firstVector.W == secondVector.W;
+}
+
+constexpr bool operator!=(const WackyEngine::Vector4& firstVector, const WackyEngine::Vector4& secondVector) noexcept
+{
+    return firstVector.X != secondVector.X || firstVector.Y != secondVector.Y || firstVector.Z != secondVector.Z || firstVector.W != secondVector.W;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const WackyEngine::Vector4& vector) noexcept
+{
+    return os << vector.ToString();
+}
 
 #endif
\ No newline at end of file
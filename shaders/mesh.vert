@@ -0,0 +1,21 @@
+#version 450
+
+layout (push_constant) uniform PushConstants
+{
+    mat4 viewProjection;
+} pc;
+
+layout (location = 0) in vec3 inPosition;
+layout (location = 1) in vec3 inColour;
+layout (location = 2) in vec2 inTexCoord;
+
+// Per instance, firstInstance in each indirect command offsets into the transform buffer.
+layout (location = 4) in mat4 inTransform;
+
+layout (location = 0) out vec3 fragColour;
+
+void main()
+{
+    gl_Position = pc.viewProjection * inTransform * vec4(inPosition, 1.0);
+    fragColour = inColour;
+}
\ No newline at end of file
@@ -11,5 +11,6 @@ layout(location = 0) out vec4 outColour;
 
 void main() 
 {
-    outColour = texture(sampler2D(textures[fragTexIndex], texSampler), fragTexCoord);
+    // Colour arrives premultiplied, textures are expected to be premultiplied too.
+    outColour = texture(sampler2D(textures[fragTexIndex], texSampler), fragTexCoord) * fragColour;
 }
\ No newline at end of file
@@ -1,14 +1,16 @@
 #version 450
 
-layout (binding = 0) uniform UniformBufferObject
+layout (push_constant) uniform PushConstants
 {
-    mat4 proj;
-} ubo;
+    mat4 viewProjection;
+    uint textureOffset;
+} pc;
 
-layout (location = 0) in vec3 inPosition;
-layout (location = 1) in vec3 inColour;
-layout (location = 2) in vec2 inTexCoord;
-layout (location = 3) in int inTexIndex;
+layout (location = 0) in vec2 inPosition;
+layout (location = 1) in vec2 inTexCoord;
+layout (location = 2) in vec4 inColour;
+layout (location = 3) in uint inTexIndex;
+layout (location = 4) in float inDepth;
 
 layout (location = 0) out vec4 fragColour;
 layout (location = 1) out vec2 fragTexCoord;
@@ -16,8 +18,9 @@ layout (location = 2) out int fragTexIndex;
 
 void main()
 {
-    gl_Position = ubo.proj * vec4(inPosition, 1.0);
-    fragColour = vec4(inColour, 1.0);
+    gl_Position = pc.viewProjection * vec4(inPosition, 0.0, 1.0);
+    gl_Position.z = inDepth * gl_Position.w;
+    fragColour = inColour;
     fragTexCoord = inTexCoord;
-    fragTexIndex = inTexIndex;
+    fragTexIndex = int(inTexIndex + pc.textureOffset);
 }
\ No newline at end of file
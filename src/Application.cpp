@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <chrono>
 
 #include <GLFW/glfw3.h>
 
@@ -18,7 +19,8 @@
 
 namespace WackyEngine
 {
-    Application::Application(const int width, const int height, const std::string& windowTitle)
+    Application::Application(const int width, const int height, const std::string& windowTitle, const GraphicsInformation& graphicsInfo)
+        : m_Running(false), m_FixedTimestep(false), m_FixedStep(std::chrono::nanoseconds::zero()), m_MaxUpdateSteps(1)
     {   
         AppInformation appInfo { };
         appInfo.AppName = "WackyEngine App";
@@ -31,7 +33,7 @@ namespace WackyEngine
         windowInfo.Height = height;
         windowInfo.Title = windowTitle.c_str();
 
-        Context::Initialise(appInfo, windowInfo);
+        Context::Initialise(appInfo, windowInfo, graphicsInfo);
 
         m_RenderSystem = new RenderSystem();
     }
@@ -41,6 +43,32 @@ namespace WackyEngine
         delete m_RenderSystem;
     }
 
+    void Application::SetFixedTimestep(double stepSeconds, std::uint32_t maxSteps)
+    {
+        // Written so NaN fails too. The upper bound keeps the cast to nanoseconds from overflowing.
+        if (!(stepSeconds > 0.0 && stepSeconds <= 3600.0) || maxSteps == 0)
+        {
+            throw std::runtime_error("Invalid fixed timestep.");
+        }
+
+        std::chrono::nanoseconds step = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(stepSeconds));
+
+        // Anything under a nanosecond truncates to zero, which Run would divide by.
+        if (step.count() <= 0)
+        {
+            throw std::runtime_error("Invalid fixed timestep.");
+        }
+
+        m_FixedTimestep = true;
+        m_FixedStep = step;
+        m_MaxUpdateSteps = maxSteps;
+    }
+
+    void Application::SetVariableTimestep()
+    {
+        m_FixedTimestep = false;
+    }
+
     void Application::Run()
     {
         m_RenderSystem->SetClearColour({0, 0, 0});
@@ -50,27 +78,70 @@ namespace WackyEngine
             OnWindowResize(width, height);
         });
 
-        float lastFrameTime = 0;
+        using Clock = std::chrono::steady_clock;
+
+        m_Running = true;
 
         Initialise();
 
-        while(!Context::GetWindow()->ShouldClose())
+        Clock::time_point lastFrameTime = Clock::now();
+        std::chrono::nanoseconds accumulator = std::chrono::nanoseconds::zero();
+
+        while (m_Running && (!Context::GetWindow() || !Context::GetWindow()->ShouldClose()))
         {
-            glfwPollEvents();
+            // Pace before polling so input is as fresh as possible when the frame starts.
+            m_FrameLimiter.Wait();
+
+            if (Context::GetWindow())
+            {
+                glfwPollEvents();
+            }
 
-            float time = (float)glfwGetTime();
-            Timestep timestep = time - lastFrameTime;
+            Clock::time_point time = Clock::now();
+            std::chrono::nanoseconds frameTime = time - lastFrameTime;
             lastFrameTime = time;
 
-            Update();
+            float alpha = 1.0f;
 
-            if (VkCommandBuffer cmdBuffer = m_RenderSystem->BeginFrame())
+            if (m_FixedTimestep)
             {
-                m_RenderSystem->BeginRenderPass(cmdBuffer);
+                accumulator += frameTime;
+
+                std::uint32_t steps = 0;
+                while (accumulator >= m_FixedStep && steps < m_MaxUpdateSteps)
+                {
+                    Update(Timestep(m_FixedStep));
+                    accumulator -= m_FixedStep;
+                    ++steps;
+                }
+
+                // Fell too far behind (breakpoint, window drag, hitch); drop the backlog
+                // rather than spiralling into ever longer catch-up frames.
+
+                if (accumulator >= m_FixedStep)
+                {
+                    accumulator %= m_FixedStep;
+                }
+
+                alpha = std::chrono::duration<float>(accumulator) / std::chrono::duration<float>(m_FixedStep);
+            }
+            else
+            {
+                Update(Timestep(frameTime));
+            }
 
+            if (VkCommandBuffer cmdBuffer = m_RenderSystem->BeginFrame())
+            {
                 FrameData data;
                 data.CmdBuffer = cmdBuffer;
-                data.FrameIndex = m_RenderSystem->GetCurrentIndex();
+                data.FrameIndex = m_RenderSystem->GetCurrentFrame();
+                data.ImageIndex = m_RenderSystem->GetCurrentIndex();
+                data.InterpolationAlpha = alpha;
+                data.Arena = m_RenderSystem->GetFrameArena();
+
+                PreDraw(data);
+
+                m_RenderSystem->BeginRenderPass(cmdBuffer);
 
                 Draw(data);
 
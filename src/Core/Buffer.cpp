@@ -1,5 +1,6 @@
 #include "WackyEngine/Core/Buffer.h"
 
+#include <cstring>
 #include <stdexcept>
 
 #include "WackyEngine/Core/Context.h"
@@ -37,14 +38,14 @@ namespace WackyEngine
 
     Buffer::~Buffer()
     {
-        vkDestroyBuffer(Context::GetDevice()->GetLogicalDevice(), m_Buffer, nullptr);
-        vkFreeMemory(Context::GetDevice()->GetLogicalDevice(), m_Memory, nullptr);
+        Context::GetDevice()->DestroyDeferred(m_Buffer);
+        Context::GetDevice()->DestroyDeferred(m_Memory);
     }
 
-    void Buffer::SetData(void* data, const std::size_t size)
+    void Buffer::SetData(const void* data, const std::size_t size, const std::size_t offset)
     {
         void* stage;
-        vkMapMemory(Context::GetDevice()->GetLogicalDevice(), m_Memory, 0, size, 0, &stage);
+        vkMapMemory(Context::GetDevice()->GetLogicalDevice(), m_Memory, offset, size, 0, &stage);
         memcpy(stage, data, size);
         vkUnmapMemory(Context::GetDevice()->GetLogicalDevice(), m_Memory);
     }
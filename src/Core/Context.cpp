@@ -1,6 +1,8 @@
 #include "WackyEngine/Core/Context.h"
 
+#include <algorithm>
 #include <iostream>
+#include <thread>
 
 namespace WackyEngine
 {
@@ -11,12 +13,18 @@ namespace WackyEngine
         Device* Device;
         Window* Window;
         Debugger* Debugger;
+        JobSystem* JobSystem;
+
+        GraphicsInformation GraphicsInfo;
+        VkExtent2D HeadlessExtent;
 
         ~ContextData()
         {
+            // Reverse of creation, the device flushes its deletion queue on destruction which needs the surface alive.
+            delete JobSystem;
+            delete Device;
             delete Debugger;
             delete Window;
-            delete Device;
 
             vkDestroyInstance(Instance, nullptr);
         }
@@ -24,12 +32,42 @@ namespace WackyEngine
 
     static ContextData s_Data;
 
-    void Context::Initialise(const AppInformation& appInfo, const WindowInformation& windowInfo)
+    void Context::Initialise(const AppInformation& appInfo, const WindowInformation& windowInfo, const GraphicsInformation& graphicsInfo)
     {
-        s_Data.Window = new Window(windowInfo.Width, windowInfo.Height, windowInfo.Title);
+        s_Data.GraphicsInfo = graphicsInfo;
+        s_Data.GraphicsInfo.FramesInFlight = std::clamp(graphicsInfo.FramesInFlight, 1u, GraphicsInformation::MAX_FRAMES_IN_FLIGHT);
+
+        // Not worth failing over, the engine runs the same without them.
+        if (s_Data.GraphicsInfo.Validation && !Debugger::CheckValidationLayerSupport())
+        {
+            std::cerr << "Validation layers are not installed, continuing without them." << std::endl;
+            s_Data.GraphicsInfo.Validation = false;
+        }
+
+        // One worker per hardware thread, the main thread makes up the last one.
+        std::uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        s_Data.JobSystem = new JobSystem(hardwareThreads > 1 ? hardwareThreads - 1 : 0);
+
+        s_Data.HeadlessExtent = { static_cast<std::uint32_t>(windowInfo.Width), static_cast<std::uint32_t>(windowInfo.Height) };
+
+        // Headless never touches GLFW, so it works without a display server.
+        if (!graphicsInfo.Headless)
+        {
+            s_Data.Window = new Window(windowInfo.Width, windowInfo.Height, windowInfo.Title);
+        }
+
         InitialiseVulkan(appInfo);
-        s_Data.Window->InitialiseSurface();
-        s_Data.Debugger = new Debugger();
+
+        if (s_Data.Window)
+        {
+            s_Data.Window->InitialiseSurface();
+        }
+
+        if (s_Data.GraphicsInfo.Validation)
+        {
+            s_Data.Debugger = new Debugger();
+        }
+
         s_Data.Device = new Device();
     }
 
@@ -42,7 +80,7 @@ namespace WackyEngine
         applicationInfo.applicationVersion = appInfo.AppVersion;
         applicationInfo.pEngineName = appInfo.EngineName;
         applicationInfo.engineVersion = appInfo.EngineVersion;
-        applicationInfo.apiVersion = VK_API_VERSION_1_0;
+        applicationInfo.apiVersion = VK_API_VERSION_1_2;
 
         // Instance Info
         VkInstanceCreateInfo info { };
@@ -55,9 +93,13 @@ namespace WackyEngine
 
         // Creation/Destruction Debugger
         VkDebugUtilsMessengerCreateInfoEXT debugInfo = Debugger::GetDefaultInfo();
-        info.enabledLayerCount = static_cast<std::uint32_t>(Debugger::ValidationLayers.size());
-        info.ppEnabledLayerNames = Debugger::ValidationLayers.data();
-        info.pNext = (VkDebugUtilsMessengerCreateInfoEXT*)&debugInfo;
+
+        if (s_Data.GraphicsInfo.Validation)
+        {
+            info.enabledLayerCount = static_cast<std::uint32_t>(Debugger::ValidationLayers.size());
+            info.ppEnabledLayerNames = Debugger::ValidationLayers.data();
+            info.pNext = (VkDebugUtilsMessengerCreateInfoEXT*)&debugInfo;
+        }
 
         if (vkCreateInstance(&info, nullptr, &s_Data.Instance) != VK_SUCCESS)
         {
@@ -88,10 +130,19 @@ namespace WackyEngine
 
     std::vector<const char*> Context::GetRequiredExtensions()
     {
-        std::uint32_t glfwExtensionCount;
-        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-        std::vector<const char*> extensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
-        extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        std::vector<const char*> extensions;
+
+        if (!s_Data.GraphicsInfo.Headless)
+        {
+            std::uint32_t glfwExtensionCount;
+            const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+            extensions.assign(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        }
+
+        if (s_Data.GraphicsInfo.Validation)
+        {
+            extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        }
 
         return extensions;
     }
@@ -115,4 +166,19 @@ namespace WackyEngine
     {
         return s_Data.Debugger;
     }
+
+    JobSystem* Context::GetJobSystem()
+    {
+        return s_Data.JobSystem;
+    }
+
+    const GraphicsInformation& Context::GetGraphicsInformation()
+    {
+        return s_Data.GraphicsInfo;
+    }
+
+    VkExtent2D Context::GetHeadlessExtent()
+    {
+        return s_Data.HeadlessExtent;
+    }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "WackyEngine/Core/Debugger.h"
 
+#include <cstring>
 #include <stdexcept>
 #include <iostream>
 
@@ -7,10 +7,22 @@
 #include <iostream>
 
 #include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Core/LinearArena.h"
 
 namespace WackyEngine
 {
-    const std::vector<const char*> Device::RequiredExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME, "VK_EXT_descriptor_indexing" };
+    // Enough for the surface queries, which are made on every swap chain rebuild. Larger results spill to the heap.
+    static constexpr std::size_t QUERY_SCRATCH_SIZE = 2048;
+
+    std::vector<const char*> Device::GetRequiredExtensions()
+    {
+        if (Context::IsHeadless())
+        {
+            return { "VK_EXT_descriptor_indexing" };
+        }
+
+        return { VK_KHR_SWAPCHAIN_EXTENSION_NAME, "VK_EXT_descriptor_indexing" };
+    }
 
     QueueFamilyIndices Device::LocateQueueFamilies(VkPhysicalDevice device)
     {
@@ -24,14 +36,24 @@ namespace WackyEngine
         for (std::size_t i = 0; i < queueFamilyCount; ++i)
         {
             // Graphics Queue Family
-            if (queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) 
+            // Compute passes are recorded into the frame's graphics command buffer, so the family needs both.
+            if ((queueFamilies[i].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) 
             { 
                 indices.GraphicsFamily = i; 
             }
 
             // Present Queue Family
-            VkBool32 presentSupported;
-            vkGetPhysicalDeviceSurfaceSupportKHR(device, i, Context::GetWindow()->GetSurface(), &presentSupported);
+            // Nothing is presented when headless, the graphics queue stands in so the rest of the device setup is unchanged.
+            VkBool32 presentSupported = VK_FALSE;
+
+            if (!Context::IsHeadless())
+            {
+                vkGetPhysicalDeviceSurfaceSupportKHR(device, i, Context::GetWindow()->GetSurface(), &presentSupported);
+            }
+            else if (indices.GraphicsFamily.has_value())
+            {
+                indices.PresentFamily = indices.GraphicsFamily;
+            }
 
             if (presentSupported)
             {
@@ -52,10 +74,17 @@ namespace WackyEngine
         InitialisePhysicalDevice();
         InitialiseLogicalDevice();
         InitialiseCommandPool();
+        InitialiseTimeline();
+
+        m_UnretiredDeletion = 0;
     }
 
     Device::~Device()
     {
+        vkDeviceWaitIdle(m_LogicalDevice);
+        CollectDeletions(true);
+
+        vkDestroySemaphore(m_LogicalDevice, m_GraphicsTimeline, nullptr);
         vkDestroyCommandPool(m_LogicalDevice, m_CommandPool, nullptr);
         vkDestroyDevice(m_LogicalDevice, nullptr);
     }
@@ -84,7 +113,8 @@ namespace WackyEngine
             std::vector<VkExtensionProperties> availableExtensions(extensionCount);
             vkEnumerateDeviceExtensionProperties(availableDevices[i], nullptr, &extensionCount, availableExtensions.data());
 
-            std::set<std::string> requiredExtensions(RequiredExtensions.begin(), RequiredExtensions.end());
+            std::vector<const char*> extensions = GetRequiredExtensions();
+            std::set<std::string> requiredExtensions(extensions.begin(), extensions.end());
 
             for (std::size_t j = 0; j < availableExtensions.size(); ++j)
             {
@@ -97,26 +127,38 @@ namespace WackyEngine
             }
 
             // Check 3: Swap Chain Support
-            std::uint32_t formatCount;
-            vkGetPhysicalDeviceSurfaceFormatsKHR(availableDevices[i], Context::GetWindow()->GetSurface(), &formatCount, nullptr);
-            std::vector<VkSurfaceFormatKHR> formats(formatCount);
-            vkGetPhysicalDeviceSurfaceFormatsKHR(availableDevices[i], Context::GetWindow()->GetSurface(), &formatCount, formats.data());
+            if (!Context::IsHeadless())
+            {
+                std::uint32_t formatCount;
+                vkGetPhysicalDeviceSurfaceFormatsKHR(availableDevices[i], Context::GetWindow()->GetSurface(), &formatCount, nullptr);
 
-            std::uint32_t presentModeCount;
-            vkGetPhysicalDeviceSurfacePresentModesKHR(availableDevices[i], Context::GetWindow()->GetSurface(), &presentModeCount, nullptr);
-            std::vector<VkPresentModeKHR> presentModes(presentModeCount);
-            vkGetPhysicalDeviceSurfacePresentModesKHR(availableDevices[i], Context::GetWindow()->GetSurface(), &presentModeCount, nullptr);
+                std::uint32_t presentModeCount;
+                vkGetPhysicalDeviceSurfacePresentModesKHR(availableDevices[i], Context::GetWindow()->GetSurface(), &presentModeCount, nullptr);
+
+                if (formatCount == 0 || presentModeCount == 0)
+                {
+                    continue;
+                }
+            }
 
-            if (formats.empty() || presentModes.empty())
+            // Check 4: Device Features
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(availableDevices[i], &properties);
+
+            if (properties.apiVersion < VK_API_VERSION_1_2)
             {
                 continue;
             }
 
-            // Check 4: Device Features
-            VkPhysicalDeviceFeatures supportedFeatures;
-            vkGetPhysicalDeviceFeatures(availableDevices[i], &supportedFeatures);
+            VkPhysicalDeviceVulkan12Features supportedFeatures12 { };
+            supportedFeatures12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+            VkPhysicalDeviceFeatures2 supportedFeatures { };
+            supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            supportedFeatures.pNext = &supportedFeatures12;
+            vkGetPhysicalDeviceFeatures2(availableDevices[i], &supportedFeatures);
 
-            if (!supportedFeatures.samplerAnisotropy)
+            if (!supportedFeatures.features.samplerAnisotropy || !supportedFeatures12.timelineSemaphore)
             {
                 continue;
             }
@@ -153,22 +195,41 @@ namespace WackyEngine
         }
 
         // Extra Features to Enabled
+        VkPhysicalDeviceVulkan12Features supportedFeatures12 { };
+        supportedFeatures12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+        VkPhysicalDeviceFeatures2 supportedFeatures { };
+        supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supportedFeatures.pNext = &supportedFeatures12;
+        vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &supportedFeatures);
+
+        m_MultiDrawIndirect = supportedFeatures.features.multiDrawIndirect == VK_TRUE;
+        m_DrawIndirectCount = supportedFeatures12.drawIndirectCount == VK_TRUE;
+
         VkPhysicalDeviceFeatures deviceFeatures { };
         deviceFeatures.samplerAnisotropy = VK_TRUE;
+        deviceFeatures.multiDrawIndirect = supportedFeatures.features.multiDrawIndirect;
         
         VkPhysicalDeviceRobustness2FeaturesEXT deviceRobustnessFeatures { };
         deviceRobustnessFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT;
         deviceRobustnessFeatures.nullDescriptor = VK_TRUE;
 
+        VkPhysicalDeviceVulkan12Features deviceFeatures12 { };
+        deviceFeatures12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        deviceFeatures12.timelineSemaphore = VK_TRUE;
+        deviceFeatures12.drawIndirectCount = supportedFeatures12.drawIndirectCount;
+        deviceFeatures12.pNext = &deviceRobustnessFeatures;
+
         // Logical Device Creation
         VkDeviceCreateInfo info { };
         info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
         info.pQueueCreateInfos = queueInfos.data();
         info.queueCreateInfoCount = static_cast<std::uint32_t>(queueInfos.size());
         info.pEnabledFeatures = &deviceFeatures;
-        info.enabledExtensionCount = static_cast<std::uint32_t>(RequiredExtensions.size());
-        info.ppEnabledExtensionNames = RequiredExtensions.data();
-        info.pNext = &deviceRobustnessFeatures;
+        std::vector<const char*> extensions = GetRequiredExtensions();
+        info.enabledExtensionCount = static_cast<std::uint32_t>(extensions.size());
+        info.ppEnabledExtensionNames = extensions.data();
+        info.pNext = &deviceFeatures12;
 
         if (vkCreateDevice(m_PhysicalDevice, &info, nullptr, &m_LogicalDevice) != VK_SUCCESS)
         {
@@ -196,6 +257,160 @@ namespace WackyEngine
         }
     }
 
+    void Device::InitialiseTimeline()
+    {
+        VkSemaphoreTypeCreateInfo typeInfo { };
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+
+        VkSemaphoreCreateInfo info { };
+        info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        info.pNext = &typeInfo;
+
+        if (vkCreateSemaphore(m_LogicalDevice, &info, nullptr, &m_GraphicsTimeline) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create timeline semaphore.");
+        }
+
+        m_GraphicsTimelineValue = 0;
+    }
+
+    std::uint64_t Device::SubmitGraphics(VkCommandBuffer cmdBuffer, VkSemaphore waitSemaphore, VkPipelineStageFlags waitStage, VkSemaphore signalSemaphore)
+    {
+        std::lock_guard<std::mutex> lock(m_SubmitMutex);
+
+        std::uint64_t signalValue = m_GraphicsTimelineValue + 1;
+
+        // Binary semaphores ignore their entry in the value arrays.
+        VkSemaphore signalSemaphores[] = { m_GraphicsTimeline, signalSemaphore };
+        std::uint64_t signalValues[] = { signalValue, 0 };
+        std::uint64_t waitValues[] = { 0 };
+
+        VkTimelineSemaphoreSubmitInfo timelineInfo { };
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.waitSemaphoreValueCount = waitSemaphore ? 1 : 0;
+        timelineInfo.pWaitSemaphoreValues = waitValues;
+        timelineInfo.signalSemaphoreValueCount = signalSemaphore ? 2 : 1;
+        timelineInfo.pSignalSemaphoreValues = signalValues;
+
+        VkSubmitInfo submitInfo { };
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.waitSemaphoreCount = waitSemaphore ? 1 : 0;
+        submitInfo.pWaitSemaphores = &waitSemaphore;
+        submitInfo.pWaitDstStageMask = &waitStage;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &cmdBuffer;
+        submitInfo.signalSemaphoreCount = signalSemaphore ? 2 : 1;
+        submitInfo.pSignalSemaphores = signalSemaphores;
+
+        if (vkQueueSubmit(m_GraphicsQueue, 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to submit command buffer.");
+        }
+
+        m_GraphicsTimelineValue = signalValue;
+
+        return signalValue;
+    }
+
+    std::uint64_t Device::GetCompletedValue() const
+    {
+        std::uint64_t value;
+        vkGetSemaphoreCounterValue(m_LogicalDevice, m_GraphicsTimeline, &value);
+        return value;
+    }
+
+    void Device::WaitForValue(std::uint64_t value) const
+    {
+        VkSemaphoreWaitInfo waitInfo { };
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &m_GraphicsTimeline;
+        waitInfo.pValues = &value;
+
+        vkWaitSemaphores(m_LogicalDevice, &waitInfo, UINT64_MAX);
+    }
+
+    // Deferred Destruction
+
+    void Device::DestroyDeferred(VkBuffer buffer) { QueueDeletion(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<std::uint64_t>(buffer)); }
+    void Device::DestroyDeferred(VkDeviceMemory memory) { QueueDeletion(VK_OBJECT_TYPE_DEVICE_MEMORY, reinterpret_cast<std::uint64_t>(memory)); }
+    void Device::DestroyDeferred(VkImage image) { QueueDeletion(VK_OBJECT_TYPE_IMAGE, reinterpret_cast<std::uint64_t>(image)); }
+    void Device::DestroyDeferred(VkImageView imageView) { QueueDeletion(VK_OBJECT_TYPE_IMAGE_VIEW, reinterpret_cast<std::uint64_t>(imageView)); }
+    void Device::DestroyDeferred(VkSampler sampler) { QueueDeletion(VK_OBJECT_TYPE_SAMPLER, reinterpret_cast<std::uint64_t>(sampler)); }
+    void Device::DestroyDeferred(VkPipeline pipeline) { QueueDeletion(VK_OBJECT_TYPE_PIPELINE, reinterpret_cast<std::uint64_t>(pipeline)); }
+    void Device::DestroyDeferred(VkPipelineLayout pipelineLayout) { QueueDeletion(VK_OBJECT_TYPE_PIPELINE_LAYOUT, reinterpret_cast<std::uint64_t>(pipelineLayout)); }
+    void Device::DestroyDeferred(VkRenderPass renderPass) { QueueDeletion(VK_OBJECT_TYPE_RENDER_PASS, reinterpret_cast<std::uint64_t>(renderPass)); }
+    void Device::DestroyDeferred(VkFramebuffer framebuffer) { QueueDeletion(VK_OBJECT_TYPE_FRAMEBUFFER, reinterpret_cast<std::uint64_t>(framebuffer)); }
+    void Device::DestroyDeferred(VkDescriptorPool descriptorPool) { QueueDeletion(VK_OBJECT_TYPE_DESCRIPTOR_POOL, reinterpret_cast<std::uint64_t>(descriptorPool)); }
+    void Device::DestroyDeferred(VkDescriptorSetLayout descriptorSetLayout) { QueueDeletion(VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, reinterpret_cast<std::uint64_t>(descriptorSetLayout)); }
+    void Device::DestroyDeferred(VkSwapchainKHR swapchain) { QueueDeletion(VK_OBJECT_TYPE_SWAPCHAIN_KHR, reinterpret_cast<std::uint64_t>(swapchain)); }
+
+    void Device::QueueDeletion(VkObjectType type, std::uint64_t handle)
+    {
+        if (!handle)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_DeletionMutex);
+        m_PendingDeletions.push_back({ type, handle, UINT64_MAX });
+    }
+
+    void Device::RetireDeletions(std::uint64_t submissionValue)
+    {
+        std::lock_guard<std::mutex> lock(m_DeletionMutex);
+
+        for (std::size_t i = m_UnretiredDeletion; i < m_PendingDeletions.size(); ++i)
+        {
+            m_PendingDeletions[i].RetireValue = submissionValue;
+        }
+
+        m_UnretiredDeletion = m_PendingDeletions.size();
+    }
+
+    void Device::CollectDeletions(bool force)
+    {
+        std::lock_guard<std::mutex> lock(m_DeletionMutex);
+
+        std::uint64_t completedValue = force ? UINT64_MAX : GetCompletedValue();
+        std::size_t count = 0;
+
+        while (count < m_PendingDeletions.size() && m_PendingDeletions[count].RetireValue <= completedValue)
+        {
+            DestroyHandle(m_PendingDeletions[count].Type, m_PendingDeletions[count].Handle);
+            ++count;
+        }
+
+        if (count)
+        {
+            m_PendingDeletions.erase(m_PendingDeletions.begin(), m_PendingDeletions.begin() + count);
+            m_UnretiredDeletion = m_UnretiredDeletion > count ? m_UnretiredDeletion - count : 0;
+        }
+    }
+
+    void Device::DestroyHandle(VkObjectType type, std::uint64_t handle) const
+    {
+        switch (type)
+        {
+            case VK_OBJECT_TYPE_BUFFER: vkDestroyBuffer(m_LogicalDevice, reinterpret_cast<VkBuffer>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_DEVICE_MEMORY: vkFreeMemory(m_LogicalDevice, reinterpret_cast<VkDeviceMemory>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_IMAGE: vkDestroyImage(m_LogicalDevice, reinterpret_cast<VkImage>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_IMAGE_VIEW: vkDestroyImageView(m_LogicalDevice, reinterpret_cast<VkImageView>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_SAMPLER: vkDestroySampler(m_LogicalDevice, reinterpret_cast<VkSampler>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_PIPELINE: vkDestroyPipeline(m_LogicalDevice, reinterpret_cast<VkPipeline>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_PIPELINE_LAYOUT: vkDestroyPipelineLayout(m_LogicalDevice, reinterpret_cast<VkPipelineLayout>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_RENDER_PASS: vkDestroyRenderPass(m_LogicalDevice, reinterpret_cast<VkRenderPass>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_FRAMEBUFFER: vkDestroyFramebuffer(m_LogicalDevice, reinterpret_cast<VkFramebuffer>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_DESCRIPTOR_POOL: vkDestroyDescriptorPool(m_LogicalDevice, reinterpret_cast<VkDescriptorPool>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT: vkDestroyDescriptorSetLayout(m_LogicalDevice, reinterpret_cast<VkDescriptorSetLayout>(handle), nullptr); break;
+            case VK_OBJECT_TYPE_SWAPCHAIN_KHR: vkDestroySwapchainKHR(m_LogicalDevice, reinterpret_cast<VkSwapchainKHR>(handle), nullptr); break;
+            default: break;
+        }
+    }
+
     VkSurfaceCapabilitiesKHR Device::GetSurfaceCapabilities() const noexcept
     {
         VkSurfaceCapabilitiesKHR capabilities;
@@ -205,10 +420,13 @@ namespace WackyEngine
 
     VkSurfaceFormatKHR Device::SelectSwapSurfaceFormat() const noexcept
     {
+        alignas(std::max_align_t) std::byte scratch[QUERY_SCRATCH_SIZE];
+        LinearArena arena(scratch, sizeof(scratch));
+
         std::uint32_t formatCount;
         vkGetPhysicalDeviceSurfaceFormatsKHR(m_PhysicalDevice, Context::GetWindow()->GetSurface(), &formatCount, nullptr);
-        std::vector<VkSurfaceFormatKHR> formats(formatCount);
-        vkGetPhysicalDeviceSurfaceFormatsKHR(m_PhysicalDevice, Context::GetWindow()->GetSurface(), &formatCount, formats.data());
+        VkSurfaceFormatKHR* formats = arena.AllocateArray<VkSurfaceFormatKHR>(formatCount);
+        vkGetPhysicalDeviceSurfaceFormatsKHR(m_PhysicalDevice, Context::GetWindow()->GetSurface(), &formatCount, formats);
 
         for (std::size_t i = 0; i < formatCount; ++i)
         {
@@ -221,18 +439,57 @@ namespace WackyEngine
         return formats[0];
     }
 
-    VkPresentModeKHR Device::SelectSwapPresentMode() const noexcept
+    VkFormat Device::SelectDepthFormat() const noexcept
     {
+        const VkFormat candidates[] = { VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT };
+
+        for (VkFormat format : candidates)
+        {
+            VkFormatProperties properties;
+            vkGetPhysicalDeviceFormatProperties(m_PhysicalDevice, format, &properties);
+
+            if (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT)
+            {
+                return format;
+            }
+        }
+
+        return VK_FORMAT_UNDEFINED;
+    }
+
+    VkPresentModeKHR Device::SelectSwapPresentMode(VkPresentModeKHR preferredMode) const noexcept
+    {
+        alignas(std::max_align_t) std::byte scratch[QUERY_SCRATCH_SIZE];
+        LinearArena arena(scratch, sizeof(scratch));
+
         std::uint32_t presentModeCount;
         vkGetPhysicalDeviceSurfacePresentModesKHR(m_PhysicalDevice, Context::GetWindow()->GetSurface(), &presentModeCount, nullptr);
-        std::vector<VkPresentModeKHR> presentModes(presentModeCount);
-        vkGetPhysicalDeviceSurfacePresentModesKHR(m_PhysicalDevice, Context::GetWindow()->GetSurface(), &presentModeCount, nullptr);
+        VkPresentModeKHR* presentModes = arena.AllocateArray<VkPresentModeKHR>(presentModeCount);
+        vkGetPhysicalDeviceSurfacePresentModesKHR(m_PhysicalDevice, Context::GetWindow()->GetSurface(), &presentModeCount, presentModes);
+
+        // Fallbacks: the tearing-free low latency modes try each other first, everything ends at FIFO which is always supported.
+        VkPresentModeKHR candidates[3] = { preferredMode, VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_FIFO_KHR };
 
-        for (std::size_t i = 0; i < presentModeCount; ++i)
+        switch (preferredMode)
         {
-            if (presentModes[i] == VK_PRESENT_MODE_MAILBOX_KHR)
+            case VK_PRESENT_MODE_MAILBOX_KHR:
+                candidates[1] = VK_PRESENT_MODE_IMMEDIATE_KHR;
+                break;
+            case VK_PRESENT_MODE_IMMEDIATE_KHR:
+                candidates[1] = VK_PRESENT_MODE_MAILBOX_KHR;
+                break;
+            default:
+                break;
+        }
+
+        for (VkPresentModeKHR candidate : candidates)
+        {
+            for (std::size_t i = 0; i < presentModeCount; ++i)
             {
-                return presentModes[i];
+                if (presentModes[i] == candidate)
+                {
+                    return candidate;
+                }
             }
         }
 
@@ -270,6 +527,24 @@ namespace WackyEngine
                 return i;
             }
         }
+
+        throw std::runtime_error("Failed to find a suitable memory type.");
+    }
+
+    bool Device::SupportsMemoryProperties(VkMemoryPropertyFlags properties) const
+    {
+        VkPhysicalDeviceMemoryProperties memoryProperties;
+        vkGetPhysicalDeviceMemoryProperties(m_PhysicalDevice, &memoryProperties);
+
+        for (std::uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
+        {
+            if ((memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            {
+                return true;
+            }
+        }
+
+        return false;
     }
 
     VkCommandBuffer Device::BeginSingleTimeCommands() const
@@ -292,17 +567,12 @@ namespace WackyEngine
         return commandBuffer;
     }
 
-    void Device::EndSingleTimeCommands(VkCommandBuffer cmdBuffer) const
+    void Device::EndSingleTimeCommands(VkCommandBuffer cmdBuffer)
     {
         vkEndCommandBuffer(cmdBuffer);
 
-        VkSubmitInfo submitInfo { };
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &cmdBuffer;
-
-        vkQueueSubmit(m_GraphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(m_GraphicsQueue);
+        // Only waits for this submission rather than everything queued before it.
+        WaitForValue(SubmitGraphics(cmdBuffer));
 
         vkFreeCommandBuffers(m_LogicalDevice, m_CommandPool, 1, &cmdBuffer);
     }
@@ -336,7 +606,7 @@ namespace WackyEngine
         vkBindBufferMemory(m_LogicalDevice, buffer, memory, 0);
     }
 
-    void Device::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size) const
+    void Device::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
     {
         VkCommandBuffer cmdBuffer = BeginSingleTimeCommands();
 
@@ -388,7 +658,7 @@ namespace WackyEngine
         vkBindImageMemory(m_LogicalDevice, image, imageMemory, 0);
     }
 
-    void Device::TransitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout) const
+    void Device::TransitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout)
     {
         VkCommandBuffer cmdBuffer = BeginSingleTimeCommands();
 
@@ -434,7 +704,7 @@ namespace WackyEngine
         EndSingleTimeCommands(cmdBuffer);
     }
 
-    void Device::CopyBufferToImage(VkBuffer buffer, VkImage image, std::uint32_t width, std::uint32_t height) const
+    void Device::CopyBufferToImage(VkBuffer buffer, VkImage image, std::uint32_t width, std::uint32_t height)
     {
         VkCommandBuffer cmdBuffer = BeginSingleTimeCommands();
 
@@ -0,0 +1,54 @@
+#include "WackyEngine/Core/FrameArena.h"
+
+#include <stdexcept>
+
+#include "WackyEngine/Core/JobSystem.h"
+
+namespace WackyEngine
+{
+    FrameArena::FrameArena(std::uint32_t frameCount, const JobSystem* jobSystem, std::size_t bytesPerThread)
+        : m_JobSystem(jobSystem), m_FrameCount(frameCount), m_ThreadCount(jobSystem->GetThreadCount()), m_CurrentFrame(0)
+    {
+        m_Arenas.resize(frameCount * m_ThreadCount);
+
+        for (std::size_t i = 0; i < m_Arenas.size(); ++i)
+        {
+            m_Arenas[i] = new LinearArena(bytesPerThread);
+        }
+    }
+
+    FrameArena::~FrameArena()
+    {
+        for (std::size_t i = 0; i < m_Arenas.size(); ++i)
+        {
+            delete m_Arenas[i];
+        }
+    }
+
+    void FrameArena::BeginFrame(std::uint32_t frameIndex)
+    {
+        m_CurrentFrame = frameIndex;
+
+        for (std::uint32_t i = 0; i < m_ThreadCount; ++i)
+        {
+            m_Arenas[m_CurrentFrame * m_ThreadCount + i]->Reset();
+        }
+    }
+
+    LinearArena& FrameArena::GetArena()
+    {
+        std::uint32_t threadIndex = m_JobSystem->GetThreadIndex();
+
+        if (threadIndex == JobSystem::EXTERNAL_THREAD)
+        {
+            throw std::runtime_error("Failed to get frame arena, calling thread does not belong to the job system.");
+        }
+
+        return GetArena(threadIndex);
+    }
+
+    LinearArena& FrameArena::GetArena(std::uint32_t threadIndex)
+    {
+        return *m_Arenas[m_CurrentFrame * m_ThreadCount + threadIndex];
+    }
+}
\ No newline at end of file
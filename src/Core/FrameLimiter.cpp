@@ -0,0 +1,52 @@
+#include "WackyEngine/Core/FrameLimiter.h"
+
+#include <thread>
+
+namespace WackyEngine
+{
+    FrameLimiter::FrameLimiter(double framesPerSecond)
+        : m_FrameTime(0), m_SpinThreshold(std::chrono::milliseconds(2)), m_NextFrame(Clock::now())
+    {
+        SetTargetFrameRate(framesPerSecond);
+    }
+
+    void FrameLimiter::SetTargetFrameRate(double framesPerSecond)
+    {
+        if (framesPerSecond <= 0.0)
+        {
+            m_FrameTime = std::chrono::nanoseconds::zero();
+            return;
+        }
+
+        m_FrameTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(1.0 / framesPerSecond));
+        m_NextFrame = Clock::now() + m_FrameTime;
+    }
+
+    void FrameLimiter::Wait()
+    {
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        Clock::time_point now = Clock::now();
+
+        // More than a frame behind (hitch, breakpoint), start pacing again from now instead of rushing to catch up.
+        if (now - m_NextFrame > m_FrameTime)
+        {
+            m_NextFrame = now;
+        }
+
+        if (m_NextFrame - now > m_SpinThreshold)
+        {
+            std::this_thread::sleep_until(m_NextFrame - m_SpinThreshold);
+        }
+
+        while (Clock::now() < m_NextFrame)
+        {
+            std::this_thread::yield();
+        }
+
+        m_NextFrame += m_FrameTime;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include "WackyEngine/Core/JobSystem.h"
+
+namespace WackyEngine
+{
+    // Which job system the thread belongs to, so a worker of one system is an external thread to every other.
+    struct ThreadRegistration
+    {
+        const JobSystem* System;
+        std::uint32_t Index;
+    };
+
+    static thread_local ThreadRegistration t_Thread { nullptr, 0 };
+
+    static constexpr std::uint32_t IDLE_SPIN_COUNT = 64;
+
+    // Work Stealing Queue
+
+    bool WorkStealingQueue::Push(Job* job)
+    {
+        std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        std::int64_t top = m_Top.load(std::memory_order_acquire);
+
+        if (bottom - top >= CAPACITY)
+        {
+            return false;
+        }
+
+        m_Jobs[bottom & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+        m_Bottom.store(bottom + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    Job* WorkStealingQueue::Pop()
+    {
+        std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = m_Top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Job* job = m_Jobs[bottom & (CAPACITY - 1)].load(std::memory_order_relaxed);
+
+        if (top == bottom)
+        {
+            // Last job in the queue, race any thieves for it.
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                job = nullptr;
+            }
+
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return job;
+    }
+
+    Job* WorkStealingQueue::Steal()
+    {
+        std::int64_t top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        Job* job = m_Jobs[top & (CAPACITY - 1)].load(std::memory_order_relaxed);
+
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+
+        return job;
+    }
+
+    // Job System
+
+    JobSystem::JobSystem(std::uint32_t workerCount)
+        : m_ThreadCount(workerCount + 1), m_Running(true), m_QueuedJobs(0)
+    {
+        m_ThreadData = new ThreadData[m_ThreadCount + 1];
+        m_Jobs = new Job[(m_ThreadCount + 1) * MAX_JOBS_PER_THREAD];
+        m_LiveJobs = new std::atomic<bool>[(m_ThreadCount + 1) * MAX_JOBS_PER_THREAD]();
+
+        for (std::uint32_t i = 0; i <= m_ThreadCount; ++i)
+        {
+            m_ThreadData[i].Jobs = m_Jobs + i * MAX_JOBS_PER_THREAD;
+            m_ThreadData[i].LiveJobs = m_LiveJobs + i * MAX_JOBS_PER_THREAD;
+            m_ThreadData[i].AllocatedJobs = 0;
+            m_ThreadData[i].RandomState = 0x9E3779B9u * (i + 1);
+        }
+
+        m_PreviousSystem = t_Thread.System;
+        m_PreviousThreadIndex = t_Thread.Index;
+        t_Thread = { this, 0 };
+
+        m_Workers.reserve(workerCount);
+
+        for (std::uint32_t i = 1; i < m_ThreadCount; ++i)
+        {
+            m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        m_Running.store(false, std::memory_order_release);
+        m_QueuedJobs.fetch_add(1, std::memory_order_release);
+        m_QueuedJobs.notify_all();
+
+        for (std::thread& worker : m_Workers)
+        {
+            worker.join();
+        }
+
+        delete[] m_Jobs;
+        delete[] m_LiveJobs;
+        delete[] m_ThreadData;
+
+        // Hands the constructing thread back to whichever job system it belonged to before.
+        if (t_Thread.System == this)
+        {
+            t_Thread = { m_PreviousSystem, m_PreviousThreadIndex };
+        }
+    }
+
+    void JobSystem::WorkerLoop(std::uint32_t threadIndex)
+    {
+        t_Thread = { this, threadIndex };
+
+        std::uint32_t idleSpins = 0;
+
+        while (m_Running.load(std::memory_order_acquire))
+        {
+            if (Job* job = GetJob())
+            {
+                Execute(job);
+                idleSpins = 0;
+                continue;
+            }
+
+            if (++idleSpins < IDLE_SPIN_COUNT)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Nothing to steal for a while, sleep until something is submitted.
+            idleSpins = 0;
+            m_QueuedJobs.wait(0, std::memory_order_acquire);
+        }
+    }
+
+    Job* JobSystem::AllocateJob(ThreadData& data)
+    {
+        std::uint32_t slot = data.AllocatedJobs & (MAX_JOBS_PER_THREAD - 1);
+
+        // Jobs finish out of order, so the next slot can still be live even with free ones elsewhere.
+        if (data.LiveJobs[slot].load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        data.LiveJobs[slot].store(true, std::memory_order_relaxed);
+        ++data.AllocatedJobs;
+
+        return &data.Jobs[slot];
+    }
+
+    Job* JobSystem::AllocateJob()
+    {
+        std::uint32_t threadIndex = GetThreadIndex();
+
+        if (threadIndex != EXTERNAL_THREAD)
+        {
+            return AllocateJob(m_ThreadData[threadIndex]);
+        }
+
+        std::lock_guard<std::mutex> lock(m_ExternalMutex);
+        return AllocateJob(m_ThreadData[m_ThreadCount]);
+    }
+
+    void JobSystem::Submit(Job* job)
+    {
+        std::uint32_t threadIndex = GetThreadIndex();
+        bool pushed;
+
+        if (threadIndex != EXTERNAL_THREAD)
+        {
+            pushed = m_ThreadData[threadIndex].Queue.Push(job);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_ExternalMutex);
+            pushed = m_ThreadData[m_ThreadCount].Queue.Push(job);
+        }
+
+        if (!pushed)
+        {
+            // Queue is full, run it here rather than dropping it.
+            Execute(job);
+            return;
+        }
+
+        m_QueuedJobs.fetch_add(1, std::memory_order_release);
+        m_QueuedJobs.notify_one();
+    }
+
+    Job* JobSystem::GetJob()
+    {
+        std::uint32_t threadIndex = GetThreadIndex();
+        std::uint32_t victimCount = m_ThreadCount + 1;
+
+        Job* job = nullptr;
+        std::uint32_t start = 0;
+
+        // External threads own no queue and share no random state, they steal in order starting from thread 0.
+        if (threadIndex != EXTERNAL_THREAD)
+        {
+            ThreadData& data = m_ThreadData[threadIndex];
+
+            job = data.Queue.Pop();
+
+            if (!job)
+            {
+                // xorshift32 for picking a victim
+                data.RandomState ^= data.RandomState << 13;
+                data.RandomState ^= data.RandomState >> 17;
+                data.RandomState ^= data.RandomState << 5;
+
+                start = data.RandomState % victimCount;
+            }
+        }
+
+        // The external queue counts as a victim, so its jobs get picked up even with no workers.
+        for (std::uint32_t i = 0; i < victimCount && !job; ++i)
+        {
+            std::uint32_t victim = (start + i) % victimCount;
+
+            if (victim != threadIndex)
+            {
+                job = m_ThreadData[victim].Queue.Steal();
+            }
+        }
+
+        if (job)
+        {
+            m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        return job;
+    }
+
+    void JobSystem::Execute(Job* job)
+    {
+        JobCounter* counter = job->Counter;
+
+        try
+        {
+            job->Entry(*job);
+        }
+        catch (...)
+        {
+            counter->SetException(std::current_exception());
+        }
+
+        // The slot can be reused as soon as this is cleared, so nothing may touch the job after it.
+        m_LiveJobs[job - m_Jobs].store(false, std::memory_order_release);
+        counter->m_Value.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void JobSystem::WaitForCounter(JobCounter& counter)
+    {
+        while (!counter.IsDone())
+        {
+            if (Job* job = GetJob())
+            {
+                Execute(job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (counter.m_HasException.load(std::memory_order_acquire))
+        {
+            // Reset first so the counter can be reused once the exception has been handled.
+            std::exception_ptr exception = std::move(counter.m_Exception);
+            counter.m_Exception = nullptr;
+            counter.m_HasException.store(false, std::memory_order_relaxed);
+
+            std::rethrow_exception(exception);
+        }
+    }
+
+    std::uint32_t JobSystem::GetThreadIndex() const noexcept
+    {
+        return t_Thread.System == this ? t_Thread.Index : EXTERNAL_THREAD;
+    }
+}
\ No newline at end of file
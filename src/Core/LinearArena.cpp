@@ -0,0 +1,80 @@
+#include "WackyEngine/Core/LinearArena.h"
+
+namespace WackyEngine
+{
+    LinearArena::LinearArena(std::size_t capacity)
+        : m_Capacity(capacity), m_Offset(0), m_HighWaterMark(0), m_OwnsBuffer(true), m_Overflow(nullptr), m_OverflowCount(0)
+    {
+        m_Buffer = static_cast<std::byte*>(::operator new(capacity, std::align_val_t(alignof(std::max_align_t))));
+    }
+
+    LinearArena::LinearArena(void* buffer, std::size_t capacity)
+        : m_Buffer(static_cast<std::byte*>(buffer)), m_Capacity(capacity), m_Offset(0), m_HighWaterMark(0), m_OwnsBuffer(false), m_Overflow(nullptr), m_OverflowCount(0)
+    {
+    }
+
+    LinearArena::~LinearArena()
+    {
+        Reset();
+
+        if (m_OwnsBuffer)
+        {
+            ::operator delete(m_Buffer, std::align_val_t(alignof(std::max_align_t)));
+        }
+    }
+
+    void* LinearArena::Allocate(std::size_t size, std::size_t alignment)
+    {
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_Buffer);
+        std::uintptr_t aligned = (base + m_Offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        std::size_t end = static_cast<std::size_t>(aligned - base) + size;
+
+        if (end > m_Capacity)
+        {
+            return AllocateOverflow(size, alignment);
+        }
+
+        m_Offset = end;
+
+        if (m_Offset > m_HighWaterMark)
+        {
+            m_HighWaterMark = m_Offset;
+        }
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void* LinearArena::AllocateOverflow(std::size_t size, std::size_t alignment)
+    {
+        // The block header is padded out to the requested alignment so the payload stays aligned.
+        if (alignment < alignof(OverflowBlock))
+        {
+            alignment = alignof(OverflowBlock);
+        }
+
+        std::size_t headerSize = (sizeof(OverflowBlock) + alignment - 1) & ~(alignment - 1);
+        std::byte* memory = static_cast<std::byte*>(::operator new(headerSize + size, std::align_val_t(alignment)));
+
+        OverflowBlock* block = reinterpret_cast<OverflowBlock*>(memory);
+        block->Next = m_Overflow;
+        block->Alignment = alignment;
+        m_Overflow = block;
+
+        ++m_OverflowCount;
+
+        return memory + headerSize;
+    }
+
+    void LinearArena::Reset()
+    {
+        while (m_Overflow)
+        {
+            OverflowBlock* next = m_Overflow->Next;
+            ::operator delete(m_Overflow, std::align_val_t(m_Overflow->Alignment));
+            m_Overflow = next;
+        }
+
+        m_Offset = 0;
+        m_OverflowCount = 0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "WackyEngine/Core/MappedFile.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace WackyEngine
+{
+    // The view keeps the mapping alive on both platforms, so file handles are closed as soon as it exists.
+
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::string& path)
+        : m_Data(nullptr), m_Size(0)
+    {
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Failed to open mapped file.");
+        }
+
+        LARGE_INTEGER size;
+        GetFileSizeEx(file, &size);
+        m_Size = static_cast<std::size_t>(size.QuadPart);
+
+        if (m_Size == 0)
+        {
+            CloseHandle(file);
+            return;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if (!mapping)
+        {
+            throw std::runtime_error("Failed to map file.");
+        }
+
+        m_Data = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        CloseHandle(mapping);
+
+        if (!m_Data)
+        {
+            throw std::runtime_error("Failed to map file.");
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (m_Data)
+        {
+            UnmapViewOfFile(m_Data);
+        }
+    }
+#else
+    MappedFile::MappedFile(const std::string& path)
+        : m_Data(nullptr), m_Size(0)
+    {
+        int file = open(path.c_str(), O_RDONLY);
+
+        if (file < 0)
+        {
+            throw std::runtime_error("Failed to open mapped file.");
+        }
+
+        struct stat status;
+        fstat(file, &status);
+        m_Size = static_cast<std::size_t>(status.st_size);
+
+        if (m_Size == 0)
+        {
+            close(file);
+            return;
+        }
+
+        void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+
+        if (data == MAP_FAILED)
+        {
+            throw std::runtime_error("Failed to map file.");
+        }
+
+        // Everything gets read straight away, start the read ahead now.
+        madvise(data, m_Size, MADV_WILLNEED);
+
+        m_Data = static_cast<const std::byte*>(data);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (m_Data)
+        {
+            munmap(const_cast<std::byte*>(m_Data), m_Size);
+        }
+    }
+#endif
+}
\ No newline at end of file
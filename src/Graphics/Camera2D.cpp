@@ -0,0 +1,114 @@
+#include "WackyEngine/Graphics/Camera2D.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace WackyEngine
+{
+    Camera2D::Camera2D(const std::uint32_t viewportWidth, const std::uint32_t viewportHeight)
+        : m_Position(viewportWidth / 2.0f, viewportHeight / 2.0f), m_Zoom(1.0f), m_Rotation(0.0f),
+          m_ViewportWidth(viewportWidth), m_ViewportHeight(viewportHeight)
+    {
+        if (viewportWidth == 0 || viewportHeight == 0)
+        {
+            throw std::runtime_error("Failed to create camera, viewport is empty.");
+        }
+
+        Recalculate();
+    }
+
+    void Camera2D::SetPosition(const Vector2& position)
+    {
+        m_Position = position;
+        Recalculate();
+    }
+
+    void Camera2D::Move(const Vector2& offset)
+    {
+        m_Position += offset;
+        Recalculate();
+    }
+
+    void Camera2D::SetZoom(const float zoom)
+    {
+        // A zero zoom makes the view singular, and written this way NaN is rejected too.
+        if (!(zoom > 0.0f && std::isfinite(zoom)))
+        {
+            throw std::runtime_error("Failed to set camera zoom, zoom must be positive and finite.");
+        }
+
+        m_Zoom = zoom;
+        Recalculate();
+    }
+
+    void Camera2D::SetRotation(const float rotation)
+    {
+        if (!std::isfinite(rotation))
+        {
+            throw std::runtime_error("Failed to set camera rotation, rotation must be finite.");
+        }
+
+        m_Rotation = rotation;
+        Recalculate();
+    }
+
+    void Camera2D::SetViewportSize(const std::uint32_t width, const std::uint32_t height)
+    {
+        // The orthographic projection divides by both, skip resizing while the window is minimised.
+        if (width == 0 || height == 0)
+        {
+            throw std::runtime_error("Failed to set camera viewport, viewport is empty.");
+        }
+
+        m_ViewportWidth = width;
+        m_ViewportHeight = height;
+        Recalculate();
+    }
+
+    Vector2 Camera2D::ScreenToWorld(const Vector2& point) const noexcept
+    {
+        return m_InverseView.TransformPoint(point);
+    }
+
+    Vector2 Camera2D::WorldToScreen(const Vector2& point) const noexcept
+    {
+        return m_View.TransformPoint(point);
+    }
+
+    void Camera2D::Recalculate()
+    {
+        Vector2 halfViewport(m_ViewportWidth / 2.0f, m_ViewportHeight / 2.0f);
+
+        m_View = Transform2D::CreateTranslation(halfViewport) *
+                 Transform2D::CreateRotation(-m_Rotation) *
+                 Transform2D::CreateScale(Vector2(m_Zoom)) *
+                 Transform2D::CreateTranslation(-m_Position);
+
+        m_InverseView = m_View.GetInverse();
+        m_ViewProjection = Matrix4::CreateOrthographic(m_ViewportWidth, m_ViewportHeight) * m_View.ToMatrix4();
+
+        Vector2 corners[4] =
+        {
+            m_InverseView.TransformPoint(Vector2(0.0f, 0.0f)),
+            m_InverseView.TransformPoint(Vector2(m_ViewportWidth, 0.0f)),
+            m_InverseView.TransformPoint(Vector2(m_ViewportWidth, m_ViewportHeight)),
+            m_InverseView.TransformPoint(Vector2(0.0f, m_ViewportHeight))
+        };
+
+        float left = corners[0].X, right = corners[0].X, top = corners[0].Y, bottom = corners[0].Y;
+
+        for (const Vector2& corner : corners)
+        {
+            left = std::min(left, corner.X);
+            right = std::max(right, corner.X);
+            top = std::min(top, corner.Y);
+            bottom = std::max(bottom, corner.Y);
+        }
+
+        int x = static_cast<int>(std::floor(left));
+        int y = static_cast<int>(std::floor(top));
+
+        m_VisibleBounds = Rectangle(x, y, static_cast<int>(std::ceil(right)) - x, static_cast<int>(std::ceil(bottom)) - y);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include "WackyEngine/Graphics/CookedMesh.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "WackyEngine/Core/MappedFile.h"
+#include "WackyEngine/Graphics/MeshLoader.h"
+#include "WackyEngine/Graphics/Model.h"
+
+namespace WackyEngine
+{
+    static std::uint64_t AlignBlob(std::uint64_t offset) noexcept
+    {
+        return (offset + CookedMesh::BLOB_ALIGNMENT - 1) & ~static_cast<std::uint64_t>(CookedMesh::BLOB_ALIGNMENT - 1);
+    }
+
+    template<typename T>
+    static std::uint32_t GetMaximumIndex(const std::byte* data, std::uint32_t count) noexcept
+    {
+        T maximum = 0;
+
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            T index;
+            std::memcpy(&index, data + i * sizeof(T), sizeof(T));
+            maximum = std::max(maximum, index);
+        }
+
+        return maximum;
+    }
+
+    std::uint32_t CookedMesh::GetVertexAttributes() noexcept
+    {
+        // Attribute offsets, a byte each. Any change to Vertex's members moves at least one of them.
+        return static_cast<std::uint32_t>(offsetof(Vertex, Position))
+            | static_cast<std::uint32_t>(offsetof(Vertex, Colour)) << 8
+            | static_cast<std::uint32_t>(offsetof(Vertex, TextureCoordinates)) << 16
+            | static_cast<std::uint32_t>(offsetof(Vertex, TextureIndex)) << 24;
+    }
+
+    void CookedMesh::Write(const std::string& path, const MeshData& mesh)
+    {
+        CookedMeshHeader header { };
+        header.Magic = MAGIC;
+        header.Version = VERSION;
+        header.VertexStride = sizeof(Vertex);
+        header.VertexAttributes = GetVertexAttributes();
+        header.VertexCount = static_cast<std::uint32_t>(mesh.Vertices.size());
+        header.IndexCount = static_cast<std::uint32_t>(mesh.Indices.size());
+        header.IndexSize = mesh.Vertices.size() <= 65536 ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            header.BoundsMin[i] = mesh.Vertices.empty() ? 0.0f : std::numeric_limits<float>::max();
+            header.BoundsMax[i] = mesh.Vertices.empty() ? 0.0f : std::numeric_limits<float>::lowest();
+        }
+
+        for (const Vertex& vertex : mesh.Vertices)
+        {
+            const float position[3] = { vertex.Position.X, vertex.Position.Y, vertex.Position.Z };
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                header.BoundsMin[i] = std::min(header.BoundsMin[i], position[i]);
+                header.BoundsMax[i] = std::max(header.BoundsMax[i], position[i]);
+            }
+        }
+
+        std::uint64_t vertexSize = static_cast<std::uint64_t>(header.VertexStride) * header.VertexCount;
+        std::uint64_t indexSize = static_cast<std::uint64_t>(header.IndexSize) * header.IndexCount;
+
+        header.VertexOffset = AlignBlob(sizeof(CookedMeshHeader));
+        header.IndexOffset = AlignBlob(header.VertexOffset + vertexSize);
+
+        std::vector<char> file(header.IndexOffset + indexSize, 0);
+        std::memcpy(file.data(), &header, sizeof(header));
+        std::memcpy(file.data() + header.VertexOffset, mesh.Vertices.data(), vertexSize);
+
+        if (header.IndexSize == sizeof(std::uint16_t))
+        {
+            for (std::size_t i = 0; i < mesh.Indices.size(); ++i)
+            {
+                std::uint16_t index = static_cast<std::uint16_t>(mesh.Indices[i]);
+                std::memcpy(file.data() + header.IndexOffset + i * sizeof(index), &index, sizeof(index));
+            }
+        }
+        else
+        {
+            std::memcpy(file.data() + header.IndexOffset, mesh.Indices.data(), indexSize);
+        }
+
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+
+        if (!output || !output.write(file.data(), file.size()))
+        {
+            throw std::runtime_error("Failed to write cooked mesh.");
+        }
+    }
+
+    CookedMeshHeader CookedMesh::Validate(const std::byte* data, std::size_t size)
+    {
+        CookedMeshHeader header;
+
+        if (size < sizeof(header))
+        {
+            throw std::runtime_error("Failed to load cooked mesh, file is too small.");
+        }
+
+        std::memcpy(&header, data, sizeof(header));
+
+        if (header.Magic != MAGIC || header.Version != VERSION)
+        {
+            throw std::runtime_error("Failed to load cooked mesh, unknown format or version.");
+        }
+
+        if (header.VertexStride != sizeof(Vertex) || header.VertexAttributes != GetVertexAttributes())
+        {
+            throw std::runtime_error("Failed to load cooked mesh, vertex layout has changed since it was cooked.");
+        }
+
+        std::uint64_t vertexSize = static_cast<std::uint64_t>(header.VertexStride) * header.VertexCount;
+        std::uint64_t indexSize = static_cast<std::uint64_t>(header.IndexSize) * header.IndexCount;
+
+        // Offsets come straight from the file, so sizes are compared against what is left past them rather than
+        // added to them, which a huge offset could wrap around.
+        if ((header.IndexSize != sizeof(std::uint16_t) && header.IndexSize != sizeof(std::uint32_t))
+            || header.VertexCount == 0 || header.IndexCount == 0 || header.VertexOffset < sizeof(header)
+            || header.VertexOffset > header.IndexOffset || vertexSize > header.IndexOffset - header.VertexOffset
+            || header.IndexOffset > size || indexSize > size - header.IndexOffset)
+        {
+            throw std::runtime_error("Failed to load cooked mesh, file is corrupt.");
+        }
+
+        // An index past the vertices would have the GPU read outside the vertex buffer.
+        const std::byte* indices = data + header.IndexOffset;
+        std::uint32_t maximumIndex = header.IndexSize == sizeof(std::uint16_t)
+            ? GetMaximumIndex<std::uint16_t>(indices, header.IndexCount)
+            : GetMaximumIndex<std::uint32_t>(indices, header.IndexCount);
+
+        if (maximumIndex >= header.VertexCount)
+        {
+            throw std::runtime_error("Failed to load cooked mesh, an index is out of range.");
+        }
+
+        return header;
+    }
+
+    Model* CookedMesh::Load(const std::string& path, LoadStatistics* statistics)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        MappedFile file(path);
+        CookedMeshHeader header = Validate(file.GetData(), file.GetSize());
+
+        Model* model = new Model(header, file.GetData());
+
+        if (statistics)
+        {
+            statistics->Bytes = file.GetSize();
+            statistics->Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            statistics->MegabytesPerSecond = statistics->Seconds > 0.0 ? statistics->Bytes / (statistics->Seconds * 1000000.0) : 0.0;
+        }
+
+        return model;
+    }
+}
\ No newline at end of file
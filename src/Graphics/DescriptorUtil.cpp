@@ -70,40 +70,41 @@ namespace WackyEngine
 
     // Descriptor Writer
 
-    DescriptorWriter& DescriptorWriter::WriteBuffer(std::uint32_t binding, std::uint32_t count, VkDescriptorType type, VkDescriptorBufferInfo* bufferInfo)
+    VkWriteDescriptorSet& DescriptorWriter::AddWrite(std::uint32_t binding, std::uint32_t count, VkDescriptorType type)
     {
-        VkWriteDescriptorSet write { };
+        if (m_WriteCount == MAX_WRITES)
+        {
+            throw std::runtime_error("Too many writes in descriptor writer.");
+        }
+
+        VkWriteDescriptorSet& write = m_DescriptorWrites[m_WriteCount++];
+        write = { };
         write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         write.dstSet = m_DestinationSet;
         write.dstBinding = binding;
         write.dstArrayElement = 0;
         write.descriptorType = type;
         write.descriptorCount = count;
-        write.pBufferInfo = bufferInfo;
 
-        m_DescriptorWrites.push_back(write);
+        return write;
+    }
+
+    DescriptorWriter& DescriptorWriter::WriteBuffer(std::uint32_t binding, std::uint32_t count, VkDescriptorType type, VkDescriptorBufferInfo* bufferInfo)
+    {
+        AddWrite(binding, count, type).pBufferInfo = bufferInfo;
 
         return *this;
     }
 
     DescriptorWriter& DescriptorWriter::WriteImage(std::uint32_t binding, std::uint32_t count, VkDescriptorType type, VkDescriptorImageInfo* imageInfo)
     {
-        VkWriteDescriptorSet write { };
-        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        write.dstSet = m_DestinationSet;
-        write.dstBinding = binding;
-        write.dstArrayElement = 0;
-        write.descriptorType = type;
-        write.descriptorCount = count;
-        write.pImageInfo = imageInfo;
-
-        m_DescriptorWrites.push_back(write);
+        AddWrite(binding, count, type).pImageInfo = imageInfo;
 
         return *this;
     }
 
     void DescriptorWriter::Write()
     {
-        vkUpdateDescriptorSets(Context::GetDevice()->GetLogicalDevice(), (std::uint32_t)m_DescriptorWrites.size(), m_DescriptorWrites.data(), 0, nullptr);
+        vkUpdateDescriptorSets(Context::GetDevice()->GetLogicalDevice(), m_WriteCount, m_DescriptorWrites, 0, nullptr);
     }
 }
\ No newline at end of file
@@ -0,0 +1,342 @@
+#include "WackyEngine/Graphics/FrameCapture.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Graphics/ImageWriter.h"
+
+namespace WackyEngine
+{
+    static constexpr VkDeviceSize BYTES_PER_PIXEL = 4;
+
+    static void RecordImageBarrier(VkCommandBuffer cmdBuffer, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout,
+        VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+    {
+        VkImageMemoryBarrier barrier { };
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        barrier.oldLayout = oldLayout;
+        barrier.newLayout = newLayout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+
+        vkCmdPipelineBarrier(cmdBuffer, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+
+    FrameCapture::FrameCapture(RenderSystem* renderSystem, std::uint32_t slotCount, std::uint32_t encoderCount)
+        : m_RenderSystem(renderSystem), m_SlotCount(slotCount), m_Stopping(false), m_PendingEncodes(0), m_CompletedCount(0), m_FailedCount(0), m_DroppedCount(0)
+    {
+        if (slotCount == 0 || encoderCount == 0)
+        {
+            throw std::runtime_error("Failed to create frame capture, it needs at least one buffer and one encoder.");
+        }
+
+        // The encoders read every byte back on the CPU, which is several times slower from uncached memory.
+        m_MemoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+        if (Context::GetDevice()->SupportsMemoryProperties(m_MemoryProperties | VK_MEMORY_PROPERTY_HOST_CACHED_BIT))
+        {
+            m_MemoryProperties |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        }
+
+        // Sized up front so the first captures don't allocate mid-frame, only a resize does.
+        VkExtent2D extent = m_RenderSystem->GetRenderTarget()->GetExtent();
+        m_Slots = new Slot[slotCount];
+
+        for (std::uint32_t i = 0; i < slotCount; ++i)
+        {
+            EnsureCapacity(m_Slots[i], extent.width * extent.height * BYTES_PER_PIXEL);
+        }
+
+        m_Encoders.reserve(encoderCount);
+
+        for (std::uint32_t i = 0; i < encoderCount; ++i)
+        {
+            m_Encoders.emplace_back(&FrameCapture::EncoderLoop, this);
+        }
+    }
+
+    FrameCapture::~FrameCapture()
+    {
+        Flush();
+
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_Stopping = true;
+        }
+
+        m_QueueCondition.notify_all();
+
+        for (std::thread& encoder : m_Encoders)
+        {
+            encoder.join();
+        }
+
+        for (std::uint32_t i = 0; i < m_SlotCount; ++i)
+        {
+            if (m_Slots[i].Readback)
+            {
+                vkUnmapMemory(Context::GetDevice()->GetLogicalDevice(), m_Slots[i].Readback->GetMemoryObject());
+                delete m_Slots[i].Readback;
+            }
+        }
+
+        delete[] m_Slots;
+    }
+
+    void FrameCapture::EnsureCapacity(Slot& slot, VkDeviceSize size)
+    {
+        if (slot.Capacity >= size)
+        {
+            return;
+        }
+
+        // Only free slots get here, so the GPU and the encoders are done with the old buffer.
+        if (slot.Readback)
+        {
+            vkUnmapMemory(Context::GetDevice()->GetLogicalDevice(), slot.Readback->GetMemoryObject());
+            delete slot.Readback;
+        }
+
+        slot.Readback = new Buffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, m_MemoryProperties);
+        slot.Capacity = size;
+
+        if (vkMapMemory(Context::GetDevice()->GetLogicalDevice(), slot.Readback->GetMemoryObject(), 0, VK_WHOLE_SIZE, 0, &slot.Mapped) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to map capture buffer.");
+        }
+    }
+
+    bool FrameCapture::Capture(VkCommandBuffer cmdBuffer, const std::string& path, CaptureFormat format)
+    {
+        RenderTarget* target = m_RenderSystem->GetRenderTarget();
+
+        if (!target->CanReadBack())
+        {
+            throw std::runtime_error("Failed to capture frame, the render target's images can't be copied from.");
+        }
+
+        bool swapRedBlue;
+
+        switch (target->GetColourFormat())
+        {
+            case VK_FORMAT_R8G8B8A8_UNORM:
+            case VK_FORMAT_R8G8B8A8_SRGB:
+                swapRedBlue = false;
+                break;
+
+            case VK_FORMAT_B8G8R8A8_UNORM:
+            case VK_FORMAT_B8G8R8A8_SRGB:
+                swapRedBlue = true;
+                break;
+
+            default:
+                throw std::runtime_error("Failed to capture frame, unsupported colour format.");
+        }
+
+        Slot* slot = nullptr;
+
+        for (std::uint32_t i = 0; i < m_SlotCount && !slot; ++i)
+        {
+            if (m_Slots[i].State.load(std::memory_order_acquire) == SlotState::Free)
+            {
+                slot = &m_Slots[i];
+            }
+        }
+
+        if (!slot)
+        {
+            ++m_DroppedCount;
+            return false;
+        }
+
+        VkExtent2D extent = target->GetExtent();
+        EnsureCapacity(*slot, extent.width * extent.height * BYTES_PER_PIXEL);
+
+        // Copy
+        // The render pass leaves the image ready to present, or already as a transfer source when offscreen.
+        // Its outgoing dependency already made the colour writes visible to transfers, so the layout change
+        // only has to chain off the transfer stage.
+
+        VkImage image = target->GetImage(m_RenderSystem->GetCurrentIndex());
+        VkImageLayout finalLayout = target->GetRenderPass()->GetFinalLayout();
+
+        RecordImageBarrier(cmdBuffer, image, finalLayout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            0, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+        VkBufferImageCopy region { };
+        region.bufferOffset = 0;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = { 0, 0, 0 };
+        region.imageExtent = { extent.width, extent.height, 1 };
+
+        vkCmdCopyImageToBuffer(cmdBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot->Readback->GetBufferObject(), 1, &region);
+
+        if (finalLayout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+        {
+            // Presentation waits on the frame's semaphore, so nothing later in the frame needs to wait on this.
+            RecordImageBarrier(cmdBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, finalLayout,
+                0, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+        }
+
+        VkBufferMemoryBarrier hostBarrier { };
+        hostBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        hostBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        hostBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        hostBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        hostBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        hostBarrier.buffer = slot->Readback->GetBufferObject();
+        hostBarrier.offset = 0;
+        hostBarrier.size = VK_WHOLE_SIZE;
+
+        vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &hostBarrier, 0, nullptr);
+
+        slot->FrameNumber = m_RenderSystem->GetSubmittedFrameCount();
+        slot->FrameIndex = m_RenderSystem->GetCurrentFrame();
+        slot->TimelineValue = 0;
+        slot->Extent = extent;
+        slot->SwapRedBlue = swapRedBlue;
+        slot->Path = path;
+        slot->Format = format;
+        slot->State.store(SlotState::Recorded, std::memory_order_release);
+
+        return true;
+    }
+
+    void FrameCapture::Poll()
+    {
+        RenderTarget* target = m_RenderSystem->GetRenderTarget();
+
+        std::uint64_t submitted = m_RenderSystem->GetSubmittedFrameCount();
+        std::uint64_t completed = Context::GetDevice()->GetCompletedValue();
+
+        for (std::uint32_t i = 0; i < m_SlotCount; ++i)
+        {
+            Slot& slot = m_Slots[i];
+
+            if (slot.State.load(std::memory_order_acquire) != SlotState::Recorded || submitted <= slot.FrameNumber)
+            {
+                continue;
+            }
+
+            // The frame slot's timeline value is this frame's until the slot is next submitted. Reusing it means
+            // acquiring it, which waits on this frame, so past that point the copy is known to be finished.
+            bool reused = submitted - slot.FrameNumber > target->GetFramesInFlight();
+
+            if (!reused && slot.TimelineValue == 0)
+            {
+                slot.TimelineValue = target->GetFrameValue(slot.FrameIndex);
+            }
+
+            if (!reused && completed < slot.TimelineValue)
+            {
+                continue;
+            }
+
+            slot.State.store(SlotState::Encoding, std::memory_order_relaxed);
+            m_PendingEncodes.fetch_add(1, std::memory_order_relaxed);
+
+            {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+                m_Queue.push_back(&slot);
+            }
+
+            m_QueueCondition.notify_one();
+        }
+    }
+
+    void FrameCapture::Flush()
+    {
+        // Captures recorded into a frame that was never submitted stay where they are.
+        Context::GetDevice()->WaitForValue(Context::GetDevice()->GetLastSubmittedValue());
+        Poll();
+
+        std::uint32_t pending = m_PendingEncodes.load(std::memory_order_acquire);
+
+        while (pending != 0)
+        {
+            m_PendingEncodes.wait(pending, std::memory_order_acquire);
+            pending = m_PendingEncodes.load(std::memory_order_acquire);
+        }
+    }
+
+    void FrameCapture::EncoderLoop()
+    {
+        while (true)
+        {
+            Slot* slot;
+
+            {
+                std::unique_lock<std::mutex> lock(m_QueueMutex);
+                m_QueueCondition.wait(lock, [this]() { return m_Stopping || !m_Queue.empty(); });
+
+                if (m_Queue.empty())
+                {
+                    return;
+                }
+
+                slot = m_Queue.front();
+                m_Queue.pop_front();
+            }
+
+            Encode(*slot);
+
+            m_PendingEncodes.fetch_sub(1, std::memory_order_acq_rel);
+            m_PendingEncodes.notify_all();
+        }
+    }
+
+    void FrameCapture::Encode(Slot& slot)
+    {
+        // Copy out first so the buffer goes back to the ring before the slow part.
+        VkExtent2D extent = slot.Extent;
+        bool swapRedBlue = slot.SwapRedBlue;
+        std::string path = std::move(slot.Path);
+        CaptureFormat format = slot.Format;
+
+        std::vector<std::uint8_t> pixels(extent.width * extent.height * BYTES_PER_PIXEL);
+        std::memcpy(pixels.data(), slot.Mapped, pixels.size());
+
+        slot.State.store(SlotState::Free, std::memory_order_release);
+
+        if (swapRedBlue)
+        {
+            for (std::size_t i = 0; i < pixels.size(); i += BYTES_PER_PIXEL)
+            {
+                std::swap(pixels[i], pixels[i + 2]);
+            }
+        }
+
+        try
+        {
+            if (format == CaptureFormat::PNG)
+            {
+                ImageWriter::WritePNG(path, extent.width, extent.height, pixels.data());
+            }
+            else
+            {
+                ImageWriter::WriteRaw(path, pixels.data(), pixels.size());
+            }
+
+            m_CompletedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        catch (const std::exception&)
+        {
+            m_FailedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
\ No newline at end of file
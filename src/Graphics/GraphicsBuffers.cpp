@@ -1,48 +1,66 @@
 #include "WackyEngine/Graphics/GraphicsBuffers.h"
 
-#include <iostream>
+#include <cstring>
 
 namespace WackyEngine
 {
     // VERTEX BUFFER
 
-    VertexBuffer::VertexBuffer(const std::size_t count)
-        : m_Buffer((VkDeviceSize)count * sizeof(Vertex), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
-          m_StagingBuffer((VkDeviceSize)count * sizeof(Vertex), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
-          m_VertexArray(new Vertex[count]),
+    VertexBuffer::VertexBuffer(const std::size_t count, const std::uint32_t frameCount)
+        : m_VertexArray(new Vertex2D[count]),
           m_FrontHandle(m_VertexArray)
     {
+        for (std::uint32_t i = 0; i < frameCount; ++i)
+        {
+            m_Buffers.push_back(new Buffer((VkDeviceSize)count * sizeof(Vertex2D), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT));
+        }
     }
 
     VertexBuffer::~VertexBuffer()
     {
+        for (std::size_t i = 0; i < m_Buffers.size(); ++i)
+        {
+            delete m_Buffers[i];
+        }
+
         delete[] m_VertexArray;
     }
 
-    void VertexBuffer::AddVertex(const Vertex& vertex)
+    void VertexBuffer::AddVertex(const Vertex2D& vertex)
     {
-        memcpy(m_FrontHandle, &vertex, sizeof(Vertex));
+        memcpy(m_FrontHandle, &vertex, sizeof(Vertex2D));
         m_FrontHandle++;
     }
 
-    void VertexBuffer::Flush()
+    void VertexBuffer::Flush(const std::uint32_t frameIndex)
     {
-        m_StagingBuffer.SetData(m_VertexArray, (m_FrontHandle - m_VertexArray) * sizeof(Vertex));
-        m_Buffer.CopyBuffer(m_StagingBuffer, (m_FrontHandle - m_VertexArray) * sizeof(Vertex));
+        if (GetCount() > 0)
+        {
+            m_Buffers[frameIndex]->SetData(m_VertexArray, GetCount() * sizeof(Vertex2D));
+        }
     }
 
     // INDEX BUFFER
 
-    IndexBuffer::IndexBuffer(const std::size_t count)
-        : m_Buffer((VkDeviceSize)count * sizeof(std::uint16_t), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
-          m_StagingBuffer((VkDeviceSize)count * sizeof(std::uint16_t), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
-          m_IndexArray(new std::uint16_t[count]),
+    IndexBuffer::IndexBuffer(const std::size_t count, const std::uint32_t frameCount)
+        : m_IndexArray(new std::uint16_t[count]),
           m_FrontHandle(m_IndexArray)
     {
+        for (std::uint32_t i = 0; i < frameCount; ++i)
+        {
+            m_Buffers.push_back(new Buffer((VkDeviceSize)count * sizeof(std::uint16_t), VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT));
+        }
     }
 
     IndexBuffer::~IndexBuffer()
     {
+        for (std::size_t i = 0; i < m_Buffers.size(); ++i)
+        {
+            delete m_Buffers[i];
+        }
+
         delete[] m_IndexArray;
     }
 
@@ -52,9 +70,11 @@ namespace WackyEngine
         m_FrontHandle++;
     }
 
-    void IndexBuffer::Flush()
+    void IndexBuffer::Flush(const std::uint32_t frameIndex)
     {
-        m_StagingBuffer.SetData(m_IndexArray, (m_FrontHandle - m_IndexArray) * sizeof(std::uint16_t));
-        m_Buffer.CopyBuffer(m_StagingBuffer, (m_FrontHandle - m_IndexArray) * sizeof(std::uint16_t));
+        if (GetCount() > 0)
+        {
+            m_Buffers[frameIndex]->SetData(m_IndexArray, GetCount() * sizeof(std::uint16_t));
+        }
     }
 }
\ No newline at end of file
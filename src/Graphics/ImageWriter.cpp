@@ -0,0 +1,383 @@
+#include "WackyEngine/Graphics/ImageWriter.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+
+namespace WackyEngine
+{
+    namespace ImageWriter
+    {
+        static constexpr std::uint32_t BYTES_PER_PIXEL = 4;
+
+        static constexpr std::uint32_t HASH_BITS = 15;
+        static constexpr std::uint32_t WINDOW_SIZE = 32768;
+        static constexpr std::uint32_t MAX_CHAIN = 32;
+        static constexpr std::uint32_t MIN_MATCH = 3;
+        static constexpr std::uint32_t MAX_MATCH = 258;
+        static constexpr std::size_t MAX_STORED_BLOCK = 65535;
+
+        static constexpr std::uint16_t LENGTH_BASES[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+        static constexpr std::uint8_t LENGTH_EXTRA_BITS[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+        static constexpr std::uint16_t DISTANCE_BASES[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+        static constexpr std::uint8_t DISTANCE_EXTRA_BITS[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+        // Deflate packs bits from the least significant end, Huffman codes go in most significant bit first.
+        class BitWriter
+        {
+        private:
+            std::vector<std::uint8_t>& m_Output;
+            std::uint64_t m_Buffer = 0;
+            std::uint32_t m_Count = 0;
+
+        public:
+            BitWriter(std::vector<std::uint8_t>& output) : m_Output(output) { }
+
+            void Write(std::uint32_t bits, std::uint32_t count)
+            {
+                m_Buffer |= static_cast<std::uint64_t>(bits) << m_Count;
+                m_Count += count;
+
+                while (m_Count >= 8)
+                {
+                    m_Output.push_back(static_cast<std::uint8_t>(m_Buffer));
+                    m_Buffer >>= 8;
+                    m_Count -= 8;
+                }
+            }
+
+            void WriteCode(std::uint32_t code, std::uint32_t count)
+            {
+                std::uint32_t reversed = 0;
+
+                for (std::uint32_t i = 0; i < count; ++i)
+                {
+                    reversed |= ((code >> i) & 1) << (count - 1 - i);
+                }
+
+                Write(reversed, count);
+            }
+
+            void Flush()
+            {
+                if (m_Count > 0)
+                {
+                    m_Output.push_back(static_cast<std::uint8_t>(m_Buffer));
+                }
+
+                m_Buffer = 0;
+                m_Count = 0;
+            }
+        };
+
+        // Fixed literal/length code from the deflate specification.
+        static void WriteLiteral(BitWriter& writer, std::uint32_t value)
+        {
+            if (value < 144)
+            {
+                writer.WriteCode(0x30 + value, 8);
+            }
+            else if (value < 256)
+            {
+                writer.WriteCode(0x190 + value - 144, 9);
+            }
+            else if (value < 280)
+            {
+                writer.WriteCode(value - 256, 7);
+            }
+            else
+            {
+                writer.WriteCode(0xC0 + value - 280, 8);
+            }
+        }
+
+        static void WriteMatch(BitWriter& writer, std::uint32_t length, std::uint32_t distance)
+        {
+            std::uint32_t lengthCode = static_cast<std::uint32_t>(std::upper_bound(LENGTH_BASES, LENGTH_BASES + 29, length) - LENGTH_BASES) - 1;
+            WriteLiteral(writer, 257 + lengthCode);
+            writer.Write(length - LENGTH_BASES[lengthCode], LENGTH_EXTRA_BITS[lengthCode]);
+
+            std::uint32_t distanceCode = static_cast<std::uint32_t>(std::upper_bound(DISTANCE_BASES, DISTANCE_BASES + 30, distance) - DISTANCE_BASES) - 1;
+            writer.WriteCode(distanceCode, 5);
+            writer.Write(distance - DISTANCE_BASES[distanceCode], DISTANCE_EXTRA_BITS[distanceCode]);
+        }
+
+        static std::uint32_t HashBytes(const std::uint8_t* bytes) noexcept
+        {
+            std::uint32_t value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16);
+            return (value * 2654435761u) >> (32 - HASH_BITS);
+        }
+
+        // Zlib stream holding one fixed Huffman block, greedy matching over hash chains. Noisy data that the fixed
+        // code would expand is written as stored blocks instead.
+        static void Compress(const std::vector<std::uint8_t>& data, std::vector<std::uint8_t>& output)
+        {
+            output.push_back(0x78);
+            output.push_back(0x01);
+
+            BitWriter writer(output);
+            writer.Write(1, 1); // Final block
+            writer.Write(1, 2); // Fixed Huffman codes
+
+            std::size_t size = data.size();
+            std::vector<std::int32_t> head(std::size_t(1) << HASH_BITS, -1);
+            std::vector<std::int32_t> previous(size, -1);
+
+            std::size_t i = 0;
+
+            while (i < size)
+            {
+                std::uint32_t bestLength = 0;
+                std::uint32_t bestDistance = 0;
+
+                if (i + MIN_MATCH <= size)
+                {
+                    std::uint32_t hash = HashBytes(&data[i]);
+                    std::int32_t candidate = head[hash];
+                    std::uint32_t maxLength = static_cast<std::uint32_t>(std::min<std::size_t>(MAX_MATCH, size - i));
+
+                    for (std::uint32_t chain = 0; candidate >= 0 && i - candidate <= WINDOW_SIZE && chain < MAX_CHAIN; ++chain)
+                    {
+                        std::uint32_t length = 0;
+
+                        while (length < maxLength && data[candidate + length] == data[i + length])
+                        {
+                            ++length;
+                        }
+
+                        if (length > bestLength)
+                        {
+                            bestLength = length;
+                            bestDistance = static_cast<std::uint32_t>(i - candidate);
+
+                            if (length == maxLength)
+                            {
+                                break;
+                            }
+                        }
+
+                        candidate = previous[candidate];
+                    }
+
+                    previous[i] = head[hash];
+                    head[hash] = static_cast<std::int32_t>(i);
+                }
+
+                if (bestLength >= MIN_MATCH)
+                {
+                    WriteMatch(writer, bestLength, bestDistance);
+
+                    for (std::size_t j = i + 1; j < i + bestLength && j + MIN_MATCH <= size; ++j)
+                    {
+                        std::uint32_t hash = HashBytes(&data[j]);
+                        previous[j] = head[hash];
+                        head[hash] = static_cast<std::int32_t>(j);
+                    }
+
+                    i += bestLength;
+                }
+                else
+                {
+                    WriteLiteral(writer, data[i]);
+                    ++i;
+                }
+            }
+
+            WriteLiteral(writer, 256);
+            writer.Flush();
+
+            // Stored blocks cost five header bytes per 64K, with at least one block even for no data.
+            std::size_t storedSize = size + 5 * std::max<std::size_t>(1, (size + MAX_STORED_BLOCK - 1) / MAX_STORED_BLOCK);
+
+            if (output.size() - 2 > storedSize)
+            {
+                output.resize(2);
+                std::size_t offset = 0;
+
+                do
+                {
+                    std::size_t length = std::min(MAX_STORED_BLOCK, size - offset);
+
+                    output.push_back(offset + length == size ? 1 : 0); // Final flag, stored type, padded to the byte
+                    output.push_back(static_cast<std::uint8_t>(length));
+                    output.push_back(static_cast<std::uint8_t>(length >> 8));
+                    output.push_back(static_cast<std::uint8_t>(~length));
+                    output.push_back(static_cast<std::uint8_t>(~length >> 8));
+                    output.insert(output.end(), data.begin() + offset, data.begin() + offset + length);
+
+                    offset += length;
+                }
+                while (offset < size);
+            }
+
+            std::uint32_t a = 1;
+            std::uint32_t b = 0;
+
+            for (std::uint8_t byte : data)
+            {
+                a = (a + byte) % 65521;
+                b = (b + a) % 65521;
+            }
+
+            std::uint32_t adler = (b << 16) | a;
+
+            for (int shift = 24; shift >= 0; shift -= 8)
+            {
+                output.push_back(static_cast<std::uint8_t>(adler >> shift));
+            }
+        }
+
+        static std::uint32_t UpdateCRC(std::uint32_t crc, const std::uint8_t* data, std::size_t size) noexcept
+        {
+            static const std::uint32_t* table = []()
+            {
+                static std::uint32_t values[256];
+
+                for (std::uint32_t i = 0; i < 256; ++i)
+                {
+                    std::uint32_t value = i;
+
+                    for (int k = 0; k < 8; ++k)
+                    {
+                        value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+                    }
+
+                    values[i] = value;
+                }
+
+                return values;
+            }();
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+            }
+
+            return crc;
+        }
+
+        static void WriteU32(std::vector<std::uint8_t>& output, std::uint32_t value)
+        {
+            for (int shift = 24; shift >= 0; shift -= 8)
+            {
+                output.push_back(static_cast<std::uint8_t>(value >> shift));
+            }
+        }
+
+        static void WriteChunk(std::vector<std::uint8_t>& output, const char* type, const std::vector<std::uint8_t>& data)
+        {
+            WriteU32(output, static_cast<std::uint32_t>(data.size()));
+
+            std::size_t start = output.size();
+            output.insert(output.end(), type, type + 4);
+            output.insert(output.end(), data.begin(), data.end());
+
+            WriteU32(output, UpdateCRC(0xFFFFFFFFu, &output[start], output.size() - start) ^ 0xFFFFFFFFu);
+        }
+
+        static std::uint8_t Paeth(std::uint8_t a, std::uint8_t b, std::uint8_t c) noexcept
+        {
+            int p = a + b - c;
+            int pa = std::abs(p - a);
+            int pb = std::abs(p - b);
+            int pc = std::abs(p - c);
+
+            if (pa <= pb && pa <= pc)
+            {
+                return a;
+            }
+
+            return pb <= pc ? b : c;
+        }
+
+        std::vector<std::uint8_t> EncodePNG(std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels)
+        {
+            // Filtering
+            // Each row takes whichever filter leaves the smallest residuals, the usual libpng heuristic.
+
+            std::size_t stride = static_cast<std::size_t>(width) * BYTES_PER_PIXEL;
+            std::vector<std::uint8_t> filtered((stride + 1) * height);
+            std::vector<std::uint8_t> candidate(stride);
+
+            for (std::uint32_t y = 0; y < height; ++y)
+            {
+                const std::uint8_t* row = pixels + y * stride;
+                const std::uint8_t* above = y > 0 ? row - stride : nullptr;
+                std::uint8_t* output = &filtered[y * (stride + 1)];
+
+                std::uint64_t bestScore = UINT64_MAX;
+
+                for (std::uint8_t filter = 0; filter < 5; ++filter)
+                {
+                    std::uint64_t score = 0;
+
+                    for (std::size_t x = 0; x < stride; ++x)
+                    {
+                        std::uint8_t left = x >= BYTES_PER_PIXEL ? row[x - BYTES_PER_PIXEL] : 0;
+                        std::uint8_t up = above ? above[x] : 0;
+                        std::uint8_t upLeft = above && x >= BYTES_PER_PIXEL ? above[x - BYTES_PER_PIXEL] : 0;
+                        std::uint8_t predicted;
+
+                        switch (filter)
+                        {
+                            case 0: predicted = 0; break;
+                            case 1: predicted = left; break;
+                            case 2: predicted = up; break;
+                            case 3: predicted = static_cast<std::uint8_t>((left + up) / 2); break;
+                            default: predicted = Paeth(left, up, upLeft); break;
+                        }
+
+                        candidate[x] = static_cast<std::uint8_t>(row[x] - predicted);
+                        score += std::abs(static_cast<std::int8_t>(candidate[x]));
+                    }
+
+                    if (score < bestScore)
+                    {
+                        bestScore = score;
+                        output[0] = filter;
+                        std::copy(candidate.begin(), candidate.end(), output + 1);
+                    }
+                }
+            }
+
+            // Chunks
+
+            std::vector<std::uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+            std::vector<std::uint8_t> header;
+            WriteU32(header, width);
+            WriteU32(header, height);
+            header.push_back(8); // Bit depth
+            header.push_back(6); // RGBA
+            header.push_back(0); // Deflate
+            header.push_back(0); // Adaptive filtering
+            header.push_back(0); // No interlacing
+            WriteChunk(png, "IHDR", header);
+
+            std::vector<std::uint8_t> compressed;
+            Compress(filtered, compressed);
+            WriteChunk(png, "IDAT", compressed);
+
+            WriteChunk(png, "IEND", { });
+
+            return png;
+        }
+
+        void WritePNG(const std::string& path, std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels)
+        {
+            std::vector<std::uint8_t> png = EncodePNG(width, height, pixels);
+            WriteRaw(path, png.data(), png.size());
+        }
+
+        void WriteRaw(const std::string& path, const std::uint8_t* data, std::size_t size)
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+            if (!file || !file.write(reinterpret_cast<const char*>(data), size))
+            {
+                throw std::runtime_error("Failed to write image file.");
+            }
+        }
+    }
+}
\ No newline at end of file
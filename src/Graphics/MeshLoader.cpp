@@ -0,0 +1,850 @@
+#include "WackyEngine/Graphics/MeshLoader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Graphics/MeshOptimiser.h"
+
+namespace WackyEngine
+{
+    static std::string ReadFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::ate | std::ios::binary);
+
+        if (!file)
+        {
+            throw std::runtime_error("Failed to open mesh file.");
+        }
+
+        std::string contents(static_cast<std::size_t>(file.tellg()), '\0');
+        file.seekg(0);
+        file.read(contents.data(), contents.size());
+
+        return contents;
+    }
+
+    // Processing
+
+    static std::uint32_t HashVertex(const Vertex& vertex) noexcept
+    {
+        // FNV-1a over the raw bytes, Vertex has no padding so equal vertices hash equally.
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&vertex);
+        std::uint32_t hash = 2166136261u;
+
+        for (std::size_t i = 0; i < sizeof(Vertex); ++i)
+        {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+
+        return hash;
+    }
+
+    // Merges identical vertices and drops triangles that collapse as a result.
+    static void Weld(MeshData& mesh)
+    {
+        static_assert(sizeof(Vertex) == sizeof(float) * 8 + sizeof(std::uint32_t), "Vertex has padding, byte hashing would miss duplicates.");
+
+        std::size_t tableSize = 16;
+
+        while (tableSize < mesh.Vertices.size() * 2)
+        {
+            tableSize *= 2;
+        }
+
+        // Open addressing table of indices into the welded vertices.
+        constexpr std::uint32_t EMPTY = 0xFFFFFFFFu;
+        std::vector<std::uint32_t> table(tableSize, EMPTY);
+        std::vector<std::uint32_t> remap(mesh.Vertices.size());
+        std::vector<Vertex> unique;
+        unique.reserve(mesh.Vertices.size());
+
+        for (std::size_t i = 0; i < mesh.Vertices.size(); ++i)
+        {
+            const Vertex& vertex = mesh.Vertices[i];
+            std::size_t slot = HashVertex(vertex) & (tableSize - 1);
+
+            while (table[slot] != EMPTY && std::memcmp(&unique[table[slot]], &vertex, sizeof(Vertex)) != 0)
+            {
+                slot = (slot + 1) & (tableSize - 1);
+            }
+
+            if (table[slot] == EMPTY)
+            {
+                table[slot] = static_cast<std::uint32_t>(unique.size());
+                unique.push_back(vertex);
+            }
+
+            remap[i] = table[slot];
+        }
+
+        std::size_t written = 0;
+
+        for (std::size_t i = 0; i + 2 < mesh.Indices.size(); i += 3)
+        {
+            std::uint32_t a = remap[mesh.Indices[i]];
+            std::uint32_t b = remap[mesh.Indices[i + 1]];
+            std::uint32_t c = remap[mesh.Indices[i + 2]];
+
+            if (a != b && b != c && c != a)
+            {
+                mesh.Indices[written++] = a;
+                mesh.Indices[written++] = b;
+                mesh.Indices[written++] = c;
+            }
+        }
+
+        mesh.Indices.resize(written);
+        mesh.Vertices.swap(unique);
+    }
+
+    static void Process(MeshData& mesh)
+    {
+        Weld(mesh);
+        MeshOptimiser::OptimiseVertexCache(mesh.Indices, mesh.Vertices.size());
+        MeshOptimiser::OptimiseOverdraw(mesh.Indices, mesh.Vertices);
+        MeshOptimiser::OptimiseVertexFetch(mesh.Vertices, mesh.Indices);
+    }
+
+    // OBJ
+
+    static const char* SkipSpaces(const char* it) noexcept
+    {
+        while (*it == ' ' || *it == '\t' || *it == '\r')
+        {
+            ++it;
+        }
+
+        return it;
+    }
+
+    static const char* ReadFloats(const char* it, const char* lineEnd, float* values, std::size_t maxCount, std::size_t& count)
+    {
+        count = 0;
+
+        while (count < maxCount)
+        {
+            char* end;
+            float value = std::strtof(it, &end);
+
+            // strtof skips newlines, don't let it take numbers from the next line.
+            if (end == it || end > lineEnd)
+            {
+                break;
+            }
+
+            values[count++] = value;
+            it = end;
+        }
+
+        return it;
+    }
+
+    // OBJ indices are 1-based, negative ones count back from the most recent element.
+    static std::uint32_t ResolveIndex(long index, std::size_t count)
+    {
+        long resolved = index > 0 ? index - 1 : static_cast<long>(count) + index;
+
+        if (index == 0 || resolved < 0 || resolved >= static_cast<long>(count))
+        {
+            throw std::runtime_error("Failed to load mesh, OBJ face index is out of range.");
+        }
+
+        return static_cast<std::uint32_t>(resolved);
+    }
+
+    static std::vector<MeshData> ParseOBJ(const std::string& source)
+    {
+        std::vector<Vector3> positions;
+        std::vector<Vector3> colours;
+        std::vector<Vector2> textureCoordinates;
+
+        std::vector<MeshData> meshes(1);
+
+        // Corners of the face currently being triangulated.
+        std::vector<Vertex> face;
+
+        const char* it = source.c_str();
+
+        while (*it)
+        {
+            it = SkipSpaces(it);
+            const char* lineEnd = std::strchr(it, '\n');
+
+            if (!lineEnd)
+            {
+                lineEnd = it + std::strlen(it);
+            }
+
+            if (it[0] == 'v' && (it[1] == ' ' || it[1] == '\t'))
+            {
+                float values[6];
+                std::size_t count;
+                ReadFloats(it + 2, lineEnd, values, 6, count);
+
+                if (count < 3)
+                {
+                    throw std::runtime_error("Failed to load mesh, OBJ vertex has fewer than three components.");
+                }
+
+                positions.emplace_back(values[0], values[1], values[2]);
+                colours.push_back(count == 6 ? Vector3(values[3], values[4], values[5]) : Vector3::One);
+            }
+            else if (it[0] == 'v' && it[1] == 't')
+            {
+                float values[3] = { 0.0f, 0.0f, 0.0f };
+                std::size_t count;
+                ReadFloats(it + 2, lineEnd, values, 3, count);
+
+                // OBJ puts v = 0 at the bottom of the image, Vulkan samples from the top.
+                textureCoordinates.emplace_back(values[0], 1.0f - values[1]);
+            }
+            else if (it[0] == 'f' && (it[1] == ' ' || it[1] == '\t'))
+            {
+                face.clear();
+                const char* cursor = SkipSpaces(it + 1);
+
+                while (cursor < lineEnd && *cursor != '\n')
+                {
+                    char* end;
+                    long position = std::strtol(cursor, &end, 10);
+
+                    if (end == cursor)
+                    {
+                        break;
+                    }
+
+                    std::uint32_t positionIndex = ResolveIndex(position, positions.size());
+                    Vector2 uv = Vector2::Zero;
+                    cursor = end;
+
+                    if (*cursor == '/')
+                    {
+                        ++cursor;
+
+                        if (*cursor != '/')
+                        {
+                            long texture = std::strtol(cursor, &end, 10);
+                            uv = textureCoordinates[ResolveIndex(texture, textureCoordinates.size())];
+                            cursor = end;
+                        }
+
+                        // Normals aren't part of Vertex, skip over them.
+                        if (*cursor == '/')
+                        {
+                            std::strtol(cursor + 1, &end, 10);
+                            cursor = end;
+                        }
+                    }
+
+                    face.emplace_back(positions[positionIndex], colours[positionIndex], uv);
+                    cursor = SkipSpaces(cursor);
+                }
+
+                if (face.size() < 3)
+                {
+                    throw std::runtime_error("Failed to load mesh, OBJ face has fewer than three vertices.");
+                }
+
+                // Fan triangulation, fine for the convex polygons exporters write.
+                MeshData& mesh = meshes.back();
+
+                for (std::size_t i = 1; i + 1 < face.size(); ++i)
+                {
+                    std::uint32_t first = static_cast<std::uint32_t>(mesh.Vertices.size());
+
+                    mesh.Vertices.push_back(face[0]);
+                    mesh.Vertices.push_back(face[i]);
+                    mesh.Vertices.push_back(face[i + 1]);
+
+                    mesh.Indices.push_back(first);
+                    mesh.Indices.push_back(first + 1);
+                    mesh.Indices.push_back(first + 2);
+                }
+            }
+            else if ((it[0] == 'o' || it[0] == 'g') && (it[1] == ' ' || it[1] == '\t'))
+            {
+                // Objects and groups become separate meshes, a name before any faces just renames the current one.
+                if (!meshes.back().Indices.empty())
+                {
+                    meshes.emplace_back();
+                }
+
+                const char* nameStart = SkipSpaces(it + 1);
+                const char* nameEnd = lineEnd;
+
+                while (nameEnd > nameStart && std::isspace(static_cast<unsigned char>(nameEnd[-1])))
+                {
+                    --nameEnd;
+                }
+
+                meshes.back().Name.assign(nameStart, nameEnd);
+            }
+
+            it = *lineEnd ? lineEnd + 1 : lineEnd;
+        }
+
+        if (meshes.back().Indices.empty())
+        {
+            meshes.pop_back();
+        }
+
+        return meshes;
+    }
+
+    // glTF
+
+    // Just enough JSON for the glTF header: no escapes beyond skipping them, numbers as doubles.
+    struct JsonValue
+    {
+        enum class Type { Null, Boolean, Number, String, Array, Object };
+
+        Type ValueType = Type::Null;
+        double Number = 0.0;
+        std::string String;
+        std::vector<JsonValue> Elements;
+        std::vector<std::pair<std::string, JsonValue>> Members;
+
+        const JsonValue* Find(const char* key) const noexcept
+        {
+            for (const std::pair<std::string, JsonValue>& member : Members)
+            {
+                if (member.first == key)
+                {
+                    return &member.second;
+                }
+            }
+
+            return nullptr;
+        }
+
+        // Counts, offsets and references. Anything but a whole number that fits a GLB's 32-bit sizes is rejected
+        // before the cast, converting a negative or huge double to an integer is undefined.
+        std::size_t GetIndex(const char* key) const
+        {
+            const JsonValue* value = Find(key);
+
+            if (!value)
+            {
+                throw std::runtime_error("Failed to load mesh, glTF property is missing.");
+            }
+
+            if (value->ValueType != Type::Number || !(value->Number >= 0.0 && value->Number <= 4294967295.0) || value->Number != std::floor(value->Number))
+            {
+                throw std::runtime_error("Failed to load mesh, glTF property isn't a valid index.");
+            }
+
+            return static_cast<std::size_t>(value->Number);
+        }
+
+        std::size_t GetIndex(const char* key, std::size_t fallback) const
+        {
+            return Find(key) ? GetIndex(key) : fallback;
+        }
+
+        const JsonValue& At(std::size_t index) const
+        {
+            if (ValueType != Type::Array || index >= Elements.size())
+            {
+                throw std::runtime_error("Failed to load mesh, glTF reference is out of range.");
+            }
+
+            return Elements[index];
+        }
+    };
+
+    class JsonParser
+    {
+    private:
+        const char* m_It;
+        const char* m_End;
+
+        void SkipWhitespace() noexcept
+        {
+            while (m_It < m_End && std::isspace(static_cast<unsigned char>(*m_It)))
+            {
+                ++m_It;
+            }
+        }
+
+        void Expect(char character)
+        {
+            SkipWhitespace();
+
+            if (m_It >= m_End || *m_It != character)
+            {
+                throw std::runtime_error("Failed to load mesh, glTF JSON is malformed.");
+            }
+
+            ++m_It;
+        }
+
+        std::string ParseString()
+        {
+            Expect('"');
+            std::string result;
+
+            while (m_It < m_End && *m_It != '"')
+            {
+                if (*m_It == '\\' && m_It + 1 < m_End)
+                {
+                    ++m_It;
+                }
+
+                result.push_back(*m_It++);
+            }
+
+            Expect('"');
+            return result;
+        }
+
+    public:
+        JsonParser(const char* begin, const char* end) : m_It(begin), m_End(end) { }
+
+        JsonValue Parse()
+        {
+            SkipWhitespace();
+
+            if (m_It >= m_End)
+            {
+                throw std::runtime_error("Failed to load mesh, glTF JSON is malformed.");
+            }
+
+            JsonValue value;
+
+            if (*m_It == '{')
+            {
+                value.ValueType = JsonValue::Type::Object;
+                ++m_It;
+                SkipWhitespace();
+
+                if (m_It < m_End && *m_It == '}')
+                {
+                    ++m_It;
+                    return value;
+                }
+
+                do
+                {
+                    std::string key = ParseString();
+                    Expect(':');
+                    value.Members.emplace_back(std::move(key), Parse());
+                    SkipWhitespace();
+                }
+                while (m_It < m_End && *m_It == ',' && ++m_It);
+
+                Expect('}');
+            }
+            else if (*m_It == '[')
+            {
+                value.ValueType = JsonValue::Type::Array;
+                ++m_It;
+                SkipWhitespace();
+
+                if (m_It < m_End && *m_It == ']')
+                {
+                    ++m_It;
+                    return value;
+                }
+
+                do
+                {
+                    value.Elements.push_back(Parse());
+                    SkipWhitespace();
+                }
+                while (m_It < m_End && *m_It == ',' && ++m_It);
+
+                Expect(']');
+            }
+            else if (*m_It == '"')
+            {
+                value.ValueType = JsonValue::Type::String;
+                value.String = ParseString();
+            }
+            else if (*m_It == 't' || *m_It == 'f' || *m_It == 'n')
+            {
+                value.ValueType = *m_It == 'n' ? JsonValue::Type::Null : JsonValue::Type::Boolean;
+                value.Number = *m_It == 't' ? 1.0 : 0.0;
+
+                while (m_It < m_End && std::isalpha(static_cast<unsigned char>(*m_It)))
+                {
+                    ++m_It;
+                }
+            }
+            else
+            {
+                // The JSON chunk is followed by the binary chunk header, so strtod can't run off the end.
+                char* end;
+                value.ValueType = JsonValue::Type::Number;
+                value.Number = std::strtod(m_It, &end);
+
+                if (end == m_It)
+                {
+                    throw std::runtime_error("Failed to load mesh, glTF JSON is malformed.");
+                }
+
+                m_It = end;
+            }
+
+            return value;
+        }
+    };
+
+    static const JsonValue& GetElement(const JsonValue& gltf, const char* key, std::size_t index)
+    {
+        const JsonValue* array = gltf.Find(key);
+
+        if (!array)
+        {
+            throw std::runtime_error("Failed to load mesh, glTF reference is out of range.");
+        }
+
+        return array->At(index);
+    }
+
+    static constexpr std::uint32_t GLB_MAGIC = 0x46546C67;
+    static constexpr std::uint32_t GLB_CHUNK_JSON = 0x4E4F534A;
+    static constexpr std::uint32_t GLB_CHUNK_BIN = 0x004E4942;
+    static constexpr std::uint32_t GLTF_TRIANGLES = 4;
+
+    static std::uint32_t ReadU32(const std::string& source, std::size_t offset)
+    {
+        if (offset + sizeof(std::uint32_t) > source.size())
+        {
+            throw std::runtime_error("Failed to load mesh, GLB file is truncated.");
+        }
+
+        std::uint32_t value;
+        std::memcpy(&value, source.data() + offset, sizeof(value));
+        return value;
+    }
+
+    // An accessor resolved against its buffer view, with every element known to lie inside the view.
+    struct AccessorView
+    {
+        const char* Data;
+        std::size_t Count;
+        std::size_t Stride;
+        std::size_t ComponentType;
+        std::size_t ComponentSize;
+        std::size_t Components;
+        bool Normalised;
+    };
+
+    static AccessorView ResolveAccessor(const JsonValue& gltf, const std::string& binary, std::size_t index)
+    {
+        const JsonValue& accessor = GetElement(gltf, "accessors", index);
+
+        if (accessor.Find("sparse"))
+        {
+            throw std::runtime_error("Failed to load mesh, sparse glTF accessors aren't supported.");
+        }
+
+        // Without a view the accessor is all zeros, or all sparse values. Neither is useful for geometry.
+        if (!accessor.Find("bufferView"))
+        {
+            throw std::runtime_error("Failed to load mesh, glTF accessor has no buffer view.");
+        }
+
+        AccessorView result;
+        result.Count = accessor.GetIndex("count");
+        result.ComponentType = accessor.GetIndex("componentType");
+
+        const JsonValue* normalised = accessor.Find("normalized");
+        result.Normalised = normalised && normalised->Number != 0.0;
+
+        switch (result.ComponentType)
+        {
+        case 5120: case 5121: result.ComponentSize = 1; break;
+        case 5122: case 5123: result.ComponentSize = 2; break;
+        case 5125: case 5126: result.ComponentSize = 4; break;
+        default: throw std::runtime_error("Failed to load mesh, unknown glTF component type.");
+        }
+
+        const JsonValue* type = accessor.Find("type");
+
+        if (type && type->String == "SCALAR")
+        {
+            result.Components = 1;
+        }
+        else if (type && type->String.size() == 4 && type->String.compare(0, 3, "VEC") == 0 && type->String[3] >= '2' && type->String[3] <= '4')
+        {
+            result.Components = static_cast<std::size_t>(type->String[3] - '0');
+        }
+        else
+        {
+            throw std::runtime_error("Failed to load mesh, unsupported glTF accessor type.");
+        }
+
+        const JsonValue& view = GetElement(gltf, "bufferViews", accessor.GetIndex("bufferView"));
+
+        if (view.GetIndex("buffer") != 0)
+        {
+            throw std::runtime_error("Failed to load mesh, only the GLB binary buffer is supported.");
+        }
+
+        std::size_t viewOffset = view.GetIndex("byteOffset", 0);
+        std::size_t viewLength = view.GetIndex("byteLength");
+        std::size_t accessorOffset = accessor.GetIndex("byteOffset", 0);
+        std::size_t elementSize = result.Components * result.ComponentSize;
+        result.Stride = view.GetIndex("byteStride", elementSize);
+
+        // Like CookedMesh, sizes are compared against what is left past each offset rather than added to it,
+        // and the element count is checked by division, so no sum or product can wrap.
+        if (viewOffset > binary.size() || viewLength > binary.size() - viewOffset || accessorOffset > viewLength || result.Stride < elementSize)
+        {
+            throw std::runtime_error("Failed to load mesh, glTF accessor reads past its buffer.");
+        }
+
+        std::size_t available = viewLength - accessorOffset;
+
+        if (result.Count > 0 && (elementSize > available || result.Count - 1 > (available - elementSize) / result.Stride))
+        {
+            throw std::runtime_error("Failed to load mesh, glTF accessor reads past its buffer.");
+        }
+
+        result.Data = binary.data() + viewOffset + accessorOffset;
+        return result;
+    }
+
+    // Reads an accessor into floats, components components per element. Normalised integers are mapped to [0, 1]
+    // (or [-1, 1]), plain integers are converted as is.
+    static std::vector<float> ReadAccessor(const JsonValue& gltf, const std::string& binary, std::size_t index, std::size_t components)
+    {
+        AccessorView accessor = ResolveAccessor(gltf, binary, index);
+
+        // Count is bounded by the buffer size, so this can't overflow.
+        std::vector<float> result(accessor.Count * components, 0.0f);
+        std::size_t copied = std::min(components, accessor.Components);
+
+        for (std::size_t i = 0; i < accessor.Count; ++i)
+        {
+            const char* element = accessor.Data + i * accessor.Stride;
+
+            for (std::size_t c = 0; c < copied; ++c)
+            {
+                const char* source = element + c * accessor.ComponentSize;
+                float value;
+
+                switch (accessor.ComponentType)
+                {
+                case 5120: { std::int8_t v; std::memcpy(&v, source, 1); value = accessor.Normalised ? std::max(v / 127.0f, -1.0f) : v; break; }
+                case 5121: { std::uint8_t v; std::memcpy(&v, source, 1); value = accessor.Normalised ? v / 255.0f : v; break; }
+                case 5122: { std::int16_t v; std::memcpy(&v, source, 2); value = accessor.Normalised ? std::max(v / 32767.0f, -1.0f) : v; break; }
+                case 5123: { std::uint16_t v; std::memcpy(&v, source, 2); value = accessor.Normalised ? v / 65535.0f : v; break; }
+                case 5125: { std::uint32_t v; std::memcpy(&v, source, 4); value = static_cast<float>(v); break; }
+                default: std::memcpy(&value, source, 4); break;
+                }
+
+                result[i * components + c] = value;
+            }
+        }
+
+        return result;
+    }
+
+    static std::vector<std::uint32_t> ReadIndices(const JsonValue& gltf, const std::string& binary, std::size_t index)
+    {
+        // Indices are at most 32-bit so the float path would lose precision above 2^24, read them directly.
+        AccessorView accessor = ResolveAccessor(gltf, binary, index);
+
+        if (accessor.Components != 1 || (accessor.ComponentType != 5121 && accessor.ComponentType != 5123 && accessor.ComponentType != 5125))
+        {
+            throw std::runtime_error("Failed to load mesh, glTF indices must be unsigned integer scalars.");
+        }
+
+        std::vector<std::uint32_t> indices(accessor.Count, 0);
+
+        for (std::size_t i = 0; i < accessor.Count; ++i)
+        {
+            std::memcpy(&indices[i], accessor.Data + i * accessor.Stride, accessor.ComponentSize);
+        }
+
+        return indices;
+    }
+
+    static std::vector<MeshData> ParseGLB(const std::string& source)
+    {
+        if (ReadU32(source, 0) != GLB_MAGIC || ReadU32(source, 4) != 2)
+        {
+            throw std::runtime_error("Failed to load mesh, not a glTF 2.0 binary file.");
+        }
+
+        std::uint32_t jsonLength = ReadU32(source, 12);
+
+        if (ReadU32(source, 16) != GLB_CHUNK_JSON || 20 + static_cast<std::size_t>(jsonLength) > source.size())
+        {
+            throw std::runtime_error("Failed to load mesh, GLB JSON chunk is missing.");
+        }
+
+        JsonValue gltf = JsonParser(source.data() + 20, source.data() + 20 + jsonLength).Parse();
+
+        std::string binary;
+        std::size_t binaryChunk = 20 + jsonLength;
+
+        if (binaryChunk + 8 <= source.size() && ReadU32(source, binaryChunk + 4) == GLB_CHUNK_BIN)
+        {
+            std::size_t binaryLength = std::min<std::size_t>(ReadU32(source, binaryChunk), source.size() - binaryChunk - 8);
+            binary.assign(source.data() + binaryChunk + 8, binaryLength);
+        }
+
+        std::vector<MeshData> meshes;
+        const JsonValue* gltfMeshes = gltf.Find("meshes");
+
+        if (!gltfMeshes)
+        {
+            return meshes;
+        }
+
+        for (std::size_t m = 0; m < gltfMeshes->Elements.size(); ++m)
+        {
+            const JsonValue& gltfMesh = gltfMeshes->Elements[m];
+            const JsonValue* name = gltfMesh.Find("name");
+            const JsonValue* primitives = gltfMesh.Find("primitives");
+
+            MeshData mesh;
+            mesh.Name = name ? name->String : "mesh" + std::to_string(m);
+
+            // Every triangle primitive of a mesh goes into the one MeshData, materials aren't tracked.
+            for (std::size_t p = 0; primitives && p < primitives->Elements.size(); ++p)
+            {
+                const JsonValue& primitive = primitives->Elements[p];
+                const JsonValue* attributes = primitive.Find("attributes");
+
+                if (primitive.GetIndex("mode", GLTF_TRIANGLES) != GLTF_TRIANGLES || !attributes || !attributes->Find("POSITION"))
+                {
+                    continue;
+                }
+
+                std::vector<float> positions = ReadAccessor(gltf, binary, attributes->GetIndex("POSITION", 0), 3);
+                std::size_t vertexCount = positions.size() / 3;
+
+                std::vector<float> colours;
+                std::vector<float> textureCoordinates;
+
+                if (attributes->Find("COLOR_0"))
+                {
+                    colours = ReadAccessor(gltf, binary, attributes->GetIndex("COLOR_0", 0), 3);
+                }
+
+                if (attributes->Find("TEXCOORD_0"))
+                {
+                    textureCoordinates = ReadAccessor(gltf, binary, attributes->GetIndex("TEXCOORD_0", 0), 2);
+                }
+
+                std::uint32_t base = static_cast<std::uint32_t>(mesh.Vertices.size());
+
+                for (std::size_t i = 0; i < vertexCount; ++i)
+                {
+                    Vector3 colour = i * 3 + 2 < colours.size() ? Vector3(colours[i * 3], colours[i * 3 + 1], colours[i * 3 + 2]) : Vector3::One;
+                    Vector2 uv = i * 2 + 1 < textureCoordinates.size() ? Vector2(textureCoordinates[i * 2], textureCoordinates[i * 2 + 1]) : Vector2::Zero;
+
+                    mesh.Vertices.emplace_back(Vector3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]), colour, uv);
+                }
+
+                if (primitive.Find("indices"))
+                {
+                    std::vector<std::uint32_t> indices = ReadIndices(gltf, binary, primitive.GetIndex("indices", 0));
+
+                    for (std::uint32_t index : indices)
+                    {
+                        if (index >= vertexCount)
+                        {
+                            throw std::runtime_error("Failed to load mesh, glTF index is out of range.");
+                        }
+
+                        mesh.Indices.push_back(base + index);
+                    }
+                }
+                else
+                {
+                    for (std::size_t i = 0; i < vertexCount; ++i)
+                    {
+                        mesh.Indices.push_back(base + static_cast<std::uint32_t>(i));
+                    }
+                }
+
+                mesh.Indices.resize(mesh.Indices.size() - mesh.Indices.size() % 3);
+            }
+
+            if (!mesh.Indices.empty())
+            {
+                meshes.push_back(std::move(mesh));
+            }
+        }
+
+        return meshes;
+    }
+
+    // Mesh Loader
+
+    std::vector<MeshData> MeshLoader::LoadData(const std::string& path, JobSystem* jobSystem)
+    {
+        std::string extension = path.substr(path.find_last_of('.') + 1);
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        std::vector<MeshData> meshes;
+
+        if (extension == "obj")
+        {
+            meshes = ParseOBJ(ReadFile(path));
+        }
+        else if (extension == "glb")
+        {
+            meshes = ParseGLB(ReadFile(path));
+        }
+        else
+        {
+            throw std::runtime_error("Failed to load mesh, unsupported file type.");
+        }
+
+        // Parsing validates every index, anything else a worker throws (bad_alloc) comes back out of WaitForCounter.
+        if (jobSystem && meshes.size() > 1)
+        {
+            MeshData* data = meshes.data();
+            JobCounter counter;
+
+            jobSystem->ParallelFor(counter, static_cast<std::uint32_t>(meshes.size()), 1, [data](std::uint32_t begin, std::uint32_t end)
+            {
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    Process(data[i]);
+                }
+            });
+
+            jobSystem->WaitForCounter(counter);
+        }
+        else
+        {
+            for (MeshData& mesh : meshes)
+            {
+                Process(mesh);
+            }
+        }
+
+        return meshes;
+    }
+
+    std::vector<Model*> MeshLoader::Load(const std::string& path)
+    {
+        std::vector<MeshData> meshes = LoadData(path, Context::GetJobSystem());
+
+        std::vector<Model*> models;
+        models.reserve(meshes.size());
+
+        // Each mesh's CPU data is released as soon as it is uploaded, models don't keep a copy.
+        for (MeshData& mesh : meshes)
+        {
+            models.push_back(new Model(mesh.Vertices, mesh.Indices));
+            mesh = MeshData();
+        }
+
+        return models;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,435 @@
+#include "WackyEngine/Graphics/MeshOptimiser.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace WackyEngine
+{
+    namespace MeshOptimiser
+    {
+        static constexpr float CACHE_DECAY_POWER = 1.5f;
+        static constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+        static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+        static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+        static constexpr std::uint32_t INVALID_TRIANGLE = std::numeric_limits<std::uint32_t>::max();
+
+        // The last triangle's vertices score a flat amount so the next triangle isn't biased to one edge of it.
+        // Vertices with few triangles left get a boost, finishing them off before they fall out of the cache.
+        static float GetVertexScore(int cachePosition, std::uint32_t remainingTriangles) noexcept
+        {
+            if (remainingTriangles == 0)
+            {
+                return -1.0f;
+            }
+
+            float score = 0.0f;
+
+            if (cachePosition >= 0)
+            {
+                if (cachePosition < 3)
+                {
+                    score = LAST_TRIANGLE_SCORE;
+                }
+                else
+                {
+                    float scaler = 1.0f / (CACHE_SIZE - 3);
+                    score = std::pow(1.0f - (cachePosition - 3) * scaler, CACHE_DECAY_POWER);
+                }
+            }
+
+            return score + VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTriangles), -VALENCE_BOOST_POWER);
+        }
+
+        void OptimiseVertexCache(std::vector<std::uint32_t>& indices, std::size_t vertexCount)
+        {
+            std::size_t triangleCount = indices.size() / 3;
+
+            if (triangleCount == 0)
+            {
+                return;
+            }
+
+            // Vertex To Triangle Adjacency
+            // Each vertex's live triangles sit at the front of its range, added ones are swapped out past the remaining count.
+
+            std::vector<std::uint32_t> remaining(vertexCount, 0);
+            std::vector<std::uint32_t> offsets(vertexCount + 1, 0);
+            std::vector<std::uint32_t> adjacency(triangleCount * 3);
+
+            for (std::uint32_t index : indices)
+            {
+                ++remaining[index];
+            }
+
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                offsets[i + 1] = offsets[i] + remaining[i];
+            }
+
+            {
+                std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+
+                for (std::size_t i = 0; i < triangleCount * 3; ++i)
+                {
+                    adjacency[fill[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+                }
+            }
+
+            // Initial Scores
+
+            std::vector<int> cachePositions(vertexCount, -1);
+            std::vector<float> vertexScores(vertexCount);
+            std::vector<float> triangleScores(triangleCount, 0.0f);
+            std::vector<bool> added(triangleCount, false);
+
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                vertexScores[i] = GetVertexScore(-1, remaining[i]);
+            }
+
+            std::uint32_t bestTriangle = 0;
+
+            for (std::size_t i = 0; i < triangleCount; ++i)
+            {
+                triangleScores[i] = vertexScores[indices[i * 3]] + vertexScores[indices[i * 3 + 1]] + vertexScores[indices[i * 3 + 2]];
+
+                if (triangleScores[i] > triangleScores[bestTriangle])
+                {
+                    bestTriangle = static_cast<std::uint32_t>(i);
+                }
+            }
+
+            // Triangle Selection
+
+            std::vector<std::uint32_t> result;
+            result.reserve(indices.size());
+
+            // Room for a full cache plus the three vertices pushing into it.
+            std::uint32_t cache[CACHE_SIZE + 3];
+            std::uint32_t newCache[CACHE_SIZE + 3];
+            std::uint32_t cacheCount = 0;
+
+            std::size_t scanCursor = 0;
+
+            for (std::size_t emitted = 0; emitted < triangleCount; ++emitted)
+            {
+                // Nothing in the cache touches a live triangle, restart from the next unadded one in input order.
+                if (bestTriangle == INVALID_TRIANGLE)
+                {
+                    while (added[scanCursor])
+                    {
+                        ++scanCursor;
+                    }
+
+                    bestTriangle = static_cast<std::uint32_t>(scanCursor);
+                }
+
+                added[bestTriangle] = true;
+
+                const std::uint32_t* triangle = &indices[bestTriangle * 3];
+                result.insert(result.end(), triangle, triangle + 3);
+
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    std::uint32_t vertex = triangle[k];
+                    std::uint32_t* begin = &adjacency[offsets[vertex]];
+                    std::uint32_t* last = begin + remaining[vertex] - 1;
+
+                    for (std::uint32_t* it = begin; it <= last; ++it)
+                    {
+                        if (*it == bestTriangle)
+                        {
+                            std::swap(*it, *last);
+                            break;
+                        }
+                    }
+
+                    --remaining[vertex];
+                }
+
+                // Cache Update
+                // The triangle's vertices move to the front, everything else shifts back and may fall out the end.
+
+                std::uint32_t newCount = 0;
+
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    newCache[newCount++] = triangle[k];
+                }
+
+                for (std::uint32_t i = 0; i < cacheCount; ++i)
+                {
+                    std::uint32_t vertex = cache[i];
+
+                    if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2])
+                    {
+                        newCache[newCount++] = vertex;
+                    }
+                }
+
+                // Rescoring
+                // Only vertices that moved in the cache change score, and only their live triangles need updating.
+
+                for (std::uint32_t i = 0; i < newCount; ++i)
+                {
+                    std::uint32_t vertex = newCache[i];
+                    cachePositions[vertex] = i < CACHE_SIZE ? static_cast<int>(i) : -1;
+
+                    float score = GetVertexScore(cachePositions[vertex], remaining[vertex]);
+                    float delta = score - vertexScores[vertex];
+                    vertexScores[vertex] = score;
+
+                    for (std::uint32_t j = 0; j < remaining[vertex]; ++j)
+                    {
+                        triangleScores[adjacency[offsets[vertex] + j]] += delta;
+                    }
+                }
+
+                cacheCount = newCount < CACHE_SIZE ? newCount : CACHE_SIZE;
+
+                bestTriangle = INVALID_TRIANGLE;
+                float bestScore = -1.0f;
+
+                for (std::uint32_t i = 0; i < cacheCount; ++i)
+                {
+                    std::uint32_t vertex = newCache[i];
+                    cache[i] = vertex;
+
+                    for (std::uint32_t j = 0; j < remaining[vertex]; ++j)
+                    {
+                        std::uint32_t candidate = adjacency[offsets[vertex] + j];
+
+                        if (triangleScores[candidate] > bestScore)
+                        {
+                            bestScore = triangleScores[candidate];
+                            bestTriangle = candidate;
+                        }
+                    }
+                }
+            }
+
+            indices.swap(result);
+        }
+
+        void OptimiseOverdraw(std::vector<std::uint32_t>& indices, const std::vector<Vertex>& vertices, float threshold)
+        {
+            std::size_t triangleCount = indices.size() / 3;
+
+            if (triangleCount < 2)
+            {
+                return;
+            }
+
+            // Cluster Boundaries
+            // A triangle missing on all three vertices starts a hard cluster, the cache order has jumped there anyway.
+            // Each hard cluster is then cut wherever the misses since the last cut are within threshold of its own ACMR.
+
+            std::vector<std::uint32_t> loadedAt(vertices.size(), 0);
+            std::uint32_t time = CACHE_SIZE + 1;
+
+            auto countMisses = [&](std::size_t triangle)
+            {
+                std::uint32_t misses = 0;
+
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    std::uint32_t index = indices[triangle * 3 + k];
+
+                    if (time - loadedAt[index] > CACHE_SIZE)
+                    {
+                        loadedAt[index] = time++;
+                        ++misses;
+                    }
+                }
+
+                return misses;
+            };
+
+            std::vector<std::uint32_t> hardBoundaries;
+
+            for (std::size_t i = 0; i < triangleCount; ++i)
+            {
+                if (countMisses(i) == 3)
+                {
+                    hardBoundaries.push_back(static_cast<std::uint32_t>(i));
+                }
+            }
+
+            hardBoundaries.push_back(static_cast<std::uint32_t>(triangleCount));
+
+            std::vector<std::uint32_t> clusters;
+
+            for (std::size_t h = 0; h + 1 < hardBoundaries.size(); ++h)
+            {
+                std::size_t start = hardBoundaries[h];
+                std::size_t end = hardBoundaries[h + 1];
+
+                // Every vertex counts as evicted at the start of a cluster, clusters can end up drawn in any order.
+                time += CACHE_SIZE + 1;
+                std::uint32_t clusterMisses = 0;
+
+                for (std::size_t i = start; i < end; ++i)
+                {
+                    clusterMisses += countMisses(i);
+                }
+
+                float clusterThreshold = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+
+                time += CACHE_SIZE + 1;
+                std::uint32_t runningMisses = 0;
+                std::uint32_t runningTriangles = 0;
+
+                clusters.push_back(static_cast<std::uint32_t>(start));
+
+                for (std::size_t i = start; i < end; ++i)
+                {
+                    runningMisses += countMisses(i);
+                    ++runningTriangles;
+
+                    if (i + 1 < end && static_cast<float>(runningMisses) / static_cast<float>(runningTriangles) <= clusterThreshold)
+                    {
+                        clusters.push_back(static_cast<std::uint32_t>(i + 1));
+
+                        time += CACHE_SIZE + 1;
+                        runningMisses = 0;
+                        runningTriangles = 0;
+                    }
+                }
+            }
+
+            std::size_t clusterCount = clusters.size();
+            clusters.push_back(static_cast<std::uint32_t>(triangleCount));
+
+            // Cluster Sort Keys
+            // Area weighted centroids and normals, the cross product's length is twice the triangle's area.
+
+            std::vector<float> clusterData(clusterCount * 6, 0.0f);
+            float meshCentroid[3] = { 0.0f, 0.0f, 0.0f };
+            float meshArea = 0.0f;
+
+            for (std::size_t c = 0; c < clusterCount; ++c)
+            {
+                float* centroid = &clusterData[c * 6];
+                float* normal = &clusterData[c * 6 + 3];
+                float clusterArea = 0.0f;
+
+                for (std::size_t i = clusters[c]; i < clusters[c + 1]; ++i)
+                {
+                    const Vector3& a = vertices[indices[i * 3]].Position;
+                    const Vector3& b = vertices[indices[i * 3 + 1]].Position;
+                    const Vector3& d = vertices[indices[i * 3 + 2]].Position;
+
+                    Vector3 cross = (b - a).Cross(d - a);
+                    float area = cross.Magnitude();
+
+                    centroid[0] += (a.X + b.X + d.X) / 3.0f * area;
+                    centroid[1] += (a.Y + b.Y + d.Y) / 3.0f * area;
+                    centroid[2] += (a.Z + b.Z + d.Z) / 3.0f * area;
+
+                    normal[0] += cross.X;
+                    normal[1] += cross.Y;
+                    normal[2] += cross.Z;
+
+                    clusterArea += area;
+                }
+
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    meshCentroid[k] += centroid[k];
+                    centroid[k] = clusterArea > 0.0f ? centroid[k] / clusterArea : 0.0f;
+                }
+
+                meshArea += clusterArea;
+            }
+
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                meshCentroid[k] = meshArea > 0.0f ? meshCentroid[k] / meshArea : 0.0f;
+            }
+
+            std::vector<std::pair<float, std::uint32_t>> order(clusterCount);
+
+            for (std::size_t c = 0; c < clusterCount; ++c)
+            {
+                const float* centroid = &clusterData[c * 6];
+                const float* normal = &clusterData[c * 6 + 3];
+
+                float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+                float key = 0.0f;
+
+                if (length > 0.0f)
+                {
+                    key = ((centroid[0] - meshCentroid[0]) * normal[0] + (centroid[1] - meshCentroid[1]) * normal[1] + (centroid[2] - meshCentroid[2]) * normal[2]) / length;
+                }
+
+                order[c] = { key, static_cast<std::uint32_t>(c) };
+            }
+
+            // Highest key first, ties keep the cache order.
+            std::sort(order.begin(), order.end(), [](const std::pair<float, std::uint32_t>& first, const std::pair<float, std::uint32_t>& second)
+            {
+                return first.first != second.first ? first.first > second.first : first.second < second.second;
+            });
+
+            std::vector<std::uint32_t> result;
+            result.reserve(indices.size());
+
+            for (const std::pair<float, std::uint32_t>& cluster : order)
+            {
+                result.insert(result.end(), indices.begin() + clusters[cluster.second] * 3, indices.begin() + clusters[cluster.second + 1] * 3);
+            }
+
+            // A trailing partial triangle isn't part of any cluster, keep it at the end as the other passes do.
+            result.insert(result.end(), indices.begin() + triangleCount * 3, indices.end());
+
+            indices.swap(result);
+        }
+
+        void OptimiseVertexFetch(std::vector<Vertex>& vertices, std::vector<std::uint32_t>& indices)
+        {
+            std::vector<std::uint32_t> remap(vertices.size(), std::numeric_limits<std::uint32_t>::max());
+            std::vector<Vertex> reordered;
+            reordered.reserve(vertices.size());
+
+            for (std::uint32_t& index : indices)
+            {
+                if (remap[index] == std::numeric_limits<std::uint32_t>::max())
+                {
+                    remap[index] = static_cast<std::uint32_t>(reordered.size());
+                    reordered.push_back(vertices[index]);
+                }
+
+                index = remap[index];
+            }
+
+            vertices.swap(reordered);
+        }
+
+        float GetACMR(const std::vector<std::uint32_t>& indices, std::size_t vertexCount, std::uint32_t cacheSize)
+        {
+            if (indices.size() < 3)
+            {
+                return 0.0f;
+            }
+
+            // A vertex is still cached if fewer than cacheSize misses happened since it was loaded.
+            std::vector<std::uint32_t> loadedAt(vertexCount, 0);
+            std::uint32_t time = cacheSize + 1;
+            std::uint32_t misses = 0;
+
+            for (std::uint32_t index : indices)
+            {
+                if (time - loadedAt[index] > cacheSize)
+                {
+                    loadedAt[index] = time++;
+                    ++misses;
+                }
+            }
+
+            return static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+        }
+    }
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "WackyEngine/Graphics/Model.h"
 
 #include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Graphics/CookedMesh.h"
 
 namespace WackyEngine
 {
@@ -56,7 +57,51 @@ namespace WackyEngine
         return new Model(vertices, indices);
     }
 
-    Model::Model(const std::vector<Vertex>& vertices, const std::vector<std::uint16_t> indices) : m_VertexCount(vertices.size()), m_IndexCount(indices.size())
+    Model::Model(const std::vector<Vertex>& vertices, const std::vector<std::uint16_t>& indices)
+        : Model(vertices, std::vector<std::uint32_t>(indices.begin(), indices.end()))
+    {
+    }
+
+    Model::Model(const std::vector<Vertex>& vertices, const std::vector<std::uint32_t>& indices)
+        : m_VertexCount(vertices.size()), m_IndexCount(indices.size())
+    {
+        Upload(vertices, indices);
+    }
+
+    Model::Model(const CookedMeshHeader& header, const std::byte* data)
+        : m_IndexType(header.IndexSize == sizeof(std::uint16_t) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32),
+          m_VertexCount(header.VertexCount), m_IndexCount(header.IndexCount)
+    {
+        // Both blobs go through one staging buffer and one submit, the index blob's offset
+        // from the vertex blob carries over into the staging buffer as is.
+        VkDeviceSize vertexSize = static_cast<VkDeviceSize>(header.VertexStride) * header.VertexCount;
+        VkDeviceSize indexSize = static_cast<VkDeviceSize>(header.IndexSize) * header.IndexCount;
+        VkDeviceSize indexStart = header.IndexOffset - header.VertexOffset;
+
+        m_VertexBuffer = new Buffer(vertexSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        m_IndexBuffer = new Buffer(indexSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        Buffer stagingBuffer(indexStart + indexSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        stagingBuffer.SetData(data + header.VertexOffset, indexStart + indexSize);
+
+        VkCommandBuffer cmdBuffer = Context::GetDevice()->BeginSingleTimeCommands();
+
+        VkBufferCopy vertexRegion { };
+        vertexRegion.srcOffset = 0;
+        vertexRegion.dstOffset = 0;
+        vertexRegion.size = vertexSize;
+        vkCmdCopyBuffer(cmdBuffer, stagingBuffer.GetBufferObject(), m_VertexBuffer->GetBufferObject(), 1, &vertexRegion);
+
+        VkBufferCopy indexRegion { };
+        indexRegion.srcOffset = indexStart;
+        indexRegion.dstOffset = 0;
+        indexRegion.size = indexSize;
+        vkCmdCopyBuffer(cmdBuffer, stagingBuffer.GetBufferObject(), m_IndexBuffer->GetBufferObject(), 1, &indexRegion);
+
+        Context::GetDevice()->EndSingleTimeCommands(cmdBuffer);
+    }
+
+    void Model::Upload(const std::vector<Vertex>& vertices, const std::vector<std::uint32_t>& indices)
     {
         // Vertex Buffer
 
@@ -65,18 +110,40 @@ namespace WackyEngine
         m_VertexBuffer = new Buffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
         Buffer* stagingBuffer = new Buffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
-        stagingBuffer->SetData((void*)vertices.data(), (size_t)bufferSize);
+        stagingBuffer->SetData(vertices.data(), (size_t)bufferSize);
         m_VertexBuffer->CopyBuffer(*stagingBuffer, bufferSize);
 
         // Index Buffer
+        // Halves the index bandwidth for anything under 65536 vertices, which is most meshes.
 
-        bufferSize = sizeof(std::uint16_t) * indices.size();
+        m_IndexType = m_VertexCount <= 65536 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+
+        std::vector<std::uint16_t> shortIndices;
+
+        if (m_IndexType == VK_INDEX_TYPE_UINT16)
+        {
+            shortIndices.assign(indices.begin(), indices.end());
+            bufferSize = sizeof(std::uint16_t) * shortIndices.size();
+        }
+        else
+        {
+            bufferSize = sizeof(std::uint32_t) * indices.size();
+        }
 
         m_IndexBuffer = new Buffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
         delete stagingBuffer;
         stagingBuffer = new Buffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-        stagingBuffer->SetData((void*)indices.data(), bufferSize);
+
+        if (m_IndexType == VK_INDEX_TYPE_UINT16)
+        {
+            stagingBuffer->SetData(shortIndices.data(), bufferSize);
+        }
+        else
+        {
+            stagingBuffer->SetData(indices.data(), bufferSize);
+        }
+
         m_IndexBuffer->CopyBuffer(*stagingBuffer, bufferSize);
         
         delete stagingBuffer;
@@ -93,7 +160,7 @@ namespace WackyEngine
         VkBuffer vertexBuffers[] = { m_VertexBuffer->GetBufferObject() };
         VkDeviceSize offsets[] = { 0 };
         vkCmdBindVertexBuffers(buffer, 0, 1, vertexBuffers, offsets);
-        vkCmdBindIndexBuffer(buffer, m_IndexBuffer->GetBufferObject(), 0, VK_INDEX_TYPE_UINT16);
+        vkCmdBindIndexBuffer(buffer, m_IndexBuffer->GetBufferObject(), 0, m_IndexType);
     }
 
     void Model::Draw(VkCommandBuffer buffer) const noexcept
@@ -0,0 +1,237 @@
+#include "WackyEngine/Graphics/OffscreenTarget.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "WackyEngine/Core/Context.h"
+
+namespace WackyEngine
+{
+    OffscreenTarget::OffscreenTarget(VkExtent2D extent)
+        : m_LastImage(UINT32_MAX), m_Extent(extent), m_ReadbackBuffer(nullptr)
+    {
+        if (extent.width == 0 || extent.height == 0)
+        {
+            throw std::runtime_error("Failed to create offscreen target, extent is empty.");
+        }
+
+        m_FramesInFlight = Context::GetGraphicsInformation().FramesInFlight;
+        m_DepthFormat = Context::GetGraphicsInformation().DepthBuffer ? Context::GetDevice()->SelectDepthFormat() : VK_FORMAT_UNDEFINED;
+        m_FrameTimelineValues.assign(m_FramesInFlight, 0);
+
+        m_RenderPass = RenderPass::CreateSimplePass(FORMAT, m_DepthFormat, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+        InitialiseImages();
+        InitialiseDepthResources();
+        InitialiseFramebuffers();
+    }
+
+    OffscreenTarget::~OffscreenTarget()
+    {
+        delete m_RenderPass;
+        delete m_ReadbackBuffer;
+
+        for (std::size_t i = 0; i < m_Images.size(); ++i)
+        {
+            vkDestroyFramebuffer(Context::GetDevice()->GetLogicalDevice(), m_Framebuffers[i], nullptr);
+            vkDestroyImageView(Context::GetDevice()->GetLogicalDevice(), m_ImageViews[i], nullptr);
+            vkDestroyImage(Context::GetDevice()->GetLogicalDevice(), m_Images[i], nullptr);
+            vkFreeMemory(Context::GetDevice()->GetLogicalDevice(), m_ImageMemory[i], nullptr);
+        }
+
+        if (m_DepthImageView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(Context::GetDevice()->GetLogicalDevice(), m_DepthImageView, nullptr);
+            vkDestroyImage(Context::GetDevice()->GetLogicalDevice(), m_DepthImage, nullptr);
+            vkFreeMemory(Context::GetDevice()->GetLogicalDevice(), m_DepthMemory, nullptr);
+        }
+    }
+
+    void OffscreenTarget::InitialiseImages()
+    {
+        m_Images.resize(m_FramesInFlight);
+        m_ImageMemory.resize(m_FramesInFlight);
+        m_ImageViews.resize(m_FramesInFlight);
+
+        for (std::size_t i = 0; i < m_FramesInFlight; ++i)
+        {
+            Context::GetDevice()->CreateImage(m_Extent.width, m_Extent.height, FORMAT, VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_Images[i], m_ImageMemory[i]);
+
+            VkImageViewCreateInfo viewInfo { };
+            viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            viewInfo.image = m_Images[i];
+            viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            viewInfo.format = FORMAT;
+            viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            viewInfo.subresourceRange.baseMipLevel = 0;
+            viewInfo.subresourceRange.levelCount = 1;
+            viewInfo.subresourceRange.baseArrayLayer = 0;
+            viewInfo.subresourceRange.layerCount = 1;
+
+            if (vkCreateImageView(Context::GetDevice()->GetLogicalDevice(), &viewInfo, nullptr, &m_ImageViews[i]) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create image view.");
+            }
+        }
+
+        m_ReadbackBuffer = new Buffer(GetImageSize(), VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
+
+    void OffscreenTarget::InitialiseDepthResources()
+    {
+        if (m_DepthFormat == VK_FORMAT_UNDEFINED)
+        {
+            return;
+        }
+
+        Context::GetDevice()->CreateImage(m_Extent.width, m_Extent.height, m_DepthFormat, VK_IMAGE_TILING_OPTIMAL,
+            VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_DepthImage, m_DepthMemory);
+
+        VkImageViewCreateInfo viewInfo { };
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_DepthImage;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = m_DepthFormat;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(Context::GetDevice()->GetLogicalDevice(), &viewInfo, nullptr, &m_DepthImageView) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create depth image view.");
+        }
+    }
+
+    void OffscreenTarget::InitialiseFramebuffers()
+    {
+        m_Framebuffers.resize(m_ImageViews.size());
+
+        for (std::size_t i = 0; i < m_ImageViews.size(); ++i)
+        {
+            VkImageView attachments[] = { m_ImageViews[i], m_DepthImageView };
+
+            VkFramebufferCreateInfo info { };
+            info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+            info.renderPass = m_RenderPass->GetRenderPass();
+            info.attachmentCount = m_RenderPass->HasDepth() ? 2 : 1;
+            info.pAttachments = attachments;
+            info.width = m_Extent.width;
+            info.height = m_Extent.height;
+            info.layers = 1;
+
+            if (vkCreateFramebuffer(Context::GetDevice()->GetLogicalDevice(), &info, nullptr, &m_Framebuffers[i]) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create framebuffer.");
+            }
+        }
+    }
+
+    void OffscreenTarget::Resize(VkExtent2D extent)
+    {
+        if (extent.width == 0 || extent.height == 0)
+        {
+            throw std::runtime_error("Failed to resize offscreen target, extent is empty.");
+        }
+
+        m_Extent = extent;
+        Reinitialise();
+    }
+
+    void OffscreenTarget::Reinitialise()
+    {
+        // Frames still in flight may reference these, same as a swap chain rebuild.
+        for (std::size_t i = 0; i < m_Images.size(); ++i)
+        {
+            Context::GetDevice()->DestroyDeferred(m_Framebuffers[i]);
+            Context::GetDevice()->DestroyDeferred(m_ImageViews[i]);
+            Context::GetDevice()->DestroyDeferred(m_Images[i]);
+            Context::GetDevice()->DestroyDeferred(m_ImageMemory[i]);
+        }
+
+        if (m_DepthImageView != VK_NULL_HANDLE)
+        {
+            Context::GetDevice()->DestroyDeferred(m_DepthImageView);
+            Context::GetDevice()->DestroyDeferred(m_DepthImage);
+            Context::GetDevice()->DestroyDeferred(m_DepthMemory);
+        }
+
+        delete m_ReadbackBuffer;
+
+        // Earlier images are gone, there is nothing to read back until the next frame.
+        m_LastImage = UINT32_MAX;
+
+        InitialiseImages();
+        InitialiseDepthResources();
+        InitialiseFramebuffers();
+    }
+
+    VkResult OffscreenTarget::AcquireNextImage(std::uint32_t& imageIndex)
+    {
+        Context::GetDevice()->WaitForValue(m_FrameTimelineValues[m_CurrentFrame]);
+        Context::GetDevice()->CollectDeletions();
+
+        imageIndex = m_CurrentFrame;
+
+        return VK_SUCCESS;
+    }
+
+    VkResult OffscreenTarget::SubmitCommandBuffers(const VkCommandBuffer buffer, const std::uint32_t imageIndex)
+    {
+        m_FrameTimelineValues[m_CurrentFrame] = Context::GetDevice()->SubmitGraphics(buffer);
+        Context::GetDevice()->RetireDeletions(m_FrameTimelineValues[m_CurrentFrame]);
+
+        m_LastImage = imageIndex;
+        m_CurrentFrame = (m_CurrentFrame + 1) % m_FramesInFlight;
+
+        return VK_SUCCESS;
+    }
+
+    void OffscreenTarget::Readback(std::vector<std::uint8_t>& pixels)
+    {
+        if (!HasFrame())
+        {
+            throw std::runtime_error("Failed to read back offscreen target, no frame has been rendered.");
+        }
+
+        VkCommandBuffer cmdBuffer = Context::GetDevice()->BeginSingleTimeCommands();
+
+        // The render pass left the image as a transfer source, and its outgoing dependency already made the colour
+        // writes visible to transfers submitted after it on the same queue, so the copy needs no barrier of its own.
+        VkBufferImageCopy region { };
+        region.bufferOffset = 0;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = { 0, 0, 0 };
+        region.imageExtent = { m_Extent.width, m_Extent.height, 1 };
+
+        vkCmdCopyImageToBuffer(cmdBuffer, m_Images[m_LastImage], VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m_ReadbackBuffer->GetBufferObject(), 1, &region);
+
+        VkBufferMemoryBarrier hostBarrier { };
+        hostBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        hostBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        hostBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        hostBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        hostBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        hostBarrier.buffer = m_ReadbackBuffer->GetBufferObject();
+        hostBarrier.offset = 0;
+        hostBarrier.size = VK_WHOLE_SIZE;
+
+        vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &hostBarrier, 0, nullptr);
+
+        Context::GetDevice()->EndSingleTimeCommands(cmdBuffer);
+
+        pixels.resize(GetImageSize());
+
+        void* data;
+        vkMapMemory(Context::GetDevice()->GetLogicalDevice(), m_ReadbackBuffer->GetMemoryObject(), 0, pixels.size(), 0, &data);
+        std::memcpy(pixels.data(), data, pixels.size());
+        vkUnmapMemory(Context::GetDevice()->GetLogicalDevice(), m_ReadbackBuffer->GetMemoryObject());
+    }
+}
\ No newline at end of file
@@ -9,11 +9,11 @@
 
 namespace WackyEngine
 {
-    Pipeline::Pipeline(const PipelineConfig& config)
+    Pipeline::Pipeline(const PipelineConfig& config) : m_BindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS)
     {
         // Initialising Shader Modules
-        VkShaderModule vertexShaderModule = CreateShaderModule("shaders/shader.vert.spv");
-        VkShaderModule fragmentShaderModule = CreateShaderModule("shaders/shader.frag.spv");
+        VkShaderModule vertexShaderModule = CreateShaderModule(config.VertexShader);
+        VkShaderModule fragmentShaderModule = CreateShaderModule(config.FragmentShader);
 
         VkPipelineShaderStageCreateInfo vertShaderStageInfo { };
         vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -31,15 +31,12 @@ namespace WackyEngine
 
         // Initialising Fixed-Function State
 
-        auto bindingDescriptions = Vertex::GetBindingDescriptions();
-        auto attributeDescriptions = Vertex::GetAttributeDescriptions();
-
         VkPipelineVertexInputStateCreateInfo vertexInputInfo { };
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        vertexInputInfo.vertexBindingDescriptionCount = static_cast<std::uint32_t>(bindingDescriptions.size());
-        vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
-        vertexInputInfo.vertexAttributeDescriptionCount = static_cast<std::uint32_t>(attributeDescriptions.size());
-        vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        vertexInputInfo.vertexBindingDescriptionCount = static_cast<std::uint32_t>(config.BindingDescriptions.size());
+        vertexInputInfo.pVertexBindingDescriptions = config.BindingDescriptions.data();
+        vertexInputInfo.vertexAttributeDescriptionCount = static_cast<std::uint32_t>(config.AttributeDescriptions.size());
+        vertexInputInfo.pVertexAttributeDescriptions = config.AttributeDescriptions.data();
         
         // Creating Pipeline
 
@@ -53,7 +50,7 @@ namespace WackyEngine
         pipelineInfo.pViewportState = &config.ViewportInfo;
         pipelineInfo.pRasterizationState = &config.RasterisationInfo;
         pipelineInfo.pMultisampleState = &config.MultisampleInfo;
-        pipelineInfo.pDepthStencilState = nullptr;
+        pipelineInfo.pDepthStencilState = &config.DepthStencilInfo;
         pipelineInfo.pColorBlendState = &config.ColorBlendInfo;
         pipelineInfo.pDynamicState = &config.DynamicStateInfo;
 
@@ -64,18 +61,52 @@ namespace WackyEngine
         pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
         pipelineInfo.basePipelineIndex = -1;
 
-        if (vkCreateGraphicsPipelines(Context::GetDevice()->GetLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_Pipeline) != VK_SUCCESS)
+        VkResult result = vkCreateGraphicsPipelines(Context::GetDevice()->GetLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_Pipeline);
+
+        // The modules are only needed while creating the pipeline, failed or not.
+        vkDestroyShaderModule(Context::GetDevice()->GetLogicalDevice(), vertexShaderModule, nullptr);
+        vkDestroyShaderModule(Context::GetDevice()->GetLogicalDevice(), fragmentShaderModule, nullptr);
+
+        if (result != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to create graphics pipeline.");
         }
+    }
 
-        vkDestroyShaderModule(Context::GetDevice()->GetLogicalDevice(), vertexShaderModule, nullptr);
-        vkDestroyShaderModule(Context::GetDevice()->GetLogicalDevice(), fragmentShaderModule, nullptr);
+    Pipeline* Pipeline::CreateCompute(const std::string& shaderFile, VkPipelineLayout pipelineLayout)
+    {
+        VkShaderModule computeShaderModule = CreateShaderModule(shaderFile);
+
+        VkComputePipelineCreateInfo pipelineInfo { };
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = computeShaderModule;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.layout = pipelineLayout;
+        pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+        pipelineInfo.basePipelineIndex = -1;
+
+        VkPipeline handle;
+        VkResult result = vkCreateComputePipelines(Context::GetDevice()->GetLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &handle);
+
+        vkDestroyShaderModule(Context::GetDevice()->GetLogicalDevice(), computeShaderModule, nullptr);
+
+        if (result != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create compute pipeline.");
+        }
+
+        Pipeline* pipeline = new Pipeline();
+        pipeline->m_Pipeline = handle;
+        pipeline->m_BindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
+
+        return pipeline;
     }
 
     Pipeline::~Pipeline()
     {
-        vkDestroyPipeline(Context::GetDevice()->GetLogicalDevice(), m_Pipeline, nullptr);
+        Context::GetDevice()->DestroyDeferred(m_Pipeline);
     }
 
     VkShaderModule Pipeline::CreateShaderModule(const std::string& shaderFile)
@@ -109,7 +140,7 @@ namespace WackyEngine
         return shaderModule;
     }
 
-    void Pipeline::GetDefaultConfig(PipelineConfig& config) const noexcept
+    void Pipeline::GetDefaultConfig(PipelineConfig& config) noexcept
     {
         config.InputAssemblyInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
         config.InputAssemblyInfo.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
@@ -160,10 +191,33 @@ namespace WackyEngine
         config.ColorBlendInfo.blendConstants[2] = 0.0f;
         config.ColorBlendInfo.blendConstants[3] = 0.0f;
 
+        // Depth testing is opt in through EnableDepthTest, and ignored by render passes without a depth attachment.
+        config.DepthStencilInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+        config.DepthStencilInfo.depthTestEnable = VK_FALSE;
+        config.DepthStencilInfo.depthWriteEnable = VK_FALSE;
+        config.DepthStencilInfo.depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
+        config.DepthStencilInfo.depthBoundsTestEnable = VK_FALSE;
+        config.DepthStencilInfo.minDepthBounds = 0.0f;
+        config.DepthStencilInfo.maxDepthBounds = 1.0f;
+        config.DepthStencilInfo.stencilTestEnable = VK_FALSE;
+        config.DepthStencilInfo.front = { };
+        config.DepthStencilInfo.back = { };
+
         config.DynamicStateEnables = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
         config.DynamicStateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
         config.DynamicStateInfo.dynamicStateCount = static_cast<uint32_t>(config.DynamicStateEnables.size());
         config.DynamicStateInfo.pDynamicStates = config.DynamicStateEnables.data();
         config.DynamicStateInfo.flags = 0;
+
+        // Matches the default shaders.
+        config.BindingDescriptions = Vertex2D::GetBindingDescriptions();
+        config.AttributeDescriptions = Vertex2D::GetAttributeDescriptions();
+    }
+
+    void Pipeline::EnableDepthTest(PipelineConfig& config, bool depthWrite, VkCompareOp compareOp) noexcept
+    {
+        config.DepthStencilInfo.depthTestEnable = VK_TRUE;
+        config.DepthStencilInfo.depthWriteEnable = depthWrite ? VK_TRUE : VK_FALSE;
+        config.DepthStencilInfo.depthCompareOp = compareOp;
     }
 }
\ No newline at end of file
@@ -6,9 +6,13 @@
 
 namespace WackyEngine
 {
-    RenderPass* RenderPass::CreateSimplePass(VkFormat format)
+    RenderPass* RenderPass::CreateSimplePass(VkFormat format, VkFormat depthFormat, VkImageLayout finalLayout)
     {
-        VkAttachmentDescription colourAttachment { };
+        bool hasDepth = depthFormat != VK_FORMAT_UNDEFINED;
+
+        VkAttachmentDescription attachments[2] { };
+
+        VkAttachmentDescription& colourAttachment = attachments[0];
         colourAttachment.format = format;
         colourAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
         colourAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
@@ -16,36 +20,73 @@ namespace WackyEngine
         colourAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         colourAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
         colourAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        colourAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        colourAttachment.finalLayout = finalLayout;
+
+        // Depth is only needed within the pass, so it is never loaded or stored.
+        VkAttachmentDescription& depthAttachment = attachments[1];
+        depthAttachment.format = depthFormat;
+        depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 
         VkAttachmentReference colourAttachmentRef { };
         colourAttachmentRef.attachment = 0;
         colourAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
+        VkAttachmentReference depthAttachmentRef { };
+        depthAttachmentRef.attachment = 1;
+        depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
         VkSubpassDescription subpass { };
         subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
         subpass.colorAttachmentCount = 1;
         subpass.pColorAttachments = &colourAttachmentRef;
+        subpass.pDepthStencilAttachment = hasDepth ? &depthAttachmentRef : nullptr;
 
         VkRenderPassCreateInfo info { };
         info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-        info.attachmentCount = 1;
-        info.pAttachments = &colourAttachment;
+        info.attachmentCount = hasDepth ? 2 : 1;
+        info.pAttachments = attachments;
         info.subpassCount = 1;
         info.pSubpasses = &subpass;
 
-        VkSubpassDependency dependency { };
-        dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-        dependency.dstSubpass = 0;
-        dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        dependency.srcAccessMask = 0;
-        dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        // The single depth image is shared by every frame in flight, so its clear has to wait on the
+        // previous frame's late depth tests as well as the colour output.
+        VkSubpassDependency dependencies[2] { };
+        dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[0].dstSubpass = 0;
+        dependencies[0].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[0].srcAccessMask = 0;
+        dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+        if (hasDepth)
+        {
+            dependencies[0].srcStageMask |= VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            dependencies[0].srcAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            dependencies[0].dstStageMask |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+            dependencies[0].dstAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        }
+
+        // The implicit outgoing dependency only reaches BOTTOM_OF_PIPE with no access, so nothing copying the colour
+        // image afterwards would see its writes. Readbacks and frame captures chain their barriers off this one.
+        dependencies[1].srcSubpass = 0;
+        dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        dependencies[1].dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dependencies[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 
-        info.dependencyCount = 1;
-        info.pDependencies = &dependency;
+        info.dependencyCount = 2;
+        info.pDependencies = dependencies;
 
         RenderPass* renderPass = new RenderPass();
+        renderPass->m_DepthFormat = depthFormat;
+        renderPass->m_FinalLayout = finalLayout;
 
         if (vkCreateRenderPass(Context::GetDevice()->GetLogicalDevice(), &info, nullptr, &renderPass->m_RenderPass) != VK_SUCCESS)
         {
@@ -57,6 +98,6 @@ namespace WackyEngine
 
     RenderPass::~RenderPass()
     {
-        vkDestroyRenderPass(Context::GetDevice()->GetLogicalDevice(), m_RenderPass, nullptr);
+        Context::GetDevice()->DestroyDeferred(m_RenderPass);
     }
 }
\ No newline at end of file
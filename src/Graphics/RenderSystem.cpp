@@ -6,31 +6,51 @@
 
 namespace WackyEngine
 {
+    static constexpr std::size_t FRAME_ARENA_SIZE = 256 * 1024;
+
     RenderSystem::RenderSystem()
     {
         m_ClearColour = { 0.2f, 0.2f, 0.2f };
+        m_CurrentIndex = 0;
+        m_CurrentFrame = 0;
+        m_SubmittedFrames = 0;
+
+        m_SwapChain = nullptr;
+        m_OffscreenTarget = nullptr;
 
-        m_SwapChain = new SwapChain();
+        if (Context::IsHeadless())
+        {
+            m_OffscreenTarget = new OffscreenTarget(Context::GetHeadlessExtent());
+            m_Target = m_OffscreenTarget;
+        }
+        else
+        {
+            m_SwapChain = new SwapChain();
+            m_Target = m_SwapChain;
+        }
+
+        m_FrameArena = new FrameArena(m_Target->GetFramesInFlight(), Context::GetJobSystem(), FRAME_ARENA_SIZE);
         InitialiseCommandBuffers();
     }
 
     RenderSystem::~RenderSystem()
     {
         vkFreeCommandBuffers(Context::GetDevice()->GetLogicalDevice(), Context::GetDevice()->GetCommandPool(), (std::uint32_t)m_CommandBuffers.size(), m_CommandBuffers.data());
-        delete m_SwapChain;
+        delete m_FrameArena;
+        delete m_Target;
     }
 
     void RenderSystem::InitialiseCommandBuffers()
     {
         VkCommandPool pool = Context::GetDevice()->GetCommandPool();
 
-        m_CommandBuffers.resize(m_SwapChain->MAX_FRAMES_IN_FLIGHT);
+        m_CommandBuffers.resize(m_Target->GetFramesInFlight());
 
         VkCommandBufferAllocateInfo commandBufferInfo { };
         commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         commandBufferInfo.commandPool = pool;
         commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        commandBufferInfo.commandBufferCount = (std::uint32_t)m_SwapChain->MAX_FRAMES_IN_FLIGHT;
+        commandBufferInfo.commandBufferCount = m_Target->GetFramesInFlight();
 
         if (vkAllocateCommandBuffers(Context::GetDevice()->GetLogicalDevice(), &commandBufferInfo, m_CommandBuffers.data()) != VK_SUCCESS)
         {
@@ -40,11 +60,14 @@ namespace WackyEngine
 
     VkCommandBuffer RenderSystem::BeginFrame()
     {
-        VkResult result = m_SwapChain->AcquireNextImage(m_CurrentIndex);
+        // Acquiring waits on this frame's fence, so everything from its last use is retired after this.
+        m_CurrentFrame = m_Target->GetCurrentFrame();
+
+        VkResult result = m_Target->AcquireNextImage(m_CurrentIndex);
 
         if (result == VK_ERROR_OUT_OF_DATE_KHR)
         {
-            m_SwapChain->Reinitialise();
+            m_Target->Reinitialise();
             return nullptr;
         }
         
@@ -54,10 +77,11 @@ namespace WackyEngine
         }
 
         m_FrameStarted = true;
+        m_FrameArena->BeginFrame(m_CurrentFrame);
 
         // Command Buffer Begin
 
-        VkCommandBuffer buffer = m_CommandBuffers[m_CurrentIndex];
+        VkCommandBuffer buffer = m_CommandBuffers[m_CurrentFrame];
         
         VkCommandBufferBeginInfo info { };
         info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -72,17 +96,18 @@ namespace WackyEngine
 
     void RenderSystem::EndFrame()
     {
-        VkCommandBuffer buffer = m_CommandBuffers[m_CurrentIndex];
+        VkCommandBuffer buffer = m_CommandBuffers[m_CurrentFrame];
         if (vkEndCommandBuffer(buffer) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to record to command buffer.");
         }
 
-        VkResult result = m_SwapChain->SubmitCommandBuffers(m_CommandBuffers[m_CurrentIndex], m_CurrentIndex);
+        VkResult result = m_Target->SubmitCommandBuffers(buffer, m_CurrentIndex);
+        ++m_SubmittedFrames;
 
         if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
         {
-            m_SwapChain->Reinitialise();
+            m_Target->Reinitialise();
             return;
         }
         else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
@@ -98,33 +123,36 @@ namespace WackyEngine
         VkRenderPassBeginInfo renderBeginInfo { };
         renderBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
         renderBeginInfo.renderPass = GetSwapRenderPass()->GetRenderPass();
-        renderBeginInfo.framebuffer = m_SwapChain->GetFramebuffers()[m_CurrentIndex];
+        renderBeginInfo.framebuffer = m_Target->GetFramebuffers()[m_CurrentIndex];
         renderBeginInfo.renderArea.offset = { 0, 0 };
-        renderBeginInfo.renderArea.extent = m_SwapChain->GetExtent();
+        renderBeginInfo.renderArea.extent = m_Target->GetExtent();
+
+        VkClearValue clearValues[2] { };
+        clearValues[0].color = {{ m_ClearColour.X, m_ClearColour.Y, m_ClearColour.Z, 1.0f }};
+        clearValues[1].depthStencil = { 1.0f, 0 };
 
-        VkClearValue clearColour = {{{ m_ClearColour.X, m_ClearColour.Y, m_ClearColour.Z, 1.0f }}};
-        renderBeginInfo.clearValueCount = 1;
-        renderBeginInfo.pClearValues = &clearColour;
+        renderBeginInfo.clearValueCount = GetSwapRenderPass()->HasDepth() ? 2 : 1;
+        renderBeginInfo.pClearValues = clearValues;
 
-        vkCmdBeginRenderPass(m_CommandBuffers[m_CurrentIndex], &renderBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdBeginRenderPass(buffer, &renderBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
 
         VkViewport viewport { };
         viewport.x = 0.0f;
         viewport.y = 0.0f;
-        viewport.width = static_cast<float>(m_SwapChain->GetExtent().width);
-        viewport.height = static_cast<float>(m_SwapChain->GetExtent().height);
+        viewport.width = static_cast<float>(m_Target->GetExtent().width);
+        viewport.height = static_cast<float>(m_Target->GetExtent().height);
         viewport.minDepth = 0.0f;
         viewport.maxDepth = 1.0f;
-        vkCmdSetViewport(m_CommandBuffers[m_CurrentIndex], 0, 1, &viewport);
+        vkCmdSetViewport(buffer, 0, 1, &viewport);
 
         VkRect2D scissor { };
         scissor.offset = {0, 0};
-        scissor.extent = m_SwapChain->GetExtent();
-        vkCmdSetScissor(m_CommandBuffers[m_CurrentIndex], 0, 1, &scissor);
+        scissor.extent = m_Target->GetExtent();
+        vkCmdSetScissor(buffer, 0, 1, &scissor);
     }
 
     void RenderSystem::EndRenderPass(VkCommandBuffer buffer)
     {
-        vkCmdEndRenderPass(m_CommandBuffers[m_CurrentIndex]);
+        vkCmdEndRenderPass(buffer);
     }
 }
\ No newline at end of file
@@ -0,0 +1,589 @@
+#include "WackyEngine/Graphics/Renderers/MeshRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Graphics/DescriptorUtil.h"
+
+namespace WackyEngine
+{
+    // Binding 1 steps once per instance, the transform is read as four columns at locations 4 to 7.
+    static void AddInstanceInput(PipelineConfig& config)
+    {
+        VkVertexInputBindingDescription binding { };
+        binding.binding = 1;
+        binding.stride = sizeof(Matrix4);
+        binding.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        config.BindingDescriptions.push_back(binding);
+
+        for (std::uint32_t column = 0; column < 4; ++column)
+        {
+            VkVertexInputAttributeDescription attribute { };
+            attribute.binding = 1;
+            attribute.location = 4 + column;
+            attribute.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+            attribute.offset = column * 4 * sizeof(float);
+            config.AttributeDescriptions.push_back(attribute);
+        }
+    }
+
+    static constexpr std::uint32_t CULL_GROUP_SIZE = 64;
+
+    // Gribb-Hartmann extraction for Vulkan clip space, where depth runs 0 to w. Normalised so the
+    // shader can compare signed distances against sphere radii directly.
+    static void ExtractFrustumPlanes(const Matrix4& m, Vector4* planes) noexcept
+    {
+        Vector4 row1(m.M11, m.M12, m.M13, m.M14);
+        Vector4 row2(m.M21, m.M22, m.M23, m.M24);
+        Vector4 row3(m.M31, m.M32, m.M33, m.M34);
+        Vector4 row4(m.M41, m.M42, m.M43, m.M44);
+
+        planes[0] = row4 + row1;
+        planes[1] = row4 - row1;
+        planes[2] = row4 + row2;
+        planes[3] = row4 - row2;
+        planes[4] = row3;
+        planes[5] = row4 - row3;
+
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            float length = std::sqrt(planes[i].X * planes[i].X + planes[i].Y * planes[i].Y + planes[i].Z * planes[i].Z);
+            planes[i] = planes[i] / length;
+        }
+    }
+
+    static void ComputeBarrier(VkCommandBuffer cmdBuffer, VkPipelineStageFlags srcStage, VkAccessFlags srcAccess, VkPipelineStageFlags dstStage, VkAccessFlags dstAccess)
+    {
+        VkMemoryBarrier barrier { };
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+
+        vkCmdPipelineBarrier(cmdBuffer, srcStage, dstStage, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    MeshRenderer::MeshRenderer(const RenderPass* renderPass, std::uint32_t maxInstances)
+        : m_MaxInstances(maxInstances), m_VertexBuffer(nullptr), m_IndexBuffer(nullptr), m_IndexType(VK_INDEX_TYPE_UINT16), m_LargestMesh(0),
+          m_CullPipeline(nullptr), m_CompactPipeline(nullptr), m_CullPipelineLayout(VK_NULL_HANDLE), m_CullDescriptorPool(VK_NULL_HANDLE),
+          m_CullDescriptorSetLayout(VK_NULL_HANDLE), m_BoundsBuffer(nullptr), m_Culled(false), m_DrawCount(0), m_InstanceCount(0),
+          m_ViewProjection(Matrix4::Identity), m_Statistics { }
+    {
+        m_FramesInFlight = Context::GetGraphicsInformation().FramesInFlight;
+
+        InitialisePipelineLayout();
+        InitialisePipeline(renderPass);
+
+        // Per Frame Buffers
+
+        for (std::uint32_t i = 0; i < m_FramesInFlight; ++i)
+        {
+            m_InstanceBuffers.push_back(new Buffer(sizeof(Matrix4) * m_MaxInstances, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT));
+        }
+    }
+
+    MeshRenderer::~MeshRenderer()
+    {
+        delete m_VertexBuffer;
+        delete m_IndexBuffer;
+
+        for (std::size_t i = 0; i < m_InstanceBuffers.size(); ++i)
+        {
+            delete m_InstanceBuffers[i];
+        }
+
+        for (std::size_t i = 0; i < m_IndirectBuffers.size(); ++i)
+        {
+            delete m_IndirectBuffers[i];
+            delete m_InstanceMeshBuffers[i];
+            delete m_VisibleBuffers[i];
+            delete m_CompactCommandBuffers[i];
+            delete m_DrawCountBuffers[i];
+        }
+
+        delete m_BoundsBuffer;
+
+        vkDestroyDescriptorSetLayout(Context::GetDevice()->GetLogicalDevice(), m_CullDescriptorSetLayout, nullptr);
+        vkDestroyDescriptorPool(Context::GetDevice()->GetLogicalDevice(), m_CullDescriptorPool, nullptr);
+
+        vkDestroyPipelineLayout(Context::GetDevice()->GetLogicalDevice(), m_PipelineLayout, nullptr);
+        vkDestroyPipelineLayout(Context::GetDevice()->GetLogicalDevice(), m_CullPipelineLayout, nullptr);
+
+        delete m_Pipeline;
+        delete m_CullPipeline;
+        delete m_CompactPipeline;
+    }
+
+    std::uint32_t MeshRenderer::AddMesh(const std::vector<Vertex>& vertices, const std::vector<std::uint32_t>& indices)
+    {
+        if (IsBuilt())
+        {
+            throw std::runtime_error("Failed to add mesh, mesh renderer has already been built.");
+        }
+
+        // Indices stay relative to the mesh, the draw's vertex offset rebases them into the shared buffer.
+        MeshRange range { };
+        range.IndexCount = static_cast<std::uint32_t>(indices.size());
+        range.FirstIndex = static_cast<std::uint32_t>(m_Indices.size());
+        range.VertexOffset = static_cast<std::int32_t>(m_Vertices.size());
+
+        // Sphere around the box centre, looser than the minimal sphere but one pass and good enough to cull with.
+        Vector3 minimum = vertices.empty() ? Vector3() : vertices[0].Position;
+        Vector3 maximum = minimum;
+
+        for (const Vertex& vertex : vertices)
+        {
+            minimum = Vector3(std::min(minimum.X, vertex.Position.X), std::min(minimum.Y, vertex.Position.Y), std::min(minimum.Z, vertex.Position.Z));
+            maximum = Vector3(std::max(maximum.X, vertex.Position.X), std::max(maximum.Y, vertex.Position.Y), std::max(maximum.Z, vertex.Position.Z));
+        }
+
+        Vector3 centre = (minimum + maximum) * 0.5f;
+        float radiusSquared = 0.0f;
+
+        for (const Vertex& vertex : vertices)
+        {
+            radiusSquared = std::max(radiusSquared, centre.DistanceSquared(vertex.Position));
+        }
+
+        m_Vertices.insert(m_Vertices.end(), vertices.begin(), vertices.end());
+        m_Indices.insert(m_Indices.end(), indices.begin(), indices.end());
+        m_Meshes.push_back(range);
+        m_LargestMesh = std::max(m_LargestMesh, vertices.size());
+        m_Bounds.push_back(Vector4(centre, std::sqrt(radiusSquared)));
+
+        return static_cast<std::uint32_t>(m_Meshes.size() - 1);
+    }
+
+    std::uint32_t MeshRenderer::AddModel(const MeshData& mesh)
+    {
+        return AddMesh(mesh.Vertices, mesh.Indices);
+    }
+
+    void MeshRenderer::Build()
+    {
+        if (IsBuilt() || m_Meshes.empty())
+        {
+            return;
+        }
+
+        // Vertex Buffer
+
+        VkDeviceSize bufferSize = sizeof(Vertex) * m_Vertices.size();
+
+        m_VertexBuffer = new Buffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        Buffer* stagingBuffer = new Buffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        stagingBuffer->SetData(m_Vertices.data(), bufferSize);
+        m_VertexBuffer->CopyBuffer(*stagingBuffer, bufferSize);
+
+        delete stagingBuffer;
+
+        // Index Buffer
+
+        m_IndexType = m_LargestMesh <= 65536 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+
+        std::vector<std::uint16_t> shortIndices;
+
+        if (m_IndexType == VK_INDEX_TYPE_UINT16)
+        {
+            shortIndices.assign(m_Indices.begin(), m_Indices.end());
+            bufferSize = sizeof(std::uint16_t) * shortIndices.size();
+        }
+        else
+        {
+            bufferSize = sizeof(std::uint32_t) * m_Indices.size();
+        }
+
+        m_IndexBuffer = new Buffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        stagingBuffer = new Buffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        if (m_IndexType == VK_INDEX_TYPE_UINT16)
+        {
+            stagingBuffer->SetData(shortIndices.data(), bufferSize);
+        }
+        else
+        {
+            stagingBuffer->SetData(m_Indices.data(), bufferSize);
+        }
+
+        m_IndexBuffer->CopyBuffer(*stagingBuffer, bufferSize);
+
+        delete stagingBuffer;
+
+        // Indirect Buffers, at most one command per mesh.
+
+        for (std::uint32_t i = 0; i < m_FramesInFlight; ++i)
+        {
+            m_IndirectBuffers.push_back(new Buffer(sizeof(VkDrawIndexedIndirectCommand) * m_Meshes.size(), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT));
+        }
+
+        InitialiseCulling();
+
+        m_Vertices = std::vector<Vertex>();
+        m_Indices = std::vector<std::uint32_t>();
+        m_Instances.resize(m_Meshes.size());
+    }
+
+    void MeshRenderer::Begin()
+    {
+        for (std::vector<Matrix4>& instances : m_Instances)
+        {
+            instances.clear();
+        }
+
+        m_InstanceCount = 0;
+        m_Culled = false;
+        m_Statistics = { };
+    }
+
+    void MeshRenderer::Cull(const FrameData& frameData)
+    {
+        if (m_InstanceCount == 0)
+        {
+            return;
+        }
+
+        VkCommandBuffer cmdBuffer = frameData.CmdBuffer;
+
+        m_DrawCount = WriteInstances(frameData, true);
+
+        CullPC pushConstants { };
+        ExtractFrustumPlanes(m_ViewProjection, pushConstants.Planes);
+        pushConstants.InstanceCount = m_InstanceCount;
+        pushConstants.MeshCount = GetMeshCount();
+
+        vkCmdFillBuffer(cmdBuffer, m_DrawCountBuffers[frameData.FrameIndex]->GetBufferObject(), 0, sizeof(std::uint32_t), 0);
+        ComputeBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+        // Both passes share the layout, so the set and push constants stay bound across the switch.
+        vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_CullPipeline->GetPipeline());
+        vkCmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_CullPipelineLayout, 0, 1, &m_CullDescriptorSets[frameData.FrameIndex], 0, nullptr);
+        vkCmdPushConstants(cmdBuffer, m_CullPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(CullPC), &pushConstants);
+        vkCmdDispatch(cmdBuffer, (m_InstanceCount + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE, 1, 1);
+
+        ComputeBarrier(cmdBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+        vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_CompactPipeline->GetPipeline());
+        vkCmdDispatch(cmdBuffer, (GetMeshCount() + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE, 1, 1);
+
+        ComputeBarrier(cmdBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+            VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+
+        m_Culled = true;
+    }
+
+    std::uint32_t MeshRenderer::ReadCullResults(std::uint32_t frameIndex, std::vector<VkDrawIndexedIndirectCommand>& commands) const
+    {
+        if (!IsBuilt() || frameIndex >= m_FramesInFlight)
+        {
+            throw std::runtime_error("Failed to read cull results, mesh renderer has not been built or the frame does not exist.");
+        }
+
+        VkDeviceSize commandsSize = sizeof(VkDrawIndexedIndirectCommand) * GetMeshCount();
+        Buffer readbackBuffer(sizeof(std::uint32_t) + commandsSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        VkCommandBuffer cmdBuffer = Context::GetDevice()->BeginSingleTimeCommands();
+
+        // Submitted after the frame, so the barrier's first scope covers the compact pass' writes.
+        ComputeBarrier(cmdBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT);
+
+        VkBufferCopy countRegion { };
+        countRegion.size = sizeof(std::uint32_t);
+        vkCmdCopyBuffer(cmdBuffer, m_DrawCountBuffers[frameIndex]->GetBufferObject(), readbackBuffer.GetBufferObject(), 1, &countRegion);
+
+        VkBufferCopy commandsRegion { };
+        commandsRegion.dstOffset = sizeof(std::uint32_t);
+        commandsRegion.size = commandsSize;
+        vkCmdCopyBuffer(cmdBuffer, m_CompactCommandBuffers[frameIndex]->GetBufferObject(), readbackBuffer.GetBufferObject(), 1, &commandsRegion);
+
+        Context::GetDevice()->EndSingleTimeCommands(cmdBuffer);
+
+        void* data;
+        vkMapMemory(Context::GetDevice()->GetLogicalDevice(), readbackBuffer.GetMemoryObject(), 0, VK_WHOLE_SIZE, 0, &data);
+
+        std::uint32_t drawCount;
+        std::memcpy(&drawCount, data, sizeof(std::uint32_t));
+
+        commands.resize(std::min(drawCount, GetMeshCount()));
+        std::memcpy(commands.data(), static_cast<const std::uint8_t*>(data) + sizeof(std::uint32_t), sizeof(VkDrawIndexedIndirectCommand) * commands.size());
+
+        vkUnmapMemory(Context::GetDevice()->GetLogicalDevice(), readbackBuffer.GetMemoryObject());
+
+        return drawCount;
+    }
+
+    void MeshRenderer::End(const FrameData& frameData)
+    {
+        if (m_InstanceCount == 0)
+        {
+            return;
+        }
+
+        VkCommandBuffer cmdBuffer = frameData.CmdBuffer;
+
+        if (!m_Culled)
+        {
+            m_DrawCount = WriteInstances(frameData, false);
+        }
+
+        vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline->GetPipeline());
+
+        PC pushConstants { m_ViewProjection };
+        vkCmdPushConstants(cmdBuffer, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PC), &pushConstants);
+
+        Buffer* instanceBuffer = m_Culled ? m_VisibleBuffers[frameData.FrameIndex] : m_InstanceBuffers[frameData.FrameIndex];
+
+        VkBuffer vertexBuffers[] = { m_VertexBuffer->GetBufferObject(), instanceBuffer->GetBufferObject() };
+        VkDeviceSize offsets[] = { 0, 0 };
+        vkCmdBindVertexBuffers(cmdBuffer, 0, 2, vertexBuffers, offsets);
+        vkCmdBindIndexBuffer(cmdBuffer, m_IndexBuffer->GetBufferObject(), 0, m_IndexType);
+
+        if (m_Culled && Context::GetDevice()->SupportsDrawIndirectCount())
+        {
+            vkCmdDrawIndexedIndirectCount(cmdBuffer, m_CompactCommandBuffers[frameData.FrameIndex]->GetBufferObject(), 0,
+                m_DrawCountBuffers[frameData.FrameIndex]->GetBufferObject(), 0, m_DrawCount, sizeof(VkDrawIndexedIndirectCommand));
+            ++m_Statistics.DrawCalls;
+        }
+        else
+        {
+            // After culling the uncompacted commands are still valid, meshes with nothing visible just draw zero instances.
+            DrawIndirect(cmdBuffer, m_IndirectBuffers[frameData.FrameIndex]->GetBufferObject(), m_DrawCount);
+        }
+    }
+
+    std::uint32_t MeshRenderer::WriteInstances(const FrameData& frameData, bool culling)
+    {
+        LinearArena& arena = frameData.Arena->GetArena();
+
+        // Instances are laid out mesh by mesh, so each mesh's command covers a contiguous run starting at its first instance.
+        Matrix4* transforms = arena.AllocateArray<Matrix4>(m_InstanceCount);
+        std::uint32_t* meshIndices = culling ? arena.AllocateArray<std::uint32_t>(m_InstanceCount) : nullptr;
+        VkDrawIndexedIndirectCommand* commands = arena.AllocateArray<VkDrawIndexedIndirectCommand>(m_Meshes.size());
+
+        std::uint32_t drawCount = 0;
+        std::uint32_t firstInstance = 0;
+
+        for (std::size_t i = 0; i < m_Meshes.size(); ++i)
+        {
+            const std::vector<Matrix4>& instances = m_Instances[i];
+
+            if (instances.empty() && !culling)
+            {
+                continue;
+            }
+
+            std::copy(instances.begin(), instances.end(), transforms + firstInstance);
+
+            if (culling)
+            {
+                std::fill_n(meshIndices + firstInstance, instances.size(), static_cast<std::uint32_t>(i));
+            }
+
+            VkDrawIndexedIndirectCommand& command = commands[drawCount++];
+            command.indexCount = m_Meshes[i].IndexCount;
+            command.instanceCount = culling ? 0 : static_cast<std::uint32_t>(instances.size());
+            command.firstIndex = m_Meshes[i].FirstIndex;
+            command.vertexOffset = m_Meshes[i].VertexOffset;
+            command.firstInstance = firstInstance;
+
+            firstInstance += static_cast<std::uint32_t>(instances.size());
+        }
+
+        m_InstanceBuffers[frameData.FrameIndex]->SetData(transforms, sizeof(Matrix4) * m_InstanceCount);
+        m_IndirectBuffers[frameData.FrameIndex]->SetData(commands, sizeof(VkDrawIndexedIndirectCommand) * drawCount);
+
+        if (culling)
+        {
+            m_InstanceMeshBuffers[frameData.FrameIndex]->SetData(meshIndices, sizeof(std::uint32_t) * m_InstanceCount);
+        }
+
+        return drawCount;
+    }
+
+    void MeshRenderer::DrawIndirect(VkCommandBuffer cmdBuffer, VkBuffer indirectBuffer, std::uint32_t drawCount)
+    {
+        if (Context::GetDevice()->SupportsMultiDrawIndirect())
+        {
+            vkCmdDrawIndexedIndirect(cmdBuffer, indirectBuffer, 0, drawCount, sizeof(VkDrawIndexedIndirectCommand));
+            ++m_Statistics.DrawCalls;
+            return;
+        }
+
+        for (std::uint32_t i = 0; i < drawCount; ++i)
+        {
+            vkCmdDrawIndexedIndirect(cmdBuffer, indirectBuffer, i * sizeof(VkDrawIndexedIndirectCommand), 1, sizeof(VkDrawIndexedIndirectCommand));
+            ++m_Statistics.DrawCalls;
+        }
+    }
+
+    void MeshRenderer::DrawInstance(std::uint32_t mesh, const Matrix4& transform)
+    {
+        DrawInstances(mesh, std::span<const Matrix4>(&transform, 1));
+    }
+
+    void MeshRenderer::DrawInstances(std::uint32_t mesh, std::span<const Matrix4> transforms)
+    {
+        if (!IsBuilt() || mesh >= m_Meshes.size())
+        {
+            throw std::runtime_error("Failed to draw mesh, mesh renderer has not been built or the mesh does not exist.");
+        }
+
+        if (m_InstanceCount + transforms.size() > m_MaxInstances)
+        {
+            throw std::runtime_error("Failed to draw mesh, instance limit reached this frame.");
+        }
+
+        m_Instances[mesh].insert(m_Instances[mesh].end(), transforms.begin(), transforms.end());
+        m_InstanceCount += static_cast<std::uint32_t>(transforms.size());
+
+        m_Statistics.Instances += static_cast<std::uint32_t>(transforms.size());
+    }
+
+    void MeshRenderer::InitialisePipelineLayout()
+    {
+        VkPushConstantRange pushRangeInfo { };
+        pushRangeInfo.size = sizeof(PC);
+        pushRangeInfo.offset = 0;
+        pushRangeInfo.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo { };
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 0;
+        pipelineLayoutInfo.pSetLayouts = nullptr;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRangeInfo;
+
+        if (vkCreatePipelineLayout(Context::GetDevice()->GetLogicalDevice(), &pipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create pipeline layout.");
+        }
+    }
+
+    void MeshRenderer::InitialisePipeline(const RenderPass* renderPass)
+    {
+        PipelineConfig config { };
+
+        Pipeline::GetDefaultConfig(config);
+        config.RenderPass = renderPass->GetRenderPass();
+        config.PipelineLayout = m_PipelineLayout;
+        config.VertexShader = "shaders/mesh.vert.spv";
+        config.FragmentShader = "shaders/mesh.frag.spv";
+        config.BindingDescriptions = Vertex::GetBindingDescriptions();
+        config.AttributeDescriptions = Vertex::GetAttributeDescriptions();
+        AddInstanceInput(config);
+
+        if (renderPass->HasDepth())
+        {
+            Pipeline::EnableDepthTest(config, true);
+        }
+
+        m_Pipeline = new Pipeline(config);
+    }
+
+    void MeshRenderer::InitialiseCulling()
+    {
+        std::uint32_t meshCount = GetMeshCount();
+
+        // Buffers
+
+        m_BoundsBuffer = new Buffer(sizeof(Vector4) * meshCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        m_BoundsBuffer->SetData(m_Bounds.data(), sizeof(Vector4) * meshCount);
+
+        for (std::uint32_t i = 0; i < m_FramesInFlight; ++i)
+        {
+            m_InstanceMeshBuffers.push_back(new Buffer(sizeof(std::uint32_t) * m_MaxInstances, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT));
+            m_VisibleBuffers.push_back(new Buffer(sizeof(Matrix4) * m_MaxInstances, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+            m_CompactCommandBuffers.push_back(new Buffer(sizeof(VkDrawIndexedIndirectCommand) * meshCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+            m_DrawCountBuffers.push_back(new Buffer(sizeof(std::uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+        }
+
+        // Descriptors
+
+        const std::uint32_t bindingCount = 7;
+
+        m_CullDescriptorPool = DescriptorPoolBuilder(m_FramesInFlight)
+                                   .AddPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, m_FramesInFlight * bindingCount)
+                                   .Build();
+
+        m_CullDescriptorSetLayout = DescriptorSetLayoutBuilder()
+                                        // Binding 0: Transforms, 1: Instance Mesh Indices, 2: Mesh Bounds
+                                        .AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+                                        .AddBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+                                        .AddBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+                                        // Binding 3: Commands, 4: Visible Transforms, 5: Compacted Commands, 6: Draw Count
+                                        .AddBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+                                        .AddBinding(4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+                                        .AddBinding(5, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+                                        .AddBinding(6, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+                                        .Build();
+
+        m_CullDescriptorSets.resize(m_FramesInFlight);
+        std::vector<VkDescriptorSetLayout> layouts(m_FramesInFlight, m_CullDescriptorSetLayout);
+
+        VkDescriptorSetAllocateInfo descSetAllocInfo { };
+        descSetAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        descSetAllocInfo.descriptorPool = m_CullDescriptorPool;
+        descSetAllocInfo.descriptorSetCount = m_FramesInFlight;
+        descSetAllocInfo.pSetLayouts = layouts.data();
+
+        if (vkAllocateDescriptorSets(Context::GetDevice()->GetLogicalDevice(), &descSetAllocInfo, m_CullDescriptorSets.data()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create descriptor sets.");
+        }
+
+        for (std::uint32_t i = 0; i < m_FramesInFlight; ++i)
+        {
+            VkDescriptorBufferInfo bufferInfos[bindingCount] =
+            {
+                { m_InstanceBuffers[i]->GetBufferObject(), 0, VK_WHOLE_SIZE },
+                { m_InstanceMeshBuffers[i]->GetBufferObject(), 0, VK_WHOLE_SIZE },
+                { m_BoundsBuffer->GetBufferObject(), 0, VK_WHOLE_SIZE },
+                { m_IndirectBuffers[i]->GetBufferObject(), 0, VK_WHOLE_SIZE },
+                { m_VisibleBuffers[i]->GetBufferObject(), 0, VK_WHOLE_SIZE },
+                { m_CompactCommandBuffers[i]->GetBufferObject(), 0, VK_WHOLE_SIZE },
+                { m_DrawCountBuffers[i]->GetBufferObject(), 0, VK_WHOLE_SIZE }
+            };
+
+            DescriptorWriter writer(m_CullDescriptorSets[i]);
+
+            for (std::uint32_t binding = 0; binding < bindingCount; ++binding)
+            {
+                writer.WriteBuffer(binding, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &bufferInfos[binding]);
+            }
+
+            writer.Write();
+        }
+
+        // Pipelines
+
+        VkPushConstantRange pushRangeInfo { };
+        pushRangeInfo.size = sizeof(CullPC);
+        pushRangeInfo.offset = 0;
+        pushRangeInfo.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo { };
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &m_CullDescriptorSetLayout;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRangeInfo;
+
+        if (vkCreatePipelineLayout(Context::GetDevice()->GetLogicalDevice(), &pipelineLayoutInfo, nullptr, &m_CullPipelineLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create pipeline layout.");
+        }
+
+        m_CullPipeline = Pipeline::CreateCompute("shaders/cull.comp.spv", m_CullPipelineLayout);
+        m_CompactPipeline = Pipeline::CreateCompute("shaders/compact.comp.spv", m_CullPipelineLayout);
+    }
+}
\ No newline at end of file
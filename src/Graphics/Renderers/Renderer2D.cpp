@@ -1,17 +1,53 @@
 #include "WackyEngine/Graphics/Renderers/Renderer2D.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <stdexcept>
 
 #include "WackyEngine/Graphics/DescriptorUtil.h"
 #include "WackyEngine/Graphics/SwapChain.h"
-#include "WackyEngine/Graphics/UniformBufferObject.h"
 #include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Math/SIMD.h"
 
 namespace WackyEngine
 {
+    static_assert(sizeof(Rectangle) == 4 * sizeof(std::int32_t), "Batch culling loads a Rectangle as four packed ints.");
+
+    // Bit i is set if rects[i] overlaps the viewport, using the same strict test as Rectangle::Intersects.
+    static int CullFour(const Rectangle* rects, SIMD::Int4 left, SIMD::Int4 top, SIMD::Int4 right, SIMD::Int4 bottom) noexcept
+    {
+        SIMD::Int4 x = SIMD::LoadIntUnaligned(&rects[0].X);
+        SIMD::Int4 y = SIMD::LoadIntUnaligned(&rects[1].X);
+        SIMD::Int4 width = SIMD::LoadIntUnaligned(&rects[2].X);
+        SIMD::Int4 height = SIMD::LoadIntUnaligned(&rects[3].X);
+
+        SIMD::TransposeInt(x, y, width, height);
+
+        SIMD::Int4 horizontal = SIMD::AndInt(SIMD::LessThanInt(x, right), SIMD::LessThanInt(left, SIMD::AddInt(x, width)));
+        SIMD::Int4 vertical = SIMD::AndInt(SIMD::LessThanInt(y, bottom), SIMD::LessThanInt(top, SIMD::AddInt(y, height)));
+
+        return SIMD::MoveMaskInt(SIMD::AndInt(horizontal, vertical));
+    }
+
+    // Colours go to the GPU premultiplied, which is what lets alpha and additive quads share a pipeline.
+    static std::uint32_t PackBlendColour(const Vector4& colour, Renderer2D::BlendMode blendMode) noexcept
+    {
+        switch (blendMode)
+        {
+            case Renderer2D::BlendMode::Opaque:
+                return Vertex2D::PackColour(Vector3(colour.X, colour.Y, colour.Z), 1.0f);
+            case Renderer2D::BlendMode::Alpha:
+                return Vertex2D::PackColour(Vector3(colour.X * colour.W, colour.Y * colour.W, colour.Z * colour.W), colour.W);
+            default:
+                return Vertex2D::PackColour(Vector3(colour.X * colour.W, colour.Y * colour.W, colour.Z * colour.W), 0.0f);
+        }
+    }
+
     Renderer2D::Renderer2D(const RenderPass* renderPass)
+        : m_DepthTested(renderPass->HasDepth()), m_ViewProjection(Matrix4::Identity), m_Viewport(), m_Statistics { }
     {
-        InitialiseUniformBuffers();
+        m_FramesInFlight = Context::GetGraphicsInformation().FramesInFlight;
+
         InitialiseSampler();
         InitialiseDescriptors();
         InitialisePipelineLayout();
@@ -19,8 +55,8 @@ namespace WackyEngine
         
         // Buffer Setup
 
-        m_VertexBuffer = new VertexBuffer(MAX_VERTICES);
-        m_IndexBuffer = new IndexBuffer(MAX_INDICES);
+        m_VertexBuffer = new VertexBuffer(MAX_VERTICES, m_FramesInFlight);
+        m_IndexBuffer = new IndexBuffer(MAX_INDICES, m_FramesInFlight);
     }
     
     Renderer2D::~Renderer2D()
@@ -33,14 +69,10 @@ namespace WackyEngine
         vkDestroyDescriptorSetLayout(Context::GetDevice()->GetLogicalDevice(), m_GlobalDescriptorSetLayout, nullptr);
         vkDestroyDescriptorPool(Context::GetDevice()->GetLogicalDevice(), m_GlobalDescriptorPool, nullptr);
 
-        for (std::size_t i = 0; i < SwapChain::MAX_FRAMES_IN_FLIGHT; ++i)
-        {
-            delete m_UniformBuffers[i];
-        }
-
         vkDestroyPipelineLayout(Context::GetDevice()->GetLogicalDevice(), m_PipelineLayout, nullptr);
 
-        delete m_Pipeline;
+        delete m_OpaquePipeline;
+        delete m_TranslucentPipeline;
     }
 
     void Renderer2D::Begin()
@@ -48,20 +80,85 @@ namespace WackyEngine
         m_VertexBuffer->Reset();
         m_IndexBuffer->Reset();
         m_TextureBuffer.clear();
+        m_StaticDraws.clear();
+        m_OpaqueQuads.clear();
+        m_TranslucentQuads.clear();
+
+        m_Statistics = { };
     }
 
-    void Renderer2D::End(VkCommandBuffer cmdBuffer, const std::uint32_t currentIndex)
+    void Renderer2D::End(const FrameData& frameData)
     {
-        vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline->GetPipeline());
-        vkCmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1, &m_GlobalDescriptorSets[currentIndex], 0, nullptr);
+        VkCommandBuffer cmdBuffer = frameData.CmdBuffer;
+
+        // Painter's order by default, equal layers keep their submission order.
+        auto backToFront = [](const QuadCommand& first, const QuadCommand& second)
+        {
+            return first.Layer != second.Layer ? first.Layer < second.Layer : first.Order < second.Order;
+        };
+
+        auto frontToBack = [](const QuadCommand& first, const QuadCommand& second)
+        {
+            return first.Layer != second.Layer ? first.Layer > second.Layer : first.Order < second.Order;
+        };
+
+        // With depth, opaque quads go nearest layer first so covered fragments fail the early depth test instead of
+        // being shaded and overwritten. The less or equal test still lets later quads on the same layer win.
+        if (m_DepthTested)
+        {
+            std::sort(m_OpaqueQuads.begin(), m_OpaqueQuads.end(), frontToBack);
+            std::sort(m_StaticDraws.begin(), m_StaticDraws.end(), [](const StaticDraw& first, const StaticDraw& second)
+            {
+                std::int32_t firstLayer = first.Batch->GetLayer();
+                std::int32_t secondLayer = second.Batch->GetLayer();
+
+                return firstLayer != secondLayer ? firstLayer > secondLayer : first.Order < second.Order;
+            });
+        }
+        else
+        {
+            std::sort(m_OpaqueQuads.begin(), m_OpaqueQuads.end(), backToFront);
+        }
+
+        std::sort(m_TranslucentQuads.begin(), m_TranslucentQuads.end(), backToFront);
+
+        m_Runs.clear();
+
+        if (m_DepthTested)
+        {
+            // Depth resolves the layers, so opaque quads go in one run and translucent ones over the top with
+            // alpha and additive interleaved freely.
+            for (const QuadCommand& quad : m_OpaqueQuads)
+            {
+                AppendQuad(quad, false);
+            }
+
+            for (const QuadCommand& quad : m_TranslucentQuads)
+            {
+                AppendQuad(quad, true);
+            }
+        }
+        else
+        {
+            // Without depth only draw order puts higher layers on top, so both sorted lists are merged into one
+            // sequence and the pipeline switches wherever the blend mode changes.
+            auto opaque = m_OpaqueQuads.begin();
+            auto translucent = m_TranslucentQuads.begin();
+
+            while (opaque != m_OpaqueQuads.end() || translucent != m_TranslucentQuads.end())
+            {
+                bool takeTranslucent = opaque == m_OpaqueQuads.end() || (translucent != m_TranslucentQuads.end() && backToFront(*translucent, *opaque));
 
-        m_VertexBuffer->Flush();
-        m_IndexBuffer->Flush();
+                AppendQuad(takeTranslucent ? *translucent++ : *opaque++, takeTranslucent);
+            }
+        }
+
+        m_VertexBuffer->Flush(frameData.FrameIndex);
+        m_IndexBuffer->Flush(frameData.FrameIndex);
 
         // TEXTURES
 
-        VkDescriptorImageInfo textureInfo { };
-        std::vector<VkDescriptorImageInfo> textureInfos(m_TextureBuffer.size(), textureInfo);
+        VkDescriptorImageInfo* textureInfos = frameData.Arena->GetArena().AllocateArray<VkDescriptorImageInfo>(m_TextureBuffer.size());
 
         for (std::size_t i = 0; i < m_TextureBuffer.size(); ++i)
         {
@@ -70,21 +167,209 @@ namespace WackyEngine
             textureInfos[i].imageView = m_TextureBuffer[i]->GetImageView();
         }
 
-        DescriptorWriter(m_GlobalDescriptorSets[currentIndex])
-            .WriteImage(2, m_TextureBuffer.size(), VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, textureInfos.data())
+        DescriptorWriter(m_GlobalDescriptorSets[frameData.FrameIndex])
+            .WriteImage(2, m_TextureBuffer.size(), VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, textureInfos)
             .Write();
 
-        VkBuffer vertexBuffers[] = { m_VertexBuffer->GetBufferObject() };
+        // Descriptor set must be up to date before it is bound. Both pipelines share the layout so it stays bound across the switch.
+        vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_OpaquePipeline->GetPipeline());
+        vkCmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1, &m_GlobalDescriptorSets[frameData.FrameIndex], 0, nullptr);
+
+        PC pushConstants { m_ViewProjection, 0 };
+        vkCmdPushConstants(cmdBuffer, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PC), &pushConstants);
+
+        for (const StaticDraw& draw : m_StaticDraws)
+        {
+            vkCmdPushConstants(cmdBuffer, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, offsetof(PC, TextureOffset), sizeof(std::uint32_t), &draw.TextureOffset);
+            draw.Batch->Draw(cmdBuffer);
+            ++m_Statistics.DrawCalls;
+        }
+
+        if (!m_StaticDraws.empty())
+        {
+            vkCmdPushConstants(cmdBuffer, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, offsetof(PC, TextureOffset), sizeof(std::uint32_t), &pushConstants.TextureOffset);
+        }
+
+        if (m_Runs.empty())
+        {
+            return;
+        }
+
+        VkBuffer vertexBuffers[] = { m_VertexBuffer->GetBufferObject(frameData.FrameIndex) };
         VkDeviceSize offsets[] = { 0 };
         vkCmdBindVertexBuffers(cmdBuffer, 0, 1, vertexBuffers, offsets);
-        vkCmdBindIndexBuffer(cmdBuffer, m_IndexBuffer->GetBufferObject(), 0, VK_INDEX_TYPE_UINT16);
+        vkCmdBindIndexBuffer(cmdBuffer, m_IndexBuffer->GetBufferObject(frameData.FrameIndex), 0, VK_INDEX_TYPE_UINT16);
 
-        vkCmdDrawIndexed(cmdBuffer, m_IndexBuffer->GetCount(), 1, 0, 0, 0);
+        bool translucentBound = false;
+
+        for (const QuadRun& run : m_Runs)
+        {
+            if (run.Translucent != translucentBound)
+            {
+                vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, run.Translucent ? m_TranslucentPipeline->GetPipeline() : m_OpaquePipeline->GetPipeline());
+                translucentBound = run.Translucent;
+            }
+
+            vkCmdDrawIndexed(cmdBuffer, run.IndexCount, 1, run.FirstIndex, 0, 0);
+            ++m_Statistics.DrawCalls;
+        }
     }
 
     void Renderer2D::DrawRectangle(const Rectangle& rect, const Vector3& colour, Texture* texture)
     {
+        DrawRectangle(rect, Vector4(colour, 1.0f), texture, BlendMode::Opaque, 0);
+    }
+
+    void Renderer2D::DrawRectangle(const Rectangle& rect, const Vector4& colour, Texture* texture, BlendMode blendMode, std::int32_t layer)
+    {
+        if (!rect.Intersects(m_Viewport))
+        {
+            ++m_Statistics.CulledQuads;
+            return;
+        }
+
+        SubmitQuad(rect, PackBlendColour(colour, blendMode), GetTextureIndex(texture), blendMode, layer);
+    }
+
+    void Renderer2D::DrawRectangles(std::span<const Rectangle> rects, const Vector3& colour, Texture* texture)
+    {
+        DrawRectangles(rects, Vector4(colour, 1.0f), texture, BlendMode::Opaque, 0);
+    }
+
+    void Renderer2D::DrawRectangles(std::span<const Rectangle> rects, const Vector4& colour, Texture* texture, BlendMode blendMode, std::int32_t layer)
+    {
+        SIMD::Int4 left = SIMD::SplatInt(m_Viewport.GetLeft());
+        SIMD::Int4 top = SIMD::SplatInt(m_Viewport.GetTop());
+        SIMD::Int4 right = SIMD::SplatInt(m_Viewport.GetRight());
+        SIMD::Int4 bottom = SIMD::SplatInt(m_Viewport.GetBottom());
+
+        std::uint32_t packedColour = PackBlendColour(colour, blendMode);
+
+        // Texture slot is only taken once something is actually visible.
+        std::uint16_t textureIndex = 0;
+        bool textureAdded = false;
+
+        auto draw = [&](const Rectangle& rect)
+        {
+            if (!textureAdded)
+            {
+                textureIndex = GetTextureIndex(texture);
+                textureAdded = true;
+            }
+
+            SubmitQuad(rect, packedColour, textureIndex, blendMode, layer);
+        };
+
+        std::size_t i = 0;
+
+        for (; i + 4 <= rects.size(); i += 4)
+        {
+            int visible = CullFour(&rects[i], left, top, right, bottom);
+
+            if (visible == 0)
+            {
+                m_Statistics.CulledQuads += 4;
+                continue;
+            }
+
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                if (visible & (1 << j))
+                {
+                    draw(rects[i + j]);
+                }
+                else
+                {
+                    ++m_Statistics.CulledQuads;
+                }
+            }
+        }
+
+        for (; i < rects.size(); ++i)
+        {
+            if (rects[i].Intersects(m_Viewport))
+            {
+                draw(rects[i]);
+            }
+            else
+            {
+                ++m_Statistics.CulledQuads;
+            }
+        }
+    }
+
+    void Renderer2D::DrawStaticBatch(const StaticBatch& batch)
+    {
+        if (!batch.IsBuilt())
+        {
+            return;
+        }
+
+        if (!batch.GetBounds().Intersects(m_Viewport))
+        {
+            m_Statistics.CulledQuads += batch.GetQuadCount();
+            return;
+        }
+
+        if (m_TextureBuffer.size() + batch.GetTextures().size() > MAX_TEXTURES)
+        {
+            throw std::runtime_error("Failed to draw static batch, too many textures used this frame.");
+        }
+
+        m_StaticDraws.push_back({ &batch, static_cast<std::uint32_t>(m_TextureBuffer.size()), static_cast<std::uint32_t>(m_StaticDraws.size()) });
+        m_TextureBuffer.insert(m_TextureBuffer.end(), batch.GetTextures().begin(), batch.GetTextures().end());
+
+        m_Statistics.DrawnQuads += batch.GetQuadCount();
+    }
+
+    std::uint16_t Renderer2D::GetTextureIndex(Texture* texture)
+    {
+        auto it = std::find(m_TextureBuffer.begin(), m_TextureBuffer.end(), texture);
+
+        if (it != m_TextureBuffer.end())
+        {
+            return static_cast<std::uint16_t>(it - m_TextureBuffer.begin());
+        }
+
+        if (m_TextureBuffer.size() == MAX_TEXTURES)
+        {
+            throw std::runtime_error("Failed to draw rectangle, too many textures used this frame.");
+        }
+
         m_TextureBuffer.push_back(texture);
+        return static_cast<std::uint16_t>(m_TextureBuffer.size() - 1);
+    }
+
+    void Renderer2D::SubmitQuad(const Rectangle& rect, std::uint32_t colour, std::uint16_t textureIndex, BlendMode blendMode, std::int32_t layer)
+    {
+        if (m_OpaqueQuads.size() + m_TranslucentQuads.size() == MAX_QUADS)
+        {
+            throw std::runtime_error("Failed to draw rectangle, quad limit reached this frame.");
+        }
+
+        std::uint32_t order = static_cast<std::uint32_t>(m_OpaqueQuads.size() + m_TranslucentQuads.size());
+
+        std::vector<QuadCommand>& quads = blendMode == BlendMode::Opaque ? m_OpaqueQuads : m_TranslucentQuads;
+        quads.push_back({ rect, colour, textureIndex, layer, order });
+
+        ++m_Statistics.DrawnQuads;
+    }
+
+    void Renderer2D::AppendQuad(const QuadCommand& quad, bool translucent)
+    {
+        if (m_Runs.empty() || m_Runs.back().Translucent != translucent)
+        {
+            m_Runs.push_back({ static_cast<std::uint32_t>(m_IndexBuffer->GetCount()), 0, translucent });
+        }
+
+        WriteQuad(quad);
+        m_Runs.back().IndexCount += 6;
+    }
+
+    void Renderer2D::WriteQuad(const QuadCommand& quad)
+    {
+        const Rectangle& rect = quad.Rect;
+        std::uint16_t depth = Vertex2D::LayerToDepth(quad.Layer);
 
         m_IndexBuffer->AddIndex(static_cast<std::uint16_t>(m_VertexBuffer->GetCount() + 0));
         m_IndexBuffer->AddIndex(static_cast<std::uint16_t>(m_VertexBuffer->GetCount() + 1));
@@ -93,10 +378,10 @@ namespace WackyEngine
         m_IndexBuffer->AddIndex(static_cast<std::uint16_t>(m_VertexBuffer->GetCount() + 3));
         m_IndexBuffer->AddIndex(static_cast<std::uint16_t>(m_VertexBuffer->GetCount() + 0));
 
-        m_VertexBuffer->AddVertex(Vertex(Vector3(rect.X, rect.Y, 0.0f), colour, Vector2(0.0f, 0.0f), m_TextureBuffer.size() - 1));
-        m_VertexBuffer->AddVertex(Vertex(Vector3(rect.GetRight(), rect.Y, 0.0f), colour, Vector2(1.0f, 0.0f), m_TextureBuffer.size() - 1));
-        m_VertexBuffer->AddVertex(Vertex(Vector3(rect.GetRight(), rect.GetBottom(), 0.0f), colour, Vector2(1.0f, 1.0f), m_TextureBuffer.size() - 1));
-        m_VertexBuffer->AddVertex(Vertex(Vector3(rect.X, rect.GetBottom(), 0.0f), colour, Vector2(0.0f, 1.0f), m_TextureBuffer.size() - 1));
+        m_VertexBuffer->AddVertex(Vertex2D(Vector2(rect.X, rect.Y), Vector2(0.0f, 0.0f), quad.Colour, quad.TextureIndex, depth));
+        m_VertexBuffer->AddVertex(Vertex2D(Vector2(rect.GetRight(), rect.Y), Vector2(1.0f, 0.0f), quad.Colour, quad.TextureIndex, depth));
+        m_VertexBuffer->AddVertex(Vertex2D(Vector2(rect.GetRight(), rect.GetBottom()), Vector2(1.0f, 1.0f), quad.Colour, quad.TextureIndex, depth));
+        m_VertexBuffer->AddVertex(Vertex2D(Vector2(rect.X, rect.GetBottom()), Vector2(0.0f, 1.0f), quad.Colour, quad.TextureIndex, depth));
     }
 
     void Renderer2D::InitialisePipelineLayout()
@@ -122,44 +407,70 @@ namespace WackyEngine
 
     void Renderer2D::InitialisePipeline(const RenderPass* renderPass)
     {
-        PipelineConfig config { };
+        // Sprites can be mirrored with negative sizes or camera flips, so no face culling in 2D.
+        PipelineConfig opaqueConfig { };
+
+        Pipeline::GetDefaultConfig(opaqueConfig);
+        opaqueConfig.RenderPass = renderPass->GetRenderPass();
+        opaqueConfig.PipelineLayout = m_PipelineLayout;
+        opaqueConfig.RasterisationInfo.cullMode = VK_CULL_MODE_NONE;
 
-        m_Pipeline->GetDefaultConfig(config);
-        config.RenderPass = renderPass->GetRenderPass();
-        config.PipelineLayout = m_PipelineLayout;
-        m_Pipeline = new Pipeline(config);
+        if (m_DepthTested)
+        {
+            Pipeline::EnableDepthTest(opaqueConfig, true);
+        }
+
+        m_OpaquePipeline = new Pipeline(opaqueConfig);
+
+        // Premultiplied alpha: dst = src + dst * (1 - src.a)
+        PipelineConfig translucentConfig { };
+
+        Pipeline::GetDefaultConfig(translucentConfig);
+        translucentConfig.RenderPass = renderPass->GetRenderPass();
+        translucentConfig.PipelineLayout = m_PipelineLayout;
+        translucentConfig.RasterisationInfo.cullMode = VK_CULL_MODE_NONE;
+        translucentConfig.ColorBlendAttachment.blendEnable = VK_TRUE;
+        translucentConfig.ColorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+        translucentConfig.ColorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        translucentConfig.ColorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+        translucentConfig.ColorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+
+        // Hidden behind nearer opaque quads, but never hides anything itself.
+        if (m_DepthTested)
+        {
+            Pipeline::EnableDepthTest(translucentConfig, false);
+        }
+
+        m_TranslucentPipeline = new Pipeline(translucentConfig);
     }
 
     void Renderer2D::InitialiseDescriptors()
     {
         // Descriptor Pool
 
-        m_GlobalDescriptorPool = DescriptorPoolBuilder(SwapChain::MAX_FRAMES_IN_FLIGHT)
-                                    .AddPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, SwapChain::MAX_FRAMES_IN_FLIGHT)
-                                    .AddPoolSize(VK_DESCRIPTOR_TYPE_SAMPLER, SwapChain::MAX_FRAMES_IN_FLIGHT)
-                                    .AddPoolSize(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, SwapChain::MAX_FRAMES_IN_FLIGHT * MAX_TEXTURES)
+        m_GlobalDescriptorPool = DescriptorPoolBuilder(m_FramesInFlight)
+                                    .AddPoolSize(VK_DESCRIPTOR_TYPE_SAMPLER, m_FramesInFlight)
+                                    .AddPoolSize(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, m_FramesInFlight * MAX_TEXTURES)
                                     .Build();
 
         // Descriptor Set Layout
 
         m_GlobalDescriptorSetLayout = DescriptorSetLayoutBuilder()
-                                          // Binding 1: Uniform Buffer
-                                          .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT)
-                                          // Binding 2: Image Sampler
+                                          // Binding 1: Image Sampler
                                           .AddBinding(1, VK_DESCRIPTOR_TYPE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT)
-                                          // Binding 3: Texture Array
+                                          // Binding 2: Texture Array
                                           .AddBinding(2, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, MAX_TEXTURES, VK_SHADER_STAGE_FRAGMENT_BIT)
                                           .Build();
 
         // Descriptors
 
-        m_GlobalDescriptorSets.resize(SwapChain::MAX_FRAMES_IN_FLIGHT);
-        std::vector<VkDescriptorSetLayout> layouts(SwapChain::MAX_FRAMES_IN_FLIGHT, m_GlobalDescriptorSetLayout);
+        m_GlobalDescriptorSets.resize(m_FramesInFlight);
+        std::vector<VkDescriptorSetLayout> layouts(m_FramesInFlight, m_GlobalDescriptorSetLayout);
 
         VkDescriptorSetAllocateInfo descSetAllocInfo { };
         descSetAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
         descSetAllocInfo.descriptorPool = m_GlobalDescriptorPool;
-        descSetAllocInfo.descriptorSetCount = (std::uint32_t)SwapChain::MAX_FRAMES_IN_FLIGHT;
+        descSetAllocInfo.descriptorSetCount = m_FramesInFlight;
         descSetAllocInfo.pSetLayouts = layouts.data();
 
         if (vkAllocateDescriptorSets(Context::GetDevice()->GetLogicalDevice(), &descSetAllocInfo, m_GlobalDescriptorSets.data()) != VK_SUCCESS)
@@ -171,11 +482,6 @@ namespace WackyEngine
 
         for (std::size_t i = 0; i < m_GlobalDescriptorSets.size(); ++i)
         {
-            VkDescriptorBufferInfo bufferInfo { };
-            bufferInfo.buffer = m_UniformBuffers[i]->GetBufferObject();
-            bufferInfo.offset = 0;
-            bufferInfo.range = sizeof(UBO);
-
             VkDescriptorImageInfo samplerInfo { };
             samplerInfo.sampler = m_Sampler;
 
@@ -187,7 +493,6 @@ namespace WackyEngine
             std::vector<VkDescriptorImageInfo> defaultTextureInfos(MAX_TEXTURES, defaultTextureInfo);
 
             DescriptorWriter(m_GlobalDescriptorSets[i])
-                .WriteBuffer(0, 1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, &bufferInfo)
                 .WriteImage(1, 1, VK_DESCRIPTOR_TYPE_SAMPLER, &samplerInfo)
                 .WriteImage(2, MAX_TEXTURES, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, defaultTextureInfos.data())
                 .Write();
@@ -224,23 +529,15 @@ namespace WackyEngine
         }
     }
 
-    void Renderer2D::InitialiseUniformBuffers()
+    void Renderer2D::SetResolution(const std::uint32_t width, const std::uint32_t height)
     {
-        m_UniformBuffers.resize(SwapChain::MAX_FRAMES_IN_FLIGHT);
-
-        for (std::size_t i = 0; i < SwapChain::MAX_FRAMES_IN_FLIGHT; ++i)
-        {
-            m_UniformBuffers[i] = new Buffer(sizeof(UBO), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-        }
+        m_ViewProjection = Matrix4::CreateOrthographic(width, height);
+        m_Viewport = Rectangle(0, 0, width, height);
     }
 
-    void Renderer2D::SetResolution(const std::uint32_t width, const std::uint32_t height)
+    void Renderer2D::SetCamera(const Camera2D& camera) noexcept
     {
-        UBO ubo { Matrix4::CreateOrthographic(width, height) };
-
-        for (std::size_t i = 0; i < SwapChain::MAX_FRAMES_IN_FLIGHT; ++i)
-        {
-            m_UniformBuffers[i]->SetData(&ubo, sizeof(UBO));
-        }
+        m_ViewProjection = camera.GetViewProjection();
+        m_Viewport = camera.GetVisibleBounds();
     }
 }
\ No newline at end of file
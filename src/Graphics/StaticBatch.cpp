@@ -0,0 +1,207 @@
+#include "WackyEngine/Graphics/StaticBatch.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "WackyEngine/Core/Context.h"
+
+namespace WackyEngine
+{
+    StaticBatch::StaticBatch(std::int32_t layer)
+        : m_Bounds(), m_Layer(layer), m_VertexBuffer(nullptr), m_IndexBuffer(nullptr), m_StagingBuffer(nullptr), m_FramesInFlight(0),
+          m_DirtyBegin(0), m_DirtyEnd(0)
+    {
+    }
+
+    StaticBatch::~StaticBatch()
+    {
+        delete m_VertexBuffer;
+        delete m_IndexBuffer;
+        delete m_StagingBuffer;
+    }
+
+    std::uint32_t StaticBatch::AddRectangle(const Rectangle& rect, const Vector3& colour, Texture* texture)
+    {
+        if (IsBuilt())
+        {
+            throw std::runtime_error("Failed to add rectangle, static batch has already been built.");
+        }
+
+        std::uint32_t quad = GetQuadCount();
+
+        m_Vertices.resize(m_Vertices.size() + 4);
+        WriteQuad(quad, rect, colour, GetTextureIndex(texture));
+
+        return quad;
+    }
+
+    void StaticBatch::Build()
+    {
+        std::size_t quadCount = GetQuadCount();
+
+        if (IsBuilt() || quadCount == 0)
+        {
+            return;
+        }
+
+        VkDeviceSize vertexSize = m_Vertices.size() * sizeof(Vertex2D);
+        VkDeviceSize indexSize = quadCount * 6 * sizeof(std::uint32_t);
+
+        // 32-bit indices, a tile layer can easily pass the 16384 quads 16-bit indices allow.
+        std::vector<std::uint32_t> indices(quadCount * 6);
+
+        for (std::uint32_t i = 0; i < quadCount; ++i)
+        {
+            std::uint32_t vertex = i * 4;
+
+            indices[i * 6 + 0] = vertex + 0;
+            indices[i * 6 + 1] = vertex + 1;
+            indices[i * 6 + 2] = vertex + 2;
+            indices[i * 6 + 3] = vertex + 2;
+            indices[i * 6 + 4] = vertex + 3;
+            indices[i * 6 + 5] = vertex + 0;
+        }
+
+        m_VertexBuffer = new Buffer(vertexSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        m_IndexBuffer = new Buffer(indexSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        // Kept around for patches. Indices never change so they go through it once first.
+        m_FramesInFlight = Context::GetGraphicsInformation().FramesInFlight;
+        m_StagingBuffer = new Buffer(std::max(vertexSize * m_FramesInFlight, indexSize), VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        m_StagingBuffer->SetData(indices.data(), indexSize);
+        m_IndexBuffer->CopyBuffer(*m_StagingBuffer, indexSize);
+
+        m_StagingBuffer->SetData(m_Vertices.data(), vertexSize);
+        m_VertexBuffer->CopyBuffer(*m_StagingBuffer, vertexSize);
+
+        m_DirtyBegin = 0;
+        m_DirtyEnd = 0;
+    }
+
+    void StaticBatch::SetRectangle(std::uint32_t quad, const Rectangle& rect, const Vector3& colour, Texture* texture)
+    {
+        if (quad >= GetQuadCount())
+        {
+            throw std::runtime_error("Failed to set rectangle, quad index is out of range.");
+        }
+
+        WriteQuad(quad, rect, colour, GetTextureIndex(texture));
+
+        if (m_DirtyBegin == m_DirtyEnd)
+        {
+            m_DirtyBegin = quad;
+            m_DirtyEnd = quad + 1;
+        }
+        else
+        {
+            m_DirtyBegin = std::min(m_DirtyBegin, quad);
+            m_DirtyEnd = std::max(m_DirtyEnd, quad + 1);
+        }
+    }
+
+    void StaticBatch::Upload(const FrameData& frameData)
+    {
+        if (!IsBuilt() || m_DirtyBegin == m_DirtyEnd)
+        {
+            return;
+        }
+
+        VkCommandBuffer cmdBuffer = frameData.CmdBuffer;
+
+        VkDeviceSize offset = static_cast<VkDeviceSize>(m_DirtyBegin) * 4 * sizeof(Vertex2D);
+        VkDeviceSize size = static_cast<VkDeviceSize>(m_DirtyEnd - m_DirtyBegin) * 4 * sizeof(Vertex2D);
+        VkDeviceSize stagingOffset = static_cast<VkDeviceSize>(frameData.FrameIndex) * m_Vertices.size() * sizeof(Vertex2D) + offset;
+
+        // The slot's region was last read by the copy recorded FramesInFlight frames ago, whose fence has been waited on.
+        m_StagingBuffer->SetData(&m_Vertices[m_DirtyBegin * 4], size, stagingOffset);
+
+        // Earlier frames may still be reading the vertices being overwritten, or still copying their own patch in.
+        VkMemoryBarrier writeBarrier { };
+        writeBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        writeBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        writeBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &writeBarrier, 0, nullptr, 0, nullptr);
+
+        VkBufferCopy copyRegion { };
+        copyRegion.srcOffset = stagingOffset;
+        copyRegion.dstOffset = offset;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(cmdBuffer, m_StagingBuffer->GetBufferObject(), m_VertexBuffer->GetBufferObject(), 1, &copyRegion);
+
+        VkBufferMemoryBarrier barrier { };
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = m_VertexBuffer->GetBufferObject();
+        barrier.offset = offset;
+        barrier.size = size;
+
+        vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+        m_DirtyBegin = 0;
+        m_DirtyEnd = 0;
+    }
+
+    void StaticBatch::Draw(VkCommandBuffer cmdBuffer) const
+    {
+        if (!IsBuilt())
+        {
+            return;
+        }
+
+        VkBuffer vertexBuffers[] = { m_VertexBuffer->GetBufferObject() };
+        VkDeviceSize offsets[] = { 0 };
+        vkCmdBindVertexBuffers(cmdBuffer, 0, 1, vertexBuffers, offsets);
+        vkCmdBindIndexBuffer(cmdBuffer, m_IndexBuffer->GetBufferObject(), 0, VK_INDEX_TYPE_UINT32);
+
+        vkCmdDrawIndexed(cmdBuffer, GetQuadCount() * 6, 1, 0, 0, 0);
+    }
+
+    std::uint32_t StaticBatch::GetTextureIndex(Texture* texture)
+    {
+        auto it = std::find(m_Textures.begin(), m_Textures.end(), texture);
+
+        if (it != m_Textures.end())
+        {
+            return static_cast<std::uint32_t>(it - m_Textures.begin());
+        }
+
+        if (m_Textures.size() == MAX_TEXTURES)
+        {
+            throw std::runtime_error("Failed to add texture, static batch already uses the maximum number of textures.");
+        }
+
+        m_Textures.push_back(texture);
+        return static_cast<std::uint32_t>(m_Textures.size() - 1);
+    }
+
+    void StaticBatch::WriteQuad(std::uint32_t quad, const Rectangle& rect, const Vector3& colour, std::uint32_t textureIndex)
+    {
+        std::uint32_t packedColour = Vertex2D::PackColour(colour);
+        std::uint16_t depth = Vertex2D::LayerToDepth(m_Layer);
+
+        m_Vertices[quad * 4 + 0] = Vertex2D(Vector2(rect.X, rect.Y), Vector2(0.0f, 0.0f), packedColour, textureIndex, depth);
+        m_Vertices[quad * 4 + 1] = Vertex2D(Vector2(rect.GetRight(), rect.Y), Vector2(1.0f, 0.0f), packedColour, textureIndex, depth);
+        m_Vertices[quad * 4 + 2] = Vertex2D(Vector2(rect.GetRight(), rect.GetBottom()), Vector2(1.0f, 1.0f), packedColour, textureIndex, depth);
+        m_Vertices[quad * 4 + 3] = Vertex2D(Vector2(rect.X, rect.GetBottom()), Vector2(0.0f, 1.0f), packedColour, textureIndex, depth);
+
+        if (m_Vertices.size() == 4)
+        {
+            m_Bounds = rect;
+        }
+        else
+        {
+            int left = std::min(m_Bounds.GetLeft(), rect.GetLeft());
+            int top = std::min(m_Bounds.GetTop(), rect.GetTop());
+            int right = std::max(m_Bounds.GetRight(), rect.GetRight());
+            int bottom = std::max(m_Bounds.GetBottom(), rect.GetBottom());
+
+            m_Bounds = Rectangle(left, top, right - left, bottom - top);
+        }
+    }
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "WackyEngine/Graphics/SwapChain.h"
 
 #include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <iostream>
 
@@ -8,16 +9,23 @@
 
 namespace WackyEngine
 {
-    const int SwapChain::MAX_FRAMES_IN_FLIGHT = 3;
-
     SwapChain::SwapChain()
     {
+        m_PreferredPresentMode = Context::GetGraphicsInformation().PresentMode;
+        m_PreferredImageCount = Context::GetGraphicsInformation().ImageCount;
+        m_FramesInFlight = Context::GetGraphicsInformation().FramesInFlight;
+        m_DepthFormat = Context::GetGraphicsInformation().DepthBuffer ? Context::GetDevice()->SelectDepthFormat() : VK_FORMAT_UNDEFINED;
+
         Initialise();
     }
 
     void SwapChain::Initialise()
     {
-        CreateSwapchain();
+        m_SwapChain = VK_NULL_HANDLE;
+        m_RenderPass = nullptr;
+        m_Format = { };
+
+        CreateSwapchain(VK_NULL_HANDLE);
         InitialiseSyncObjects();
     }
 
@@ -28,49 +36,99 @@ namespace WackyEngine
             glfwWaitEvents();
         }
 
-        vkDeviceWaitIdle(Context::GetDevice()->GetLogicalDevice());
-
-        // Cleaning Old Objects
-
-        delete m_RenderPass;
+        // Retiring Old Objects
+        // Frames still in flight may reference these, the device destroys them once those frames have completed
+        // rather than idling the whole device.
 
         for (std::size_t i = 0; i < m_Framebuffers.size(); ++i)
         {
-            vkDestroyFramebuffer(Context::GetDevice()->GetLogicalDevice(), m_Framebuffers[i], nullptr);
+            Context::GetDevice()->DestroyDeferred(m_Framebuffers[i]);
         }
 
         for (std::size_t i = 0; i < m_ImageViews.size(); ++i)
         {
-            vkDestroyImageView(Context::GetDevice()->GetLogicalDevice(), m_ImageViews[i], nullptr);
+            Context::GetDevice()->DestroyDeferred(m_ImageViews[i]);
         }
 
-        vkDestroySwapchainKHR(Context::GetDevice()->GetLogicalDevice(), m_SwapChain, nullptr);
+        if (m_DepthImageView != VK_NULL_HANDLE)
+        {
+            Context::GetDevice()->DestroyDeferred(m_DepthImageView);
+            Context::GetDevice()->DestroyDeferred(m_DepthImage);
+            Context::GetDevice()->DestroyDeferred(m_DepthMemory);
+        }
+
+        m_ImageViews.clear();
+        m_Framebuffers.clear();
 
         // Recreating Swap Chain
 
-        CreateSwapchain();
+        VkSwapchainKHR oldSwapchain = m_SwapChain;
+        RenderPass* previousPass = m_RenderPass;
+
+        CreateSwapchain(oldSwapchain);
+
+        if (m_RenderPass != previousPass)
+        {
+            delete previousPass;
+        }
+
+        Context::GetDevice()->DestroyDeferred(oldSwapchain);
+    }
+
+    void SwapChain::SetPresentMode(VkPresentModeKHR presentMode)
+    {
+        m_PreferredPresentMode = presentMode;
+        Reinitialise();
     }
 
-    void SwapChain::CreateSwapchain()
+    void SwapChain::SetImageCount(std::uint32_t imageCount)
     {
-        m_CurrentFrame = 0;
+        m_PreferredImageCount = imageCount;
+        Reinitialise();
+    }
+
+    std::uint32_t SwapChain::SelectImageCount(const VkSurfaceCapabilitiesKHR& capabilities) const noexcept
+    {
+        std::uint32_t imageCount = m_PreferredImageCount ? m_PreferredImageCount : capabilities.minImageCount + 1;
+
+        // A maximum of zero means there is no limit.
+        std::uint32_t maxImageCount = capabilities.maxImageCount ? capabilities.maxImageCount : std::numeric_limits<std::uint32_t>::max();
+
+        return std::clamp(imageCount, capabilities.minImageCount, maxImageCount);
+    }
+
+    void SwapChain::CreateSwapchain(VkSwapchainKHR oldSwapchain)
+    {
+        VkFormat previousFormat = m_Format.format;
 
         VkSurfaceCapabilitiesKHR capabilities = Context::GetDevice()->GetSurfaceCapabilities();
         m_Format = Context::GetDevice()->SelectSwapSurfaceFormat();
-        m_PresentMode = Context::GetDevice()->SelectSwapPresentMode();
+        m_PresentMode = Context::GetDevice()->SelectSwapPresentMode(m_PreferredPresentMode);
         m_Extent = Context::GetDevice()->SelectSwapExtent();
 
-        m_RenderPass = RenderPass::CreateSimplePass(m_Format.format);
+        // The render pass only depends on the format, which almost never changes across a resize.
+        if (!m_RenderPass || m_Format.format != previousFormat)
+        {
+            m_RenderPass = RenderPass::CreateSimplePass(m_Format.format, m_DepthFormat);
+        }
 
         VkSwapchainCreateInfoKHR info { };
         info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
-        info.minImageCount = std::clamp(capabilities.minImageCount + 1, (std::uint32_t)0, capabilities.maxImageCount);;
+        info.minImageCount = SelectImageCount(capabilities);
         info.imageFormat = m_Format.format;
         info.imageColorSpace = m_Format.colorSpace;
         info.imageExtent = m_Extent;
         info.imageArrayLayers = 1;
         info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
 
+        // Lets frames be captured, almost every surface allows it.
+        m_CanReadBack = (capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) != 0;
+
+        if (m_CanReadBack)
+        {
+            info.imageUsage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        }
+
         QueueFamilyIndices indices = Device::LocateQueueFamilies(Context::GetDevice()->GetPhysicalDevice());
         std::uint32_t queueFamilyIndices[] = { indices.GraphicsFamily.value(), indices.PresentFamily.value() };
 
@@ -92,7 +150,7 @@ namespace WackyEngine
         info.clipped = VK_TRUE;
         info.surface = Context::GetWindow()->GetSurface();
         info.presentMode = m_PresentMode;
-        info.oldSwapchain = nullptr;
+        info.oldSwapchain = oldSwapchain;
 
         if (vkCreateSwapchainKHR(Context::GetDevice()->GetLogicalDevice(), &info, nullptr, &m_SwapChain) != VK_SUCCESS)
         {
@@ -100,6 +158,7 @@ namespace WackyEngine
         }
 
         InitialiseImageViews();
+        InitialiseDepthResources();
         InitialiseFramebuffers();
     }
 
@@ -140,24 +199,48 @@ namespace WackyEngine
         }
     }
 
+    void SwapChain::InitialiseDepthResources()
+    {
+        if (m_DepthFormat == VK_FORMAT_UNDEFINED)
+        {
+            return;
+        }
+
+        // Depth never outlives the render pass, so the image is transient and tile based GPUs can keep it on chip.
+        Context::GetDevice()->CreateImage(m_Extent.width, m_Extent.height, m_DepthFormat, VK_IMAGE_TILING_OPTIMAL,
+            VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_DepthImage, m_DepthMemory);
+
+        VkImageViewCreateInfo viewInfo { };
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_DepthImage;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = m_DepthFormat;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(Context::GetDevice()->GetLogicalDevice(), &viewInfo, nullptr, &m_DepthImageView) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create depth image view.");
+        }
+    }
+
     void SwapChain::InitialiseSyncObjects()
     {
-        m_ImageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-        m_RenderCompleteSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-        m_InFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
+        m_ImageAvailableSemaphores.resize(m_FramesInFlight);
+        m_RenderCompleteSemaphores.resize(m_FramesInFlight);
+        m_FrameTimelineValues.assign(m_FramesInFlight, 0);
 
+        // Acquire and present only take binary semaphores, frame completion is tracked on the device timeline.
         VkSemaphoreCreateInfo semaphoreInfo { };
         semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-        VkFenceCreateInfo fenceInfo { };
-        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-
-        for (std::size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+        for (std::size_t i = 0; i < m_FramesInFlight; ++i)
         {
             if (vkCreateSemaphore(Context::GetDevice()->GetLogicalDevice(), &semaphoreInfo, nullptr, &m_ImageAvailableSemaphores[i]) != VK_SUCCESS ||
-                vkCreateSemaphore(Context::GetDevice()->GetLogicalDevice(), &semaphoreInfo, nullptr, &m_RenderCompleteSemaphores[i]) != VK_SUCCESS ||
-                vkCreateFence(Context::GetDevice()->GetLogicalDevice(), &fenceInfo, nullptr, &m_InFlightFences[i]) != VK_SUCCESS)
+                vkCreateSemaphore(Context::GetDevice()->GetLogicalDevice(), &semaphoreInfo, nullptr, &m_RenderCompleteSemaphores[i]) != VK_SUCCESS)
             {
                 throw std::runtime_error("Failed to create syncronisation objects.");
             }
@@ -170,12 +253,12 @@ namespace WackyEngine
 
         for (std::size_t i = 0; i < m_ImageViews.size(); ++i)
         {
-            VkImageView attachments[] = { m_ImageViews[i] };
+            VkImageView attachments[] = { m_ImageViews[i], m_DepthImageView };
 
             VkFramebufferCreateInfo info { };
             info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
             info.renderPass = m_RenderPass->GetRenderPass();
-            info.attachmentCount = 1;
+            info.attachmentCount = m_RenderPass->HasDepth() ? 2 : 1;
             info.pAttachments = attachments;
             info.width = m_Extent.width;
             info.height = m_Extent.height;
@@ -192,11 +275,10 @@ namespace WackyEngine
     {
         delete m_RenderPass;
 
-        for (std::size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+        for (std::size_t i = 0; i < m_FramesInFlight; ++i)
         {
             vkDestroySemaphore(Context::GetDevice()->GetLogicalDevice(), m_ImageAvailableSemaphores[i], nullptr);
             vkDestroySemaphore(Context::GetDevice()->GetLogicalDevice(), m_RenderCompleteSemaphores[i], nullptr);
-            vkDestroyFence(Context::GetDevice()->GetLogicalDevice(), m_InFlightFences[i], nullptr);
         }
 
         for (std::size_t i = 0; i < m_Framebuffers.size(); ++i)
@@ -209,36 +291,30 @@ namespace WackyEngine
             vkDestroyImageView(Context::GetDevice()->GetLogicalDevice(), m_ImageViews[i], nullptr);
         }
 
+        if (m_DepthImageView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(Context::GetDevice()->GetLogicalDevice(), m_DepthImageView, nullptr);
+            vkDestroyImage(Context::GetDevice()->GetLogicalDevice(), m_DepthImage, nullptr);
+            vkFreeMemory(Context::GetDevice()->GetLogicalDevice(), m_DepthMemory, nullptr);
+        }
+
         vkDestroySwapchainKHR(Context::GetDevice()->GetLogicalDevice(), m_SwapChain, nullptr);
     }
 
     VkResult SwapChain::AcquireNextImage(std::uint32_t& imageIndex)
     {
-        vkWaitForFences(Context::GetDevice()->GetLogicalDevice(), 1, &m_InFlightFences[m_CurrentFrame], VK_TRUE, UINT64_MAX);
+        Context::GetDevice()->WaitForValue(m_FrameTimelineValues[m_CurrentFrame]);
+        Context::GetDevice()->CollectDeletions();
+
         return vkAcquireNextImageKHR(Context::GetDevice()->GetLogicalDevice(), m_SwapChain, UINT64_MAX, m_ImageAvailableSemaphores[m_CurrentFrame], VK_NULL_HANDLE, &imageIndex);
     }
 
     VkResult SwapChain::SubmitCommandBuffers(const VkCommandBuffer buffer, const std::uint32_t imageIndex)
     {
-        vkResetFences(Context::GetDevice()->GetLogicalDevice(), 1, &m_InFlightFences[m_CurrentFrame]);
-
-        VkSemaphore waitSemaphores[] = { m_ImageAvailableSemaphores[m_CurrentFrame] };
-        VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
         VkSemaphore signalSemaphores[] = { m_RenderCompleteSemaphores[m_CurrentFrame] };
-        VkSubmitInfo submitInfo { };
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.waitSemaphoreCount = 1;
-        submitInfo.pWaitSemaphores = waitSemaphores;
-        submitInfo.pWaitDstStageMask = waitStages;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &buffer;
-        submitInfo.signalSemaphoreCount = 1;
-        submitInfo.pSignalSemaphores = signalSemaphores;
-
-        if (vkQueueSubmit(Context::GetDevice()->GetGraphicsQueue(), 1, &submitInfo, m_InFlightFences[m_CurrentFrame]) != VK_SUCCESS)
-        {
-            throw std::runtime_error("Failed to submit draw command buffer.");
-        }
+
+        m_FrameTimelineValues[m_CurrentFrame] = Context::GetDevice()->SubmitGraphics(buffer, m_ImageAvailableSemaphores[m_CurrentFrame], VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, signalSemaphores[0]);
+        Context::GetDevice()->RetireDeletions(m_FrameTimelineValues[m_CurrentFrame]);
 
         VkSwapchainKHR swapChains[] = { m_SwapChain };
         VkPresentInfoKHR presentInfo { };
@@ -252,7 +328,7 @@ namespace WackyEngine
 
         VkResult result = vkQueuePresentKHR(Context::GetDevice()->GetPresentQueue(), &presentInfo);
 
-        m_CurrentFrame = (m_CurrentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+        m_CurrentFrame = (m_CurrentFrame + 1) % m_FramesInFlight;
 
         return result;
     }
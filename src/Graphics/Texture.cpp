@@ -67,9 +67,9 @@ namespace WackyEngine
     Texture::~Texture()
     {
         // vkDestroySampler(Context::GetDevice()->GetLogicalDevice(), m_TextureSampler, nullptr);
-        vkDestroyImageView(Context::GetDevice()->GetLogicalDevice(), m_TextureImageView, nullptr);
-        vkDestroyImage(Context::GetDevice()->GetLogicalDevice(), m_TextureImage, nullptr);
-        vkFreeMemory(Context::GetDevice()->GetLogicalDevice(), m_TextureImageMemory, nullptr);
+        Context::GetDevice()->DestroyDeferred(m_TextureImageView);
+        Context::GetDevice()->DestroyDeferred(m_TextureImage);
+        Context::GetDevice()->DestroyDeferred(m_TextureImageMemory);
     }
     
     // void Texture::InitialiseSampler()
@@ -0,0 +1,346 @@
+#include "WackyEngine/Math/DynamicAABBTree.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace WackyEngine
+{
+    DynamicAABBTree::DynamicAABBTree(int margin) : m_Root(NULL_NODE), m_FreeList(NULL_NODE), m_ProxyCount(0), m_Margin(margin)
+    {
+    }
+
+    std::int32_t DynamicAABBTree::Insert(const Rectangle& bounds, std::uint64_t userData)
+    {
+        std::int32_t proxy = AllocateNode();
+
+        Node& node = m_Nodes[proxy];
+        node.Bounds = Rectangle(bounds.X - m_Margin, bounds.Y - m_Margin, bounds.Width + 2 * m_Margin, bounds.Height + 2 * m_Margin);
+        node.UserData = userData;
+        node.Height = 0;
+
+        InsertLeaf(proxy);
+        ++m_ProxyCount;
+
+        return proxy;
+    }
+
+    void DynamicAABBTree::Remove(std::int32_t proxy)
+    {
+        RemoveLeaf(proxy);
+        FreeNode(proxy);
+        --m_ProxyCount;
+    }
+
+    bool DynamicAABBTree::Move(std::int32_t proxy, const Rectangle& bounds, const Vector2& displacement)
+    {
+        const Rectangle& treeBounds = m_Nodes[proxy].Bounds;
+
+        Rectangle fatBounds(bounds.X - m_Margin, bounds.Y - m_Margin, bounds.Width + 2 * m_Margin, bounds.Height + 2 * m_Margin);
+
+        if (treeBounds.Contains(bounds))
+        {
+            // Still inside, but a proxy that has stopped moving shouldn't keep a huge stretched box around.
+            int hugeMargin = 4 * m_Margin;
+            Rectangle hugeBounds(fatBounds.X - hugeMargin, fatBounds.Y - hugeMargin, fatBounds.Width + 2 * hugeMargin, fatBounds.Height + 2 * hugeMargin);
+
+            if (hugeBounds.Contains(treeBounds))
+            {
+                return false;
+            }
+        }
+
+        int dx = static_cast<int>(displacement.X);
+        int dy = static_cast<int>(displacement.Y);
+
+        if (dx < 0) { fatBounds.X += dx; }
+        if (dy < 0) { fatBounds.Y += dy; }
+
+        fatBounds.Width += std::abs(dx);
+        fatBounds.Height += std::abs(dy);
+
+        RemoveLeaf(proxy);
+        m_Nodes[proxy].Bounds = fatBounds;
+        InsertLeaf(proxy);
+
+        return true;
+    }
+
+    void DynamicAABBTree::Clear() noexcept
+    {
+        m_Nodes.clear();
+        m_Root = NULL_NODE;
+        m_FreeList = NULL_NODE;
+        m_ProxyCount = 0;
+    }
+
+    std::int32_t DynamicAABBTree::GetHeight() const noexcept
+    {
+        return m_Root == NULL_NODE ? 0 : m_Nodes[m_Root].Height;
+    }
+
+    // Node Pool
+
+    std::int32_t DynamicAABBTree::AllocateNode()
+    {
+        std::int32_t node;
+
+        if (m_FreeList != NULL_NODE)
+        {
+            node = m_FreeList;
+            m_FreeList = m_Nodes[node].Parent;
+        }
+        else
+        {
+            node = static_cast<std::int32_t>(m_Nodes.size());
+            m_Nodes.emplace_back();
+        }
+
+        m_Nodes[node].Parent = NULL_NODE;
+        m_Nodes[node].Child1 = NULL_NODE;
+        m_Nodes[node].Child2 = NULL_NODE;
+        m_Nodes[node].Height = 0;
+        m_Nodes[node].UserData = 0;
+
+        return node;
+    }
+
+    void DynamicAABBTree::FreeNode(std::int32_t node)
+    {
+        m_Nodes[node].Parent = m_FreeList;
+        m_Nodes[node].Height = -1;
+        m_FreeList = node;
+    }
+
+    // Tree Maintenance
+
+    void DynamicAABBTree::InsertLeaf(std::int32_t leaf)
+    {
+        if (m_Root == NULL_NODE)
+        {
+            m_Root = leaf;
+            m_Nodes[leaf].Parent = NULL_NODE;
+            return;
+        }
+
+        // Walk down picking whichever side grows the perimeter least, stopping when making a new sibling here is cheaper.
+        Rectangle leafBounds = m_Nodes[leaf].Bounds;
+        std::int32_t index = m_Root;
+
+        while (!m_Nodes[index].IsLeaf())
+        {
+            const Node& node = m_Nodes[index];
+
+            std::int64_t perimeter = GetPerimeter(node.Bounds);
+            std::int64_t combinedPerimeter = GetPerimeter(Combine(node.Bounds, leafBounds));
+
+            std::int64_t cost = 2 * combinedPerimeter;
+            std::int64_t inheritanceCost = 2 * (combinedPerimeter - perimeter);
+
+            auto descendCost = [&](std::int32_t child)
+            {
+                const Node& childNode = m_Nodes[child];
+                std::int64_t childCost = GetPerimeter(Combine(leafBounds, childNode.Bounds)) + inheritanceCost;
+
+                return childNode.IsLeaf() ? childCost : childCost - GetPerimeter(childNode.Bounds);
+            };
+
+            std::int64_t cost1 = descendCost(node.Child1);
+            std::int64_t cost2 = descendCost(node.Child2);
+
+            if (cost < cost1 && cost < cost2)
+            {
+                break;
+            }
+
+            index = cost1 < cost2 ? node.Child1 : node.Child2;
+        }
+
+        std::int32_t sibling = index;
+        std::int32_t oldParent = m_Nodes[sibling].Parent;
+        std::int32_t newParent = AllocateNode();
+
+        m_Nodes[newParent].Parent = oldParent;
+        m_Nodes[newParent].Bounds = Combine(leafBounds, m_Nodes[sibling].Bounds);
+        m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+        m_Nodes[newParent].Child1 = sibling;
+        m_Nodes[newParent].Child2 = leaf;
+
+        if (oldParent != NULL_NODE)
+        {
+            if (m_Nodes[oldParent].Child1 == sibling)
+            {
+                m_Nodes[oldParent].Child1 = newParent;
+            }
+            else
+            {
+                m_Nodes[oldParent].Child2 = newParent;
+            }
+        }
+        else
+        {
+            m_Root = newParent;
+        }
+
+        m_Nodes[sibling].Parent = newParent;
+        m_Nodes[leaf].Parent = newParent;
+
+        // Refit and rebalance back up to the root.
+        index = m_Nodes[leaf].Parent;
+
+        while (index != NULL_NODE)
+        {
+            index = Balance(index);
+
+            Node& node = m_Nodes[index];
+            node.Height = 1 + std::max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+            node.Bounds = Combine(m_Nodes[node.Child1].Bounds, m_Nodes[node.Child2].Bounds);
+
+            index = node.Parent;
+        }
+    }
+
+    void DynamicAABBTree::RemoveLeaf(std::int32_t leaf)
+    {
+        if (leaf == m_Root)
+        {
+            m_Root = NULL_NODE;
+            return;
+        }
+
+        std::int32_t parent = m_Nodes[leaf].Parent;
+        std::int32_t grandParent = m_Nodes[parent].Parent;
+        std::int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+        FreeNode(parent);
+
+        if (grandParent == NULL_NODE)
+        {
+            m_Root = sibling;
+            m_Nodes[sibling].Parent = NULL_NODE;
+            return;
+        }
+
+        if (m_Nodes[grandParent].Child1 == parent)
+        {
+            m_Nodes[grandParent].Child1 = sibling;
+        }
+        else
+        {
+            m_Nodes[grandParent].Child2 = sibling;
+        }
+
+        m_Nodes[sibling].Parent = grandParent;
+
+        std::int32_t index = grandParent;
+
+        while (index != NULL_NODE)
+        {
+            index = Balance(index);
+
+            Node& node = m_Nodes[index];
+            node.Height = 1 + std::max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+            node.Bounds = Combine(m_Nodes[node.Child1].Bounds, m_Nodes[node.Child2].Bounds);
+
+            index = node.Parent;
+        }
+    }
+
+    std::int32_t DynamicAABBTree::Balance(std::int32_t indexA)
+    {
+        Node& a = m_Nodes[indexA];
+
+        if (a.IsLeaf() || a.Height < 2)
+        {
+            return indexA;
+        }
+
+        std::int32_t indexB = a.Child1;
+        std::int32_t indexC = a.Child2;
+        Node& b = m_Nodes[indexB];
+        Node& c = m_Nodes[indexC];
+
+        std::int32_t balance = c.Height - b.Height;
+
+        // Rotates the taller child (up) into A's place, A takes the up node's shorter child and up keeps the taller.
+        auto rotate = [&](std::int32_t indexUp, Node& up, Node& other, bool upIsChild2) -> std::int32_t
+        {
+            std::int32_t indexF = up.Child1;
+            std::int32_t indexG = up.Child2;
+            Node& f = m_Nodes[indexF];
+            Node& g = m_Nodes[indexG];
+
+            up.Child1 = indexA;
+            up.Parent = a.Parent;
+            a.Parent = indexUp;
+
+            if (up.Parent != NULL_NODE)
+            {
+                if (m_Nodes[up.Parent].Child1 == indexA)
+                {
+                    m_Nodes[up.Parent].Child1 = indexUp;
+                }
+                else
+                {
+                    m_Nodes[up.Parent].Child2 = indexUp;
+                }
+            }
+            else
+            {
+                m_Root = indexUp;
+            }
+
+            std::int32_t indexKeep = f.Height > g.Height ? indexF : indexG;
+            std::int32_t indexGive = f.Height > g.Height ? indexG : indexF;
+            Node& keep = m_Nodes[indexKeep];
+            Node& give = m_Nodes[indexGive];
+
+            up.Child2 = indexKeep;
+
+            if (upIsChild2)
+            {
+                a.Child2 = indexGive;
+            }
+            else
+            {
+                a.Child1 = indexGive;
+            }
+
+            give.Parent = indexA;
+
+            a.Bounds = Combine(other.Bounds, give.Bounds);
+            up.Bounds = Combine(a.Bounds, keep.Bounds);
+
+            a.Height = 1 + std::max(other.Height, give.Height);
+            up.Height = 1 + std::max(a.Height, keep.Height);
+
+            return indexUp;
+        };
+
+        if (balance > 1)
+        {
+            return rotate(indexC, c, b, true);
+        }
+
+        if (balance < -1)
+        {
+            return rotate(indexB, b, c, false);
+        }
+
+        return indexA;
+    }
+
+    Rectangle DynamicAABBTree::Combine(const Rectangle& firstRect, const Rectangle& secondRect) noexcept
+    {
+        int left = std::min(firstRect.GetLeft(), secondRect.GetLeft());
+        int top = std::min(firstRect.GetTop(), secondRect.GetTop());
+        int right = std::max(firstRect.GetRight(), secondRect.GetRight());
+        int bottom = std::max(firstRect.GetBottom(), secondRect.GetBottom());
+
+        return Rectangle(left, top, right - left, bottom - top);
+    }
+
+    std::int64_t DynamicAABBTree::GetPerimeter(const Rectangle& rect) noexcept
+    {
+        return 2 * (static_cast<std::int64_t>(rect.Width) + rect.Height);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include "WackyEngine/Math/TransformBatch.h"
+
+#include "WackyEngine/Math/SIMD.h"
+
+namespace WackyEngine
+{
+    // 2D
+
+    static void Transform2(const Matrix4& matrix, const float* x, const float* y, float* outX, float* outY, std::size_t count, float w) noexcept
+    {
+        SIMD::FloatWide m11 = SIMD::SplatWide(matrix.M11), m12 = SIMD::SplatWide(matrix.M12), m14 = SIMD::SplatWide(matrix.M14 * w);
+        SIMD::FloatWide m21 = SIMD::SplatWide(matrix.M21), m22 = SIMD::SplatWide(matrix.M22), m24 = SIMD::SplatWide(matrix.M24 * w);
+
+        std::size_t i = 0;
+
+        for (; i + SIMD::WIDE_LANES <= count; i += SIMD::WIDE_LANES)
+        {
+            SIMD::FloatWide vx = SIMD::LoadWide(x + i);
+            SIMD::FloatWide vy = SIMD::LoadWide(y + i);
+
+            SIMD::StoreWide(outX + i, SIMD::MultiplyAddWide(m11, vx, SIMD::MultiplyAddWide(m12, vy, m14)));
+            SIMD::StoreWide(outY + i, SIMD::MultiplyAddWide(m21, vx, SIMD::MultiplyAddWide(m22, vy, m24)));
+        }
+
+        for (; i < count; ++i)
+        {
+            float vx = x[i];
+            float vy = y[i];
+
+            outX[i] = matrix.M11 * vx + matrix.M12 * vy + matrix.M14 * w;
+            outY[i] = matrix.M21 * vx + matrix.M22 * vy + matrix.M24 * w;
+        }
+    }
+
+    void TransformBatch::TransformPoints(const Matrix4& matrix, std::span<const float> x, std::span<const float> y,
+                                         std::span<float> outX, std::span<float> outY) noexcept
+    {
+        Transform2(matrix, x.data(), y.data(), outX.data(), outY.data(), x.size(), 1.0f);
+    }
+
+    void TransformBatch::TransformDirections(const Matrix4& matrix, std::span<const float> x, std::span<const float> y,
+                                             std::span<float> outX, std::span<float> outY) noexcept
+    {
+        Transform2(matrix, x.data(), y.data(), outX.data(), outY.data(), x.size(), 0.0f);
+    }
+
+    // 3D
+
+    static void Transform3(const Matrix4& matrix, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, std::size_t count, float w) noexcept
+    {
+        SIMD::FloatWide m11 = SIMD::SplatWide(matrix.M11), m12 = SIMD::SplatWide(matrix.M12), m13 = SIMD::SplatWide(matrix.M13), m14 = SIMD::SplatWide(matrix.M14 * w);
+        SIMD::FloatWide m21 = SIMD::SplatWide(matrix.M21), m22 = SIMD::SplatWide(matrix.M22), m23 = SIMD::SplatWide(matrix.M23), m24 = SIMD::SplatWide(matrix.M24 * w);
+        SIMD::FloatWide m31 = SIMD::SplatWide(matrix.M31), m32 = SIMD::SplatWide(matrix.M32), m33 = SIMD::SplatWide(matrix.M33), m34 = SIMD::SplatWide(matrix.M34 * w);
+
+        std::size_t i = 0;
+
+        for (; i + SIMD::WIDE_LANES <= count; i += SIMD::WIDE_LANES)
+        {
+            SIMD::FloatWide vx = SIMD::LoadWide(x + i);
+            SIMD::FloatWide vy = SIMD::LoadWide(y + i);
+            SIMD::FloatWide vz = SIMD::LoadWide(z + i);
+
+            SIMD::StoreWide(outX + i, SIMD::MultiplyAddWide(m11, vx, SIMD::MultiplyAddWide(m12, vy, SIMD::MultiplyAddWide(m13, vz, m14))));
+            SIMD::StoreWide(outY + i, SIMD::MultiplyAddWide(m21, vx, SIMD::MultiplyAddWide(m22, vy, SIMD::MultiplyAddWide(m23, vz, m24))));
+            SIMD::StoreWide(outZ + i, SIMD::MultiplyAddWide(m31, vx, SIMD::MultiplyAddWide(m32, vy, SIMD::MultiplyAddWide(m33, vz, m34))));
+        }
+
+        for (; i < count; ++i)
+        {
+            float vx = x[i];
+            float vy = y[i];
+            float vz = z[i];
+
+            outX[i] = matrix.M11 * vx + matrix.M12 * vy + matrix.M13 * vz + matrix.M14 * w;
+            outY[i] = matrix.M21 * vx + matrix.M22 * vy + matrix.M23 * vz + matrix.M24 * w;
+            outZ[i] = matrix.M31 * vx + matrix.M32 * vy + matrix.M33 * vz + matrix.M34 * w;
+        }
+    }
+
+    void TransformBatch::TransformPoints(const Matrix4& matrix, std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                                         std::span<float> outX, std::span<float> outY, std::span<float> outZ) noexcept
+    {
+        Transform3(matrix, x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), x.size(), 1.0f);
+    }
+
+    void TransformBatch::TransformDirections(const Matrix4& matrix, std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                                             std::span<float> outX, std::span<float> outY, std::span<float> outZ) noexcept
+    {
+        Transform3(matrix, x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), x.size(), 0.0f);
+    }
+
+    // Rectangles
+
+    void TransformBatch::TransformRects(const Matrix4& matrix, std::span<const float> x, std::span<const float> y,
+                                        std::span<const float> width, std::span<const float> height,
+                                        std::span<float> outX, std::span<float> outY) noexcept
+    {
+        // Only the top-left corner needs a full transform, the others are offset along the transformed axes.
+        std::size_t count = x.size();
+
+        float* topLeftX = outX.data();
+        float* topLeftY = outY.data();
+        float* topRightX = topLeftX + count;
+        float* topRightY = topLeftY + count;
+        float* bottomRightX = topRightX + count;
+        float* bottomRightY = topRightY + count;
+        float* bottomLeftX = bottomRightX + count;
+        float* bottomLeftY = bottomRightY + count;
+
+        SIMD::FloatWide m11 = SIMD::SplatWide(matrix.M11), m12 = SIMD::SplatWide(matrix.M12), m14 = SIMD::SplatWide(matrix.M14);
+        SIMD::FloatWide m21 = SIMD::SplatWide(matrix.M21), m22 = SIMD::SplatWide(matrix.M22), m24 = SIMD::SplatWide(matrix.M24);
+
+        std::size_t i = 0;
+
+        for (; i + SIMD::WIDE_LANES <= count; i += SIMD::WIDE_LANES)
+        {
+            SIMD::FloatWide vx = SIMD::LoadWide(x.data() + i);
+            SIMD::FloatWide vy = SIMD::LoadWide(y.data() + i);
+            SIMD::FloatWide vw = SIMD::LoadWide(width.data() + i);
+            SIMD::FloatWide vh = SIMD::LoadWide(height.data() + i);
+
+            SIMD::FloatWide originX = SIMD::MultiplyAddWide(m11, vx, SIMD::MultiplyAddWide(m12, vy, m14));
+            SIMD::FloatWide originY = SIMD::MultiplyAddWide(m21, vx, SIMD::MultiplyAddWide(m22, vy, m24));
+
+            SIMD::FloatWide rightX = SIMD::MultiplyAddWide(m11, vw, originX);
+            SIMD::FloatWide rightY = SIMD::MultiplyAddWide(m21, vw, originY);
+
+            SIMD::StoreWide(topLeftX + i, originX);
+            SIMD::StoreWide(topLeftY + i, originY);
+            SIMD::StoreWide(topRightX + i, rightX);
+            SIMD::StoreWide(topRightY + i, rightY);
+            SIMD::StoreWide(bottomRightX + i, SIMD::MultiplyAddWide(m12, vh, rightX));
+            SIMD::StoreWide(bottomRightY + i, SIMD::MultiplyAddWide(m22, vh, rightY));
+            SIMD::StoreWide(bottomLeftX + i, SIMD::MultiplyAddWide(m12, vh, originX));
+            SIMD::StoreWide(bottomLeftY + i, SIMD::MultiplyAddWide(m22, vh, originY));
+        }
+
+        for (; i < count; ++i)
+        {
+            float originX = matrix.M11 * x[i] + matrix.M12 * y[i] + matrix.M14;
+            float originY = matrix.M21 * x[i] + matrix.M22 * y[i] + matrix.M24;
+            float rightX = originX + matrix.M11 * width[i];
+            float rightY = originY + matrix.M21 * width[i];
+
+            topLeftX[i] = originX;
+            topLeftY[i] = originY;
+            topRightX[i] = rightX;
+            topRightY[i] = rightY;
+            bottomRightX[i] = rightX + matrix.M12 * height[i];
+            bottomRightY[i] = rightY + matrix.M22 * height[i];
+            bottomLeftX[i] = originX + matrix.M12 * height[i];
+            bottomLeftY[i] = originY + matrix.M22 * height[i];
+        }
+    }
+
+    // Layout Conversion
+
+    void TransformBatch::ToSoA(std::span<const Vector2> vectors, std::span<float> x, std::span<float> y) noexcept
+    {
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+        {
+            x[i] = vectors[i].X;
+            y[i] = vectors[i].Y;
+        }
+    }
+
+    void TransformBatch::ToSoA(std::span<const Vector3> vectors, std::span<float> x, std::span<float> y, std::span<float> z) noexcept
+    {
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+        {
+            x[i] = vectors[i].X;
+            y[i] = vectors[i].Y;
+            z[i] = vectors[i].Z;
+        }
+    }
+
+    void TransformBatch::ToAoS(std::span<const float> x, std::span<const float> y, std::span<Vector2> vectors) noexcept
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            vectors[i].X = x[i];
+            vectors[i].Y = y[i];
+        }
+    }
+
+    void TransformBatch::ToAoS(std::span<const float> x, std::span<const float> y, std::span<const float> z, std::span<Vector3> vectors) noexcept
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            vectors[i].X = x[i];
+            vectors[i].Y = y[i];
+            vectors[i].Z = z[i];
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "WackyEngine/Graphics/CookedMesh.h"
+#include "WackyEngine/Graphics/MeshLoader.h"
+
+#include "Test.h"
+
+using namespace WackyEngine;
+
+static std::vector<std::byte> ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::ate | std::ios::binary);
+    std::vector<std::byte> contents(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(contents.data()), contents.size());
+
+    return contents;
+}
+
+static bool ValidateThrows(const std::vector<std::byte>& file, std::size_t size)
+{
+    try
+    {
+        CookedMesh::Validate(file.data(), size);
+    }
+    catch (const std::runtime_error&)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+// A strip of quads, so the vertex count picks the index size.
+static MeshData CreateStrip(std::uint32_t quads)
+{
+    MeshData mesh;
+
+    for (std::uint32_t i = 0; i <= quads; ++i)
+    {
+        mesh.Vertices.emplace_back(Vector3(static_cast<float>(i), 0.0f, -1.0f), Vector3(1.0f, 0.5f, 0.25f), Vector2(0.0f, 0.0f), i);
+        mesh.Vertices.emplace_back(Vector3(static_cast<float>(i), 2.0f, 3.0f), Vector3(0.25f, 0.5f, 1.0f), Vector2(1.0f, 1.0f), i);
+    }
+
+    for (std::uint32_t i = 0; i < quads; ++i)
+    {
+        std::uint32_t corner = i * 2;
+        mesh.Indices.insert(mesh.Indices.end(), { corner, corner + 2, corner + 1, corner + 1, corner + 2, corner + 3 });
+    }
+
+    return mesh;
+}
+
+template<typename T>
+static bool IndicesMatch(const std::vector<std::byte>& file, const CookedMeshHeader& header, const MeshData& mesh)
+{
+    for (std::size_t i = 0; i < mesh.Indices.size(); ++i)
+    {
+        T index;
+        std::memcpy(&index, file.data() + header.IndexOffset + i * sizeof(T), sizeof(T));
+
+        if (index != mesh.Indices[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void TestRoundTrip(std::uint32_t quads, std::uint32_t indexSize)
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "CookedMeshTest.wmesh";
+    MeshData mesh = CreateStrip(quads);
+
+    CookedMesh::Write(path.string(), mesh);
+    std::vector<std::byte> file = ReadFile(path);
+    std::filesystem::remove(path);
+
+    CookedMeshHeader header = CookedMesh::Validate(file.data(), file.size());
+
+    Test::Check(header.VertexCount == mesh.Vertices.size() && header.IndexCount == mesh.Indices.size(), "Round trip keeps the vertex and index counts");
+    Test::Check(header.IndexSize == indexSize, "Index size follows the vertex count");
+    Test::Check(header.VertexOffset % CookedMesh::BLOB_ALIGNMENT == 0 && header.IndexOffset % CookedMesh::BLOB_ALIGNMENT == 0, "Blobs are aligned");
+
+    Test::Check(header.BoundsMin[0] == 0.0f && header.BoundsMin[1] == 0.0f && header.BoundsMin[2] == -1.0f &&
+                header.BoundsMax[0] == static_cast<float>(quads) && header.BoundsMax[1] == 2.0f && header.BoundsMax[2] == 3.0f, "Bounds cover every position");
+
+    Test::Check(std::memcmp(file.data() + header.VertexOffset, mesh.Vertices.data(), mesh.Vertices.size() * sizeof(Vertex)) == 0, "Vertex blob matches the source vertices");
+    Test::Check(indexSize == 2 ? IndicesMatch<std::uint16_t>(file, header, mesh) : IndicesMatch<std::uint32_t>(file, header, mesh), "Index blob matches the source indices");
+}
+
+static void TestTruncated()
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "CookedMeshTest.wmesh";
+    CookedMesh::Write(path.string(), CreateStrip(4));
+    std::vector<std::byte> file = ReadFile(path);
+    std::filesystem::remove(path);
+
+    Test::Check(ValidateThrows(file, 0), "Empty file is rejected");
+    Test::Check(ValidateThrows(file, sizeof(CookedMeshHeader) - 1), "File shorter than the header is rejected");
+    Test::Check(ValidateThrows(file, file.size() - 1), "File missing the end of the index blob is rejected");
+    Test::Check(!ValidateThrows(file, file.size()), "Whole file is accepted");
+}
+
+static void TestCorrupt()
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "CookedMeshTest.wmesh";
+    MeshData mesh = CreateStrip(4);
+    CookedMesh::Write(path.string(), mesh);
+    const std::vector<std::byte> original = ReadFile(path);
+    std::filesystem::remove(path);
+
+    CookedMeshHeader valid;
+    std::memcpy(&valid, original.data(), sizeof(valid));
+
+    // Each case changes one thing about an otherwise valid file.
+    auto corrupted = [&](const std::function<void(CookedMeshHeader&, std::vector<std::byte>&)>& change)
+    {
+        std::vector<std::byte> file = original;
+        CookedMeshHeader header = valid;
+        change(header, file);
+        std::memcpy(file.data(), &header, sizeof(header));
+
+        return ValidateThrows(file, file.size());
+    };
+
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.Magic = 0; }), "Wrong magic is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { ++header.Version; }), "Unknown version is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.VertexStride += 4; }), "Different vertex stride is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.VertexAttributes ^= 1; }), "Different vertex layout is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.IndexSize = 3; }), "Invalid index size is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.VertexCount = 0; }), "Empty vertex blob is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.IndexCount = 0; }), "Empty index blob is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.VertexCount = 0xFFFFFFFFu; }), "Vertex blob running into the index blob is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.IndexCount = 0xFFFFFFFFu; }), "Index blob running past the file is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.VertexOffset = 0; }), "Vertex blob overlapping the header is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.VertexOffset = header.IndexOffset + CookedMesh::BLOB_ALIGNMENT; }), "Vertex blob after the index blob is rejected");
+    Test::Check(corrupted([](CookedMeshHeader& header, std::vector<std::byte>&) { header.IndexOffset = 0xFFFFFFFFFFFFFF00ull; }), "Index offset that would wrap is rejected");
+
+    Test::Check(corrupted([&](CookedMeshHeader& header, std::vector<std::byte>& file)
+    {
+        std::uint16_t index = static_cast<std::uint16_t>(header.VertexCount);
+        std::memcpy(file.data() + header.IndexOffset + 2 * sizeof(index), &index, sizeof(index));
+    }), "Index past the vertices is rejected");
+}
+
+int main()
+{
+    TestRoundTrip(4, 2);
+    TestRoundTrip(40000, 4);
+    TestTruncated();
+    TestCorrupt();
+
+    return Test::Finish("CookedMeshTest");
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "WackyEngine/Math/DynamicAABBTree.h"
+
+#include "Test.h"
+
+using namespace WackyEngine;
+
+using Pair = std::pair<std::int32_t, std::int32_t>;
+
+static bool Overlaps(const Rectangle& first, const Rectangle& second)
+{
+    return first.X < second.X + second.Width && second.X < first.X + first.Width &&
+           first.Y < second.Y + second.Height && second.Y < first.Y + first.Height;
+}
+
+static Rectangle RandomRect(std::mt19937& random)
+{
+    std::uniform_int_distribution<int> position(0, 2000);
+    std::uniform_int_distribution<int> size(1, 40);
+
+    return Rectangle(position(random), position(random), size(random), size(random));
+}
+
+// Inserts, moves and removes a few thousand rectangles, then compares every query against a brute force pass over
+// the padded bounds the tree reports.
+static void TestAgainstBruteForce()
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> step(-30, 30);
+
+    DynamicAABBTree tree;
+    std::vector<std::int32_t> proxies;
+
+    for (std::uint64_t i = 0; i < 3000; ++i)
+    {
+        proxies.push_back(tree.Insert(RandomRect(random), i));
+    }
+
+    for (std::size_t i = 0; i < proxies.size(); i += 2)
+    {
+        Rectangle bounds = tree.GetFatBounds(proxies[i]);
+        Vector2 displacement(static_cast<float>(step(random)), static_cast<float>(step(random)));
+        bounds.X += static_cast<int>(displacement.X);
+        bounds.Y += static_cast<int>(displacement.Y);
+        tree.Move(proxies[i], bounds, displacement);
+    }
+
+    for (std::size_t i = 0; i < proxies.size(); i += 7)
+    {
+        tree.Remove(proxies[i]);
+        proxies[i] = DynamicAABBTree::NULL_NODE;
+    }
+
+    proxies.erase(std::remove(proxies.begin(), proxies.end(), DynamicAABBTree::NULL_NODE), proxies.end());
+
+    Test::Check(tree.GetProxyCount() == proxies.size(), "Proxy count follows inserts and removes");
+
+    // Pairs
+    std::vector<Pair> treePairs;
+    bool ordered = true;
+
+    tree.QueryPairs([&](std::int32_t first, std::int32_t second)
+    {
+        ordered &= first < second;
+        treePairs.emplace_back(first, second);
+        return true;
+    });
+
+    std::vector<Pair> brutePairs;
+
+    for (std::size_t i = 0; i < proxies.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < proxies.size(); ++j)
+        {
+            if (Overlaps(tree.GetFatBounds(proxies[i]), tree.GetFatBounds(proxies[j])))
+            {
+                brutePairs.emplace_back(std::min(proxies[i], proxies[j]), std::max(proxies[i], proxies[j]));
+            }
+        }
+    }
+
+    std::sort(treePairs.begin(), treePairs.end());
+    std::sort(brutePairs.begin(), brutePairs.end());
+
+    Test::Check(ordered, "QueryPairs reports the lower proxy first");
+    Test::Check(std::adjacent_find(treePairs.begin(), treePairs.end()) == treePairs.end(), "QueryPairs reports each pair once");
+    Test::Check(!brutePairs.empty() && treePairs == brutePairs, "QueryPairs matches a brute force pass");
+
+    // Region queries
+    bool regionsMatch = true;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        Rectangle region = RandomRect(random);
+        region.Width *= 5;
+        region.Height *= 5;
+
+        std::vector<std::int32_t> found;
+        tree.Query(region, [&found](std::int32_t proxy) { found.push_back(proxy); return true; });
+
+        std::vector<std::int32_t> expected;
+
+        for (std::int32_t proxy : proxies)
+        {
+            if (Overlaps(tree.GetFatBounds(proxy), region))
+            {
+                expected.push_back(proxy);
+            }
+        }
+
+        std::sort(found.begin(), found.end());
+        std::sort(expected.begin(), expected.end());
+        regionsMatch &= found == expected;
+    }
+
+    Test::Check(regionsMatch, "Region queries match a brute force pass");
+}
+
+int main()
+{
+    TestAgainstBruteForce();
+
+    return Test::Finish("DynamicAABBTreeTest");
+}
\ No newline at end of file
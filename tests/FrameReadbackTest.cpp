@@ -0,0 +1,91 @@
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Graphics/FrameCapture.h"
+#include "WackyEngine/Graphics/OffscreenTarget.h"
+#include "WackyEngine/Graphics/RenderSystem.h"
+
+#include "Headless.h"
+#include "PNG.h"
+#include "Test.h"
+
+using namespace WackyEngine;
+
+static constexpr std::uint32_t WIDTH = 48;
+static constexpr std::uint32_t HEIGHT = 32;
+
+static std::vector<std::uint8_t> ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+int main()
+{
+    if (!Test::InitialiseHeadless("FrameReadbackTest", WIDTH, HEIGHT))
+    {
+        return Test::SKIPPED;
+    }
+
+    RenderSystem* renderSystem = new RenderSystem();
+    FrameCapture* capture = new FrameCapture(renderSystem);
+
+    // The target is sRGB, so the clear colour is linear and 0.5 is stored as 188.
+    renderSystem->SetClearColour(Vector3(1.0f, 0.5f, 0.0f));
+
+    std::filesystem::path rawPath = std::filesystem::temp_directory_path() / "FrameReadbackTest.raw";
+    std::filesystem::path pngPath = std::filesystem::temp_directory_path() / "FrameReadbackTest.png";
+
+    // The capture is recorded into the frame, Readback then copies the same frame again once it has finished.
+    VkCommandBuffer cmdBuffer = renderSystem->BeginFrame();
+    renderSystem->BeginRenderPass(cmdBuffer);
+    renderSystem->EndRenderPass(cmdBuffer);
+
+    bool capturedRaw = capture->Capture(cmdBuffer, rawPath.string(), CaptureFormat::Raw);
+    bool capturedPNG = capture->Capture(cmdBuffer, pngPath.string(), CaptureFormat::PNG);
+
+    renderSystem->EndFrame();
+
+    std::vector<std::uint8_t> pixels;
+    renderSystem->GetOffscreenTarget()->Readback(pixels);
+
+    Test::Check(pixels.size() == WIDTH * HEIGHT * 4, "Readback returns tightly packed RGBA8 rows");
+
+    bool cleared = pixels.size() == WIDTH * HEIGHT * 4;
+
+    for (std::size_t i = 0; cleared && i < pixels.size(); i += 4)
+    {
+        cleared = pixels[i] == 255 && std::abs(pixels[i + 1] - 188) <= 1 && pixels[i + 2] == 0 && pixels[i + 3] == 255;
+    }
+
+    Test::Check(cleared, "Every read back pixel is the sRGB encoded clear colour");
+
+    Test::Check(capturedRaw && capturedPNG, "Both captures were recorded");
+
+    capture->Flush();
+
+    Test::Check(capture->GetCompletedCount() == 2 && capture->GetFailedCount() == 0, "Both captures were encoded");
+    Test::Check(ReadFile(rawPath) == pixels, "Raw capture matches the read back frame");
+
+    Test::DecodedPNG decoded;
+    bool decodedPNG = Test::DecodePNG(ReadFile(pngPath), decoded);
+
+    Test::Check(decodedPNG && decoded.Width == WIDTH && decoded.Height == HEIGHT, "PNG capture decodes at the frame's size");
+    Test::Check(decodedPNG && decoded.Pixels == pixels, "PNG capture matches the read back frame");
+
+    delete capture;
+
+    vkDeviceWaitIdle(Context::GetDevice()->GetLogicalDevice());
+
+    delete renderSystem;
+
+    std::filesystem::remove(rawPath);
+    std::filesystem::remove(pngPath);
+
+    return Test::Finish("FrameReadbackTest");
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef WACKYENGINE_TESTS_HEADLESS_H_
+#define WACKYENGINE_TESTS_HEADLESS_H_
+
+#include <cstdio>
+#include <cstdint>
+
+#include "WackyEngine/Core/Context.h"
+
+namespace WackyEngine::Test
+{
+    // True when the loader finds at least one physical device. Probed with a bare instance so a broken engine
+    // path still fails the test instead of being reported as a skip.
+    inline bool HasVulkanDevice()
+    {
+        VkApplicationInfo appInfo { };
+        appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        appInfo.apiVersion = VK_API_VERSION_1_0;
+
+        VkInstanceCreateInfo createInfo { };
+        createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        createInfo.pApplicationInfo = &appInfo;
+
+        VkInstance instance;
+
+        if (vkCreateInstance(&createInfo, nullptr, &instance) != VK_SUCCESS)
+        {
+            return false;
+        }
+
+        std::uint32_t deviceCount = 0;
+        VkResult result = vkEnumeratePhysicalDevices(instance, &deviceCount, nullptr);
+        vkDestroyInstance(instance, nullptr);
+
+        return result == VK_SUCCESS && deviceCount > 0;
+    }
+
+    // Headless context for GPU tests, lavapipe is enough. False when there is no Vulkan device, the test should
+    // then return SKIPPED. Any other initialisation failure throws. Pipelines load compiled shaders from shaders/
+    // in the working directory.
+    inline bool InitialiseHeadless(const char* name, std::uint32_t width, std::uint32_t height, bool depthBuffer = true)
+    {
+        if (!HasVulkanDevice())
+        {
+            std::fprintf(stderr, "%s skipped, no Vulkan device.\n", name);
+            return false;
+        }
+
+        AppInformation appInfo { };
+        appInfo.AppName = name;
+        appInfo.AppVersion = VK_MAKE_VERSION(1, 0, 0);
+        appInfo.EngineName = "WackyEngine";
+        appInfo.EngineVersion = VK_MAKE_VERSION(1, 0, 0);
+
+        WindowInformation windowInfo { };
+        windowInfo.Width = width;
+        windowInfo.Height = height;
+        windowInfo.Title = name;
+
+        GraphicsInformation graphicsInfo { };
+        graphicsInfo.Headless = true;
+        graphicsInfo.DepthBuffer = depthBuffer;
+
+        Context::Initialise(appInfo, windowInfo, graphicsInfo);
+
+        return true;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "WackyEngine/Graphics/ImageWriter.h"
+
+#include "PNG.h"
+#include "Test.h"
+
+using namespace WackyEngine;
+
+// Encodes, decodes with the reference decoder and compares every byte.
+static bool RoundTrip(std::uint32_t width, std::uint32_t height, const std::vector<std::uint8_t>& pixels, Test::DecodedPNG& decoded)
+{
+    std::vector<std::uint8_t> png = ImageWriter::EncodePNG(width, height, pixels.data());
+
+    return Test::DecodePNG(png, decoded) && decoded.Width == width && decoded.Height == height && decoded.Pixels == pixels;
+}
+
+static void TestFixedBytes()
+{
+    // A 1x1 image's signature, IHDR and IEND are fully determined by the format, only IDAT depends on the encoder.
+    const std::uint8_t pixel[4] = { 255, 0, 0, 255 };
+    std::vector<std::uint8_t> png = ImageWriter::EncodePNG(1, 1, pixel);
+
+    const std::vector<std::uint8_t> start =
+    {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n',
+        0, 0, 0, 13, 'I', 'H', 'D', 'R', 0, 0, 0, 1, 0, 0, 0, 1, 8, 6, 0, 0, 0, 0x1F, 0x15, 0xC4, 0x89
+    };
+
+    const std::vector<std::uint8_t> end = { 0, 0, 0, 0, 'I', 'E', 'N', 'D', 0xAE, 0x42, 0x60, 0x82 };
+
+    Test::Check(png.size() > start.size() + end.size(), "1x1 PNG has room for its chunks");
+
+    if (png.size() > start.size() + end.size())
+    {
+        Test::Check(std::equal(start.begin(), start.end(), png.begin()), "Signature and IHDR match the known bytes");
+        Test::Check(std::equal(end.begin(), end.end(), png.end() - end.size()), "IEND matches the known bytes");
+    }
+
+    Test::DecodedPNG decoded;
+    Test::Check(RoundTrip(1, 1, std::vector<std::uint8_t>(pixel, pixel + 4), decoded), "1x1 image round trips");
+
+    // The decoder has to notice damage, or the round trips above prove nothing.
+    png[start.size() + 10] ^= 0x01;
+    Test::Check(!Test::DecodePNG(png, decoded), "Corrupted IDAT fails its CRC");
+}
+
+static void TestImages()
+{
+    std::uint32_t filterCounts[5] = { };
+    std::uint32_t storedImages = 0;
+    std::uint32_t fixedImages = 0;
+
+    auto check = [&](std::uint32_t width, std::uint32_t height, const std::vector<std::uint8_t>& pixels, const char* description)
+    {
+        Test::DecodedPNG decoded;
+        Test::Check(RoundTrip(width, height, pixels, decoded), description);
+
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            filterCounts[i] += decoded.FilterCounts[i];
+        }
+
+        storedImages += decoded.StoredBlocks > 0;
+        fixedImages += decoded.FixedBlocks > 0;
+
+        return decoded;
+    };
+
+    // Solid colour, long matches up to the 258 byte maximum.
+    check(300, 40, std::vector<std::uint8_t>(300 * 40 * 4, 200), "Solid image round trips");
+
+    // Horizontal and vertical gradients favour the sub and up filters, a diagonal one average and Paeth.
+    std::vector<std::uint8_t> gradient(256 * 64 * 4);
+    std::vector<std::uint8_t> diagonal(256 * 64 * 4);
+
+    for (std::uint32_t y = 0; y < 64; ++y)
+    {
+        for (std::uint32_t x = 0; x < 256; ++x)
+        {
+            std::uint8_t* pixel = &gradient[(y * 256 + x) * 4];
+            pixel[0] = static_cast<std::uint8_t>(x);
+            pixel[1] = static_cast<std::uint8_t>(y * 4);
+            pixel[2] = static_cast<std::uint8_t>(x ^ y);
+            pixel[3] = 255;
+
+            std::uint8_t* other = &diagonal[(y * 256 + x) * 4];
+            other[0] = static_cast<std::uint8_t>((x * 3 + y * 5) / 2);
+            other[1] = static_cast<std::uint8_t>(x * y / 64);
+            other[2] = static_cast<std::uint8_t>(x + y * y);
+            other[3] = static_cast<std::uint8_t>(255 - x);
+        }
+    }
+
+    check(256, 64, gradient, "Gradient image round trips");
+    check(256, 64, diagonal, "Diagonal image round trips");
+
+    // Noise can't be compressed, the encoder should fall back to stored blocks, more than one past 64K.
+    std::mt19937 random(3);
+    std::vector<std::uint8_t> noise(200 * 100 * 4);
+
+    for (std::uint8_t& byte : noise)
+    {
+        byte = static_cast<std::uint8_t>(random());
+    }
+
+    Test::DecodedPNG decodedNoise = check(200, 100, noise, "Noise image round trips");
+    Test::Check(decodedNoise.StoredBlocks > 1, "Incompressible data is split over stored blocks");
+
+    // Repeating noise with a period under the window, matches reach back thousands of bytes.
+    std::vector<std::uint8_t> repeating(128 * 64 * 4);
+
+    for (std::size_t i = 0; i < repeating.size(); ++i)
+    {
+        repeating[i] = noise[i % (128 * 4 * 8)];
+    }
+
+    Test::DecodedPNG decodedRepeating = check(128, 64, repeating, "Repeating image round trips");
+    Test::Check(decodedRepeating.FixedBlocks == 1 && decodedRepeating.StoredBlocks == 0, "Compressible data uses one fixed Huffman block");
+
+    check(0, 0, { }, "Empty image round trips");
+
+    Test::Check(storedImages > 0 && fixedImages > 0, "Both stored and fixed Huffman blocks were produced");
+
+    bool everyFilter = true;
+
+    for (std::uint32_t count : filterCounts)
+    {
+        everyFilter = everyFilter && count > 0;
+    }
+
+    Test::Check(everyFilter, "Every PNG filter type was chosen for some row");
+}
+
+int main()
+{
+    TestFixedBytes();
+    TestImages();
+
+    return Test::Finish("ImageWriterTest");
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "WackyEngine/Core/JobSystem.h"
+
+#include "Test.h"
+
+using namespace WackyEngine;
+
+// More jobs than a thread's ring and queue hold, every one of them has to run exactly once.
+static void TestOverflow(std::uint32_t workerCount)
+{
+    constexpr std::uint32_t JOB_COUNT = WorkStealingQueue::CAPACITY * 2 + 1808;
+
+    JobSystem jobSystem(workerCount);
+    std::unique_ptr<std::atomic<std::uint32_t>[]> runs(new std::atomic<std::uint32_t>[JOB_COUNT]());
+    std::atomic<std::uint32_t>* counts = runs.get();
+
+    JobCounter counter;
+
+    for (std::uint32_t i = 0; i < JOB_COUNT; ++i)
+    {
+        jobSystem.Run(counter, [counts, i]() { counts[i].fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    jobSystem.WaitForCounter(counter);
+
+    std::uint32_t wrong = 0;
+
+    for (std::uint32_t i = 0; i < JOB_COUNT; ++i)
+    {
+        wrong += counts[i].load() != 1;
+    }
+
+    Test::Check(wrong == 0, "Run past the ring capacity runs every job once");
+
+    // Same again through ParallelFor with single element batches.
+    for (std::uint32_t i = 0; i < JOB_COUNT; ++i)
+    {
+        counts[i].store(0);
+    }
+
+    jobSystem.ParallelFor(counter, JOB_COUNT, 1, [counts](std::uint32_t begin, std::uint32_t end)
+    {
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            counts[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    jobSystem.WaitForCounter(counter);
+
+    wrong = 0;
+
+    for (std::uint32_t i = 0; i < JOB_COUNT; ++i)
+    {
+        wrong += counts[i].load() != 1;
+    }
+
+    Test::Check(wrong == 0, "ParallelFor past the ring capacity runs every batch once");
+}
+
+static void TestException(std::uint32_t workerCount)
+{
+    JobSystem jobSystem(workerCount);
+    JobCounter counter;
+    std::atomic<std::uint32_t> completed = 0;
+
+    for (std::uint32_t i = 0; i < 64; ++i)
+    {
+        jobSystem.Run(counter, [&completed, i]()
+        {
+            if (i == 17)
+            {
+                throw std::runtime_error("job failed");
+            }
+
+            completed.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+
+    bool caught = false;
+
+    try
+    {
+        jobSystem.WaitForCounter(counter);
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    Test::Check(caught, "WaitForCounter rethrows a job's exception");
+    Test::Check(counter.IsDone() && completed.load() == 63, "A throwing job still finishes the counter");
+
+    // The counter is usable again afterwards.
+    jobSystem.Run(counter, [&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+    jobSystem.WaitForCounter(counter);
+
+    Test::Check(completed.load() == 64, "Counter is reusable after an exception");
+}
+
+// Threads the job system did not start submit and wait alongside thread 0 and the workers.
+static void TestExternalThreads(std::uint32_t workerCount)
+{
+    constexpr std::uint32_t THREAD_COUNT = 4;
+    constexpr std::uint32_t JOB_COUNT = JobSystem::MAX_JOBS_PER_THREAD + 1000;
+
+    JobSystem jobSystem(workerCount);
+    std::atomic<std::uint32_t> runs = 0;
+    std::atomic<std::uint32_t> externalIndices = 0;
+
+    auto submit = [&jobSystem, &runs]()
+    {
+        JobCounter counter;
+
+        for (std::uint32_t i = 0; i < JOB_COUNT; ++i)
+        {
+            jobSystem.Run(counter, [&runs]() { runs.fetch_add(1, std::memory_order_relaxed); });
+        }
+
+        jobSystem.WaitForCounter(counter);
+    };
+
+    std::vector<std::thread> threads;
+
+    for (std::uint32_t i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads.emplace_back([&]()
+        {
+            externalIndices.fetch_add(jobSystem.GetThreadIndex() == JobSystem::EXTERNAL_THREAD, std::memory_order_relaxed);
+            submit();
+        });
+    }
+
+    submit();
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    Test::Check(externalIndices.load() == THREAD_COUNT, "Threads the job system did not start are external");
+    Test::Check(runs.load() == JOB_COUNT * (THREAD_COUNT + 1), "Jobs from external threads all run once");
+}
+
+// A worker of one job system is an external thread to another, and a nested system hands thread 0 back.
+static void TestSeparateSystems()
+{
+    JobSystem outer(3);
+    std::uint32_t innerRuns = 0;
+
+    {
+        JobSystem inner(2);
+
+        Test::Check(inner.GetThreadIndex() == 0 && outer.GetThreadIndex() == JobSystem::EXTERNAL_THREAD, "The constructing thread is thread 0 of the newest system");
+
+        std::atomic<std::uint32_t> runs = 0;
+        std::atomic<std::uint32_t> wrongIndices = 0;
+        JobCounter outerCounter;
+
+        outer.ParallelFor(outerCounter, 64, 1, [&](std::uint32_t, std::uint32_t)
+        {
+            if (outer.GetThreadIndex() >= outer.GetThreadCount() && outer.GetThreadIndex() != JobSystem::EXTERNAL_THREAD)
+            {
+                wrongIndices.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            JobCounter innerCounter;
+
+            for (std::uint32_t i = 0; i < 16; ++i)
+            {
+                inner.Run(innerCounter, [&runs]() { runs.fetch_add(1, std::memory_order_relaxed); });
+            }
+
+            inner.WaitForCounter(innerCounter);
+        });
+
+        outer.WaitForCounter(outerCounter);
+
+        Test::Check(wrongIndices.load() == 0, "Thread indices stay within their own system");
+        innerRuns = runs.load();
+    }
+
+    Test::Check(innerRuns == 64 * 16, "Jobs submitted to another system from workers all run");
+    Test::Check(outer.GetThreadIndex() == 0, "Destroying a nested system hands thread 0 back");
+}
+
+int main()
+{
+    TestOverflow(0);
+    TestOverflow(3);
+    TestException(0);
+    TestException(3);
+    TestExternalThreads(0);
+    TestExternalThreads(3);
+    TestSeparateSystems();
+
+    return Test::Finish("JobSystemTest");
+}
\ No newline at end of file
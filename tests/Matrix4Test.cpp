@@ -0,0 +1,98 @@
+#include <cmath>
+#include <random>
+
+#include "WackyEngine/Math/Matrix4.h"
+
+#include "Test.h"
+
+using namespace WackyEngine;
+
+static bool NearlyEqual(const Matrix4& first, const Matrix4& second, float tolerance)
+{
+    for (int i = 0; i < 16; ++i)
+    {
+        if (std::fabs(first.GetData()[i] - second.GetData()[i]) > tolerance)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Matrix4::CreateScale is still a stub returning the identity.
+static Matrix4 Scale(float x, float y, float z)
+{
+    return Matrix4(x,    0.0f, 0.0f, 0.0f,
+                   0.0f, y,    0.0f, 0.0f,
+                   0.0f, 0.0f, z,    0.0f,
+                   0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+// Rotation, non-uniform scale and translation, the matrices GetAffineInverse is meant for.
+static Matrix4 RandomAffine(std::mt19937& random)
+{
+    std::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> offset(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> scale(0.25f, 4.0f);
+
+    return Matrix4::CreateTranslation(offset(random), offset(random), offset(random)) *
+           Matrix4::CreateRotationZ(angle(random)) * Matrix4::CreateRotationY(angle(random)) * Matrix4::CreateRotationX(angle(random)) *
+           Scale(scale(random), scale(random), scale(random));
+}
+
+static void TestInverses()
+{
+    std::mt19937 random(42);
+    int generalFailures = 0;
+    int affineFailures = 0;
+    int agreementFailures = 0;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        Matrix4 matrix = RandomAffine(random);
+        Matrix4 general = matrix.GetInverse();
+        Matrix4 affine = matrix.GetAffineInverse();
+
+        generalFailures += !NearlyEqual(matrix * general, Matrix4::Identity, 1e-4f) || !NearlyEqual(general * matrix, Matrix4::Identity, 1e-4f);
+        affineFailures += !NearlyEqual(matrix * affine, Matrix4::Identity, 1e-4f) || !NearlyEqual(affine * matrix, Matrix4::Identity, 1e-4f);
+        agreementFailures += !NearlyEqual(general, affine, 1e-4f);
+    }
+
+    Test::Check(generalFailures == 0, "GetInverse of affine matrices gives the identity both ways round");
+    Test::Check(affineFailures == 0, "GetAffineInverse gives the identity both ways round");
+    Test::Check(agreementFailures == 0, "GetInverse and GetAffineInverse agree on affine matrices");
+
+    // Projections have a non-trivial bottom row, only the general inverse handles them.
+    Matrix4 projection = Matrix4::CreatePerspectiveFOV(1.0f, 16.0f / 9.0f, 0.1f, 100.0f) * RandomAffine(random);
+    Test::Check(NearlyEqual(projection * projection.GetInverse(), Matrix4::Identity, 1e-3f), "GetInverse of a perspective matrix gives the identity");
+
+    Matrix4 known(2.0f, 0.0f, 0.0f, 3.0f,
+                  0.0f, 4.0f, 0.0f, -8.0f,
+                  0.0f, 0.0f, 0.5f, 1.0f,
+                  0.0f, 0.0f, 0.0f, 1.0f);
+
+    Matrix4 expected(0.5f, 0.0f,  0.0f, -1.5f,
+                     0.0f, 0.25f, 0.0f,  2.0f,
+                     0.0f, 0.0f,  2.0f, -2.0f,
+                     0.0f, 0.0f,  0.0f,  1.0f);
+
+    Test::Check(NearlyEqual(known.GetInverse(), expected, 1e-6f), "GetInverse matches a hand computed inverse");
+    Test::Check(NearlyEqual(known.GetAffineInverse(), expected, 1e-6f), "GetAffineInverse matches a hand computed inverse");
+
+    bool generalThrew = false;
+    bool affineThrew = false;
+
+    try { Matrix4::Zero.GetInverse(); } catch (...) { generalThrew = true; }
+    try { Scale(1.0f, 0.0f, 1.0f).GetAffineInverse(); } catch (...) { affineThrew = true; }
+
+    Test::Check(generalThrew, "GetInverse rejects a singular matrix");
+    Test::Check(affineThrew, "GetAffineInverse rejects a singular matrix");
+}
+
+int main()
+{
+    TestInverses();
+
+    return Test::Finish("Matrix4Test");
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "WackyEngine/Graphics/MeshLoader.h"
+
+#include "Test.h"
+
+using namespace WackyEngine;
+
+static std::filesystem::path WriteFile(const char* name, const std::string& contents)
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), contents.size());
+
+    return path;
+}
+
+static bool LoadThrows(const std::filesystem::path& path)
+{
+    try
+    {
+        MeshLoader::LoadData(path.string());
+    }
+    catch (const std::runtime_error&)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+static void AppendU32(std::string& output, std::uint32_t value)
+{
+    char bytes[4];
+    std::memcpy(bytes, &value, 4);
+    output.append(bytes, 4);
+}
+
+// GLB container around a JSON chunk and a binary chunk, both padded to four bytes as the format requires.
+static std::string CreateGLB(std::string json, std::string binary)
+{
+    json.resize((json.size() + 3) & ~std::size_t(3), ' ');
+    binary.resize((binary.size() + 3) & ~std::size_t(3), '\0');
+
+    std::string output;
+    AppendU32(output, 0x46546C67);
+    AppendU32(output, 2);
+    AppendU32(output, static_cast<std::uint32_t>(12 + 8 + json.size() + 8 + binary.size()));
+    AppendU32(output, static_cast<std::uint32_t>(json.size()));
+    AppendU32(output, 0x4E4F534A);
+    output += json;
+    AppendU32(output, static_cast<std::uint32_t>(binary.size()));
+    AppendU32(output, 0x004E4942);
+    output += binary;
+
+    return output;
+}
+
+static void TestOBJ()
+{
+    // A quad with colours and texture coordinates, then a second object reusing its corners through negative indices.
+    std::filesystem::path path = WriteFile("MeshLoaderTest.obj",
+        "# comment\n"
+        "o first\n"
+        "v 0 0 0 1 0 0\n"
+        "v 1 0 0 0 1 0\n"
+        "v 1 1 0 0 0 1\n"
+        "v 0 1 0 1 1 1\n"
+        "vt 0 0\n"
+        "vt 1 0\n"
+        "vt 1 1\n"
+        "vt 0 1\n"
+        "f 1/1 2/2 3/3 4/4\n"
+        "o second\n"
+        "f -4//1 -3//1 -2//1\n");
+
+    std::vector<MeshData> meshes = MeshLoader::LoadData(path.string());
+
+    Test::Check(meshes.size() == 2, "Each OBJ object becomes a mesh");
+
+    if (meshes.size() == 2)
+    {
+        Test::Check(meshes[0].Name == "first" && meshes[1].Name == "second", "OBJ object names are kept");
+        Test::Check(meshes[0].Indices.size() == 6 && meshes[0].Vertices.size() == 4, "Quad is fan triangulated and its shared corners welded");
+        Test::Check(meshes[1].Indices.size() == 3 && meshes[1].Vertices.size() == 3, "Negative indices resolve against the vertices so far");
+
+        bool coloured = false;
+
+        for (const Vertex& vertex : meshes[0].Vertices)
+        {
+            // Texture coordinates are flipped to Vulkan's top left origin.
+            coloured = coloured || (vertex.Position.X == 1.0f && vertex.Position.Y == 1.0f && vertex.Colour.Z == 1.0f && vertex.TextureCoordinates.Y == 0.0f);
+        }
+
+        Test::Check(coloured, "OBJ vertex colours and texture coordinates are read");
+    }
+
+    std::filesystem::path bad = WriteFile("MeshLoaderTestBad.obj", "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 4\n");
+    Test::Check(LoadThrows(bad), "Out of range OBJ face index is rejected");
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(bad);
+}
+
+// Four positions then six 16-bit indices, the views are filled in by each case.
+static std::string QuadBinary()
+{
+    const float positions[12] = { 0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0 };
+    const std::uint16_t indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+    std::string binary(reinterpret_cast<const char*>(positions), sizeof(positions));
+    binary.append(reinterpret_cast<const char*>(indices), sizeof(indices));
+
+    return binary;
+}
+
+static std::string QuadJSON(const char* positionAccessor, const char* indexAccessor, const char* views)
+{
+    return std::string("{\"asset\":{\"version\":\"2.0\"},\"meshes\":[{\"name\":\"quad\",\"primitives\":[{\"attributes\":{\"POSITION\":0},\"indices\":1}]}],")
+        + "\"accessors\":[" + positionAccessor + "," + indexAccessor + "],"
+        + "\"bufferViews\":" + views + ",\"buffers\":[{\"byteLength\":60}]}";
+}
+
+static void TestGLB()
+{
+    const char* position = "{\"bufferView\":0,\"componentType\":5126,\"count\":4,\"type\":\"VEC3\"}";
+    const char* index = "{\"bufferView\":1,\"componentType\":5123,\"count\":6,\"type\":\"SCALAR\"}";
+    const char* views = "[{\"buffer\":0,\"byteLength\":48},{\"buffer\":0,\"byteOffset\":48,\"byteLength\":12}]";
+
+    std::filesystem::path path = WriteFile("MeshLoaderTest.glb", CreateGLB(QuadJSON(position, index, views), QuadBinary()));
+    std::vector<MeshData> meshes = MeshLoader::LoadData(path.string());
+
+    Test::Check(meshes.size() == 1, "GLB mesh is loaded");
+
+    if (meshes.size() == 1)
+    {
+        Test::Check(meshes[0].Name == "quad", "GLB mesh name is kept");
+        Test::Check(meshes[0].Vertices.size() == 4 && meshes[0].Indices.size() == 6, "GLB positions and indices are read");
+    }
+
+    // Each of these must be rejected rather than read out of bounds or cast from an invalid double.
+    struct BadCase
+    {
+        const char* Description;
+        const char* Position;
+        const char* Index;
+        const char* Views;
+    };
+
+    const BadCase cases[] =
+    {
+        { "Huge accessor count", "{\"bufferView\":0,\"componentType\":5126,\"count\":1e30,\"type\":\"VEC3\"}", index, views },
+        { "Negative accessor count", "{\"bufferView\":0,\"componentType\":5126,\"count\":-1,\"type\":\"VEC3\"}", index, views },
+        { "Fractional accessor count", "{\"bufferView\":0,\"componentType\":5126,\"count\":2.5,\"type\":\"VEC3\"}", index, views },
+        { "Count past the view", "{\"bufferView\":0,\"componentType\":5126,\"count\":5,\"type\":\"VEC3\"}", index, views },
+        { "Accessor count that would wrap the stride product", "{\"bufferView\":0,\"componentType\":5126,\"count\":4294967295,\"type\":\"VEC3\"}", index, views },
+        { "Accessor offset past the view", "{\"bufferView\":0,\"byteOffset\":4294967295,\"componentType\":5126,\"count\":1,\"type\":\"VEC3\"}", index, views },
+        { "Position accessor without a view", "{\"componentType\":5126,\"count\":4,\"type\":\"VEC3\"}", index, views },
+        { "Index accessor without a view", position, "{\"componentType\":5123,\"count\":6,\"type\":\"SCALAR\"}", views },
+        { "Indices past their view's byte length", position, index, "[{\"buffer\":0,\"byteLength\":48},{\"buffer\":0,\"byteOffset\":48,\"byteLength\":6}]" },
+        { "Indices from another buffer", position, index, "[{\"buffer\":0,\"byteLength\":48},{\"buffer\":1,\"byteOffset\":48,\"byteLength\":12}]" },
+        { "View past the binary chunk", position, index, "[{\"buffer\":0,\"byteLength\":48},{\"buffer\":0,\"byteOffset\":48,\"byteLength\":4000}]" },
+        { "Float indices", position, "{\"bufferView\":1,\"componentType\":5126,\"count\":3,\"type\":\"SCALAR\"}", views }
+    };
+
+    for (const BadCase& bad : cases)
+    {
+        std::filesystem::path badPath = WriteFile("MeshLoaderTestBad.glb", CreateGLB(QuadJSON(bad.Position, bad.Index, bad.Views), QuadBinary()));
+        Test::Check(LoadThrows(badPath), bad.Description);
+        std::filesystem::remove(badPath);
+    }
+
+    std::string truncated = CreateGLB(QuadJSON(position, index, views), QuadBinary());
+    truncated.resize(10);
+    std::filesystem::path truncatedPath = WriteFile("MeshLoaderTestTruncated.glb", truncated);
+    Test::Check(LoadThrows(truncatedPath), "Truncated GLB header is rejected");
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(truncatedPath);
+}
+
+int main()
+{
+    TestOBJ();
+    TestGLB();
+
+    return Test::Finish("MeshLoaderTest");
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "WackyEngine/Graphics/MeshOptimiser.h"
+
+#include "Test.h"
+
+using namespace WackyEngine;
+
+using Triangle = std::array<std::uint32_t, 3>;
+
+// Rotated so the lowest index comes first, the passes may start a triangle on any corner but keep its winding.
+static std::vector<Triangle> SortedTriangles(const std::vector<std::uint32_t>& indices)
+{
+    std::vector<Triangle> triangles;
+
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        Triangle triangle = { indices[i], indices[i + 1], indices[i + 2] };
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        triangles.push_back(triangle);
+    }
+
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+// A size by size grid of quads, two triangles each, in a shuffled order so the cache starts out useless.
+static void CreateShuffledGrid(std::uint32_t size, std::vector<Vertex>& vertices, std::vector<std::uint32_t>& indices)
+{
+    for (std::uint32_t y = 0; y <= size; ++y)
+    {
+        for (std::uint32_t x = 0; x <= size; ++x)
+        {
+            vertices.emplace_back(Vector3(static_cast<float>(x), static_cast<float>(y), 0.0f), Vector3::One, Vector2::Zero);
+        }
+    }
+
+    std::vector<Triangle> triangles;
+
+    for (std::uint32_t y = 0; y < size; ++y)
+    {
+        for (std::uint32_t x = 0; x < size; ++x)
+        {
+            std::uint32_t corner = y * (size + 1) + x;
+            triangles.push_back({ corner, corner + 1, corner + size + 1 });
+            triangles.push_back({ corner + 1, corner + size + 2, corner + size + 1 });
+        }
+    }
+
+    std::mt19937 random(11);
+    std::shuffle(triangles.begin(), triangles.end(), random);
+
+    for (const Triangle& triangle : triangles)
+    {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+}
+
+// An axis aligned cube of 12 outward facing triangles with its own 8 vertices.
+static void AddCube(float halfSize, std::vector<Vertex>& vertices, std::vector<std::uint32_t>& indices)
+{
+    std::uint32_t base = static_cast<std::uint32_t>(vertices.size());
+
+    for (std::uint32_t i = 0; i < 8; ++i)
+    {
+        Vector3 position(i & 1 ? halfSize : -halfSize, i & 2 ? halfSize : -halfSize, i & 4 ? halfSize : -halfSize);
+        vertices.emplace_back(position, Vector3::One, Vector2::Zero);
+    }
+
+    const std::uint32_t faces[36] =
+    {
+        0, 2, 3, 0, 3, 1,   4, 5, 7, 4, 7, 6,
+        0, 1, 5, 0, 5, 4,   2, 6, 7, 2, 7, 3,
+        0, 4, 6, 0, 6, 2,   1, 3, 7, 1, 7, 5
+    };
+
+    for (std::uint32_t index : faces)
+    {
+        indices.push_back(base + index);
+    }
+}
+
+static void TestVertexCache()
+{
+    std::vector<Vertex> vertices;
+    std::vector<std::uint32_t> indices;
+    CreateShuffledGrid(100, vertices, indices);
+
+    std::vector<Triangle> before = SortedTriangles(indices);
+    float shuffledACMR = MeshOptimiser::GetACMR(indices, vertices.size());
+
+    MeshOptimiser::OptimiseVertexCache(indices, vertices.size());
+    float optimisedACMR = MeshOptimiser::GetACMR(indices, vertices.size());
+
+    Test::Check(SortedTriangles(indices) == before, "Vertex cache optimisation keeps every triangle and its winding");
+    Test::Check(shuffledACMR > 2.5f, "Shuffled grid starts close to the worst case ACMR");
+    Test::Check(optimisedACMR < 0.8f, "Vertex cache optimisation brings the grid close to the ideal ACMR");
+
+    // Overdraw ordering moves whole clusters, so cache efficiency should stay close to what it was.
+    MeshOptimiser::OptimiseOverdraw(indices, vertices);
+    float overdrawACMR = MeshOptimiser::GetACMR(indices, vertices.size());
+
+    Test::Check(SortedTriangles(indices) == before, "Overdraw ordering keeps every triangle and its winding");
+    Test::Check(overdrawACMR < optimisedACMR * 1.2f, "Overdraw ordering costs little vertex cache efficiency");
+}
+
+static void TestOverdraw()
+{
+    // A small cube inside a large one, inner first. The large cube's faces are further out along their normals so
+    // they should draw first and occlude the small cube.
+    std::vector<Vertex> vertices;
+    std::vector<std::uint32_t> indices;
+    AddCube(1.0f, vertices, indices);
+    AddCube(10.0f, vertices, indices);
+
+    std::vector<Triangle> before = SortedTriangles(indices);
+
+    MeshOptimiser::OptimiseOverdraw(indices, vertices);
+
+    Test::Check(SortedTriangles(indices) == before, "Overdraw ordering keeps every triangle of the nested cubes");
+
+    bool outerFirst = true;
+
+    for (std::size_t i = 0; i < 36; ++i)
+    {
+        outerFirst = outerFirst && indices[i] >= 8;
+    }
+
+    Test::Check(outerFirst, "Outer cube's triangles draw before the inner cube's");
+
+    // Degenerate input is left alone.
+    std::vector<std::uint32_t> single = { 0, 1, 2 };
+    MeshOptimiser::OptimiseOverdraw(single, vertices);
+    Test::Check(single == std::vector<std::uint32_t>({ 0, 1, 2 }), "A single triangle is left as is");
+}
+
+static void TestVertexFetch()
+{
+    std::vector<Vertex> vertices;
+
+    for (std::uint32_t i = 0; i < 6; ++i)
+    {
+        vertices.emplace_back(Vector3(static_cast<float>(i), 0.0f, 0.0f), Vector3::One, Vector2::Zero);
+    }
+
+    // Vertex 1 is never used.
+    std::vector<std::uint32_t> indices = { 5, 3, 0, 0, 3, 4, 2, 4, 3 };
+
+    MeshOptimiser::OptimiseVertexFetch(vertices, indices);
+
+    Test::Check(vertices.size() == 5, "Vertex fetch optimisation drops unreferenced vertices");
+    Test::Check(indices == std::vector<std::uint32_t>({ 0, 1, 2, 2, 1, 3, 4, 3, 1 }), "Vertices are renumbered in first use order");
+
+    const float expected[5] = { 5.0f, 3.0f, 0.0f, 4.0f, 2.0f };
+    bool moved = vertices.size() == 5;
+
+    for (std::size_t i = 0; moved && i < 5; ++i)
+    {
+        moved = vertices[i].Position.X == expected[i];
+    }
+
+    Test::Check(moved, "Vertex data moves with its new index");
+}
+
+int main()
+{
+    TestVertexCache();
+    TestOverdraw();
+    TestVertexFetch();
+
+    return Test::Finish("MeshOptimiserTest");
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Graphics/RenderSystem.h"
+#include "WackyEngine/Graphics/Renderers/MeshRenderer.h"
+
+#include "Headless.h"
+#include "Test.h"
+
+using namespace WackyEngine;
+
+static constexpr std::uint32_t WIDTH = 64;
+static constexpr std::uint32_t HEIGHT = 64;
+
+// A small triangle, its bounding sphere stays well inside clip space when centred there.
+static std::uint32_t AddTriangle(MeshRenderer& renderer)
+{
+    std::vector<Vertex> vertices =
+    {
+        Vertex(Vector3(-0.05f, -0.05f, 0.0f), Vector3(1.0f, 1.0f, 1.0f), Vector2(0.0f, 0.0f)),
+        Vertex(Vector3(0.05f, -0.05f, 0.0f), Vector3(1.0f, 1.0f, 1.0f), Vector2(1.0f, 0.0f)),
+        Vertex(Vector3(0.0f, 0.05f, 0.0f), Vector3(1.0f, 1.0f, 1.0f), Vector2(0.5f, 1.0f))
+    };
+
+    return renderer.AddMesh(vertices, { 0, 1, 2 });
+}
+
+// Matrix4::CreateLookAt is still a stub returning the identity. Right handed, the camera looks down its -Z.
+static Matrix4 LookAt(const Vector3& eye, const Vector3& target, const Vector3& up)
+{
+    Vector3 forward = target - eye;
+    forward.Normalise();
+
+    Vector3 right = forward.Cross(up);
+    right.Normalise();
+
+    Vector3 trueUp = right.Cross(forward);
+
+    return Matrix4(right.X,    right.Y,    right.Z,    -right.Dot(eye),
+                   trueUp.X,   trueUp.Y,   trueUp.Z,   -trueUp.Dot(eye),
+                   -forward.X, -forward.Y, -forward.Z, forward.Dot(eye),
+                   0.0f,       0.0f,       0.0f,       1.0f);
+}
+
+// Vulkan's 0 to 1 depth range for the right handed view above.
+static Matrix4 Perspective(float fovRadians, float aspectRatio, float near, float far)
+{
+    float scale = 1.0f / std::tan(fovRadians * 0.5f);
+
+    return Matrix4(scale / aspectRatio, 0.0f,  0.0f,                0.0f,
+                   0.0f,                scale, 0.0f,                0.0f,
+                   0.0f,                0.0f,  far / (near - far),  far * near / (near - far),
+                   0.0f,                0.0f,  -1.0f,               0.0f);
+}
+
+int main()
+{
+    if (!Test::InitialiseHeadless("MeshRendererCullTest", WIDTH, HEIGHT))
+    {
+        return Test::SKIPPED;
+    }
+
+    RenderSystem* renderSystem = new RenderSystem();
+    MeshRenderer* renderer = new MeshRenderer(renderSystem->GetSwapRenderPass());
+
+    std::uint32_t first = AddTriangle(*renderer);
+    std::uint32_t hidden = AddTriangle(*renderer);
+    std::uint32_t last = AddTriangle(*renderer);
+    renderer->Build();
+
+    // Culls one frame and returns the surviving commands sorted by their instance run.
+    auto cullFrame = [&](const Matrix4& viewProjection, const std::vector<Matrix4>& firstInstances, const std::vector<Matrix4>& hiddenInstances,
+                         const std::vector<Matrix4>& lastInstances, std::vector<VkDrawIndexedIndirectCommand>& commands)
+    {
+        VkCommandBuffer cmdBuffer = renderSystem->BeginFrame();
+
+        FrameData data;
+        data.CmdBuffer = cmdBuffer;
+        data.FrameIndex = renderSystem->GetCurrentFrame();
+        data.ImageIndex = renderSystem->GetCurrentIndex();
+        data.InterpolationAlpha = 1.0f;
+        data.Arena = renderSystem->GetFrameArena();
+
+        renderer->Begin();
+        renderer->SetViewProjection(viewProjection);
+        renderer->DrawInstances(first, firstInstances);
+        renderer->DrawInstances(hidden, hiddenInstances);
+        renderer->DrawInstances(last, lastInstances);
+        renderer->Cull(data);
+
+        renderSystem->BeginRenderPass(cmdBuffer);
+        renderer->End(data);
+        renderSystem->EndRenderPass(cmdBuffer);
+        renderSystem->EndFrame();
+
+        std::uint32_t drawCount = renderer->ReadCullResults(data.FrameIndex, commands);
+
+        // Compaction order depends on which invocation claims a slot first.
+        std::sort(commands.begin(), commands.end(), [](const VkDrawIndexedIndirectCommand& a, const VkDrawIndexedIndirectCommand& b)
+        {
+            return a.firstInstance < b.firstInstance;
+        });
+
+        return drawCount;
+    };
+
+    std::vector<VkDrawIndexedIndirectCommand> commands;
+
+    // With an identity view projection the frustum is clip space itself, x and y in -1 to 1 and z in 0 to 1.
+    {
+        std::vector<Matrix4> firstInstances =
+        {
+            Matrix4::CreateTranslation(0.0f, 0.0f, 0.5f),
+            Matrix4::CreateTranslation(5.0f, 0.0f, 0.5f),
+            Matrix4::CreateTranslation(0.5f, 0.5f, 0.5f),
+            Matrix4::CreateTranslation(0.0f, 0.0f, -3.0f)
+        };
+
+        std::vector<Matrix4> hiddenInstances =
+        {
+            Matrix4::CreateTranslation(-5.0f, 0.0f, 0.5f),
+            Matrix4::CreateTranslation(0.0f, 0.0f, 4.0f),
+            Matrix4::CreateTranslation(0.0f, -2.0f, 0.5f)
+        };
+
+        std::vector<Matrix4> lastInstances =
+        {
+            Matrix4::CreateTranslation(0.0f, 10.0f, 0.5f),
+            Matrix4::CreateTranslation(-0.5f, -0.5f, 0.25f)
+        };
+
+        std::uint32_t drawCount = cullFrame(Matrix4::Identity, firstInstances, hiddenInstances, lastInstances, commands);
+
+        Test::Check(drawCount == 2, "Only the meshes with visible instances keep a command");
+
+        if (commands.size() == 2)
+        {
+            // Instances are laid out mesh by mesh, so the last mesh's run starts after the first and hidden meshes'.
+            Test::Check(commands[0].instanceCount == 2 && commands[0].firstInstance == 0, "First mesh keeps its two visible instances");
+            Test::Check(commands[0].indexCount == 3 && commands[0].firstIndex == 0 && commands[0].vertexOffset == 0, "First mesh's command points at its geometry");
+
+            std::uint32_t lastFirstInstance = static_cast<std::uint32_t>(firstInstances.size() + hiddenInstances.size());
+
+            Test::Check(commands[1].instanceCount == 1 && commands[1].firstInstance == lastFirstInstance, "Last mesh keeps its one visible instance");
+            Test::Check(commands[1].indexCount == 3 && commands[1].firstIndex == 6 && commands[1].vertexOffset == 6, "Last mesh's command points at its geometry");
+        }
+    }
+
+    // A camera at z 10 looking at the origin with a 60 degree field of view sees about 5.8 units either side of
+    // it, and from z 9.9 to z -90 along its axis.
+    {
+        Matrix4 viewProjection = Perspective(60.0f * 3.1415926f / 180.0f, 1.0f, 0.1f, 100.0f) *
+                                 LookAt(Vector3(0.0f, 0.0f, 10.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+
+        std::vector<Matrix4> firstInstances =
+        {
+            Matrix4::CreateTranslation(0.0f, 0.0f, 0.0f),
+            Matrix4::CreateTranslation(0.0f, 0.0f, 20.0f),
+            Matrix4::CreateTranslation(3.0f, -3.0f, 0.0f)
+        };
+
+        std::vector<Matrix4> hiddenInstances =
+        {
+            Matrix4::CreateTranslation(-20.0f, 0.0f, 0.0f),
+            Matrix4::CreateTranslation(0.0f, 30.0f, 0.0f),
+            Matrix4::CreateTranslation(0.0f, 0.0f, -200.0f)
+        };
+
+        std::vector<Matrix4> lastInstances =
+        {
+            Matrix4::CreateTranslation(0.0f, 0.0f, -50.0f),
+            Matrix4::CreateTranslation(40.0f, 0.0f, -50.0f)
+        };
+
+        std::uint32_t drawCount = cullFrame(viewProjection, firstInstances, hiddenInstances, lastInstances, commands);
+
+        Test::Check(drawCount == 2, "Perspective: only the meshes with visible instances keep a command");
+
+        if (commands.size() == 2)
+        {
+            std::uint32_t lastFirstInstance = static_cast<std::uint32_t>(firstInstances.size() + hiddenInstances.size());
+
+            Test::Check(commands[0].instanceCount == 2 && commands[0].firstInstance == 0, "Perspective: instances in front of the camera stay, the one behind it is culled");
+            Test::Check(commands[1].instanceCount == 1 && commands[1].firstInstance == lastFirstInstance, "Perspective: distant instance inside the frustum stays, the one beside it is culled");
+        }
+    }
+
+    vkDeviceWaitIdle(Context::GetDevice()->GetLogicalDevice());
+
+    delete renderer;
+    delete renderSystem;
+
+    return Test::Finish("MeshRendererCullTest");
+}
\ No newline at end of file
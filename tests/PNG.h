@@ -0,0 +1,364 @@
+#ifndef WACKYENGINE_TESTS_PNG_H_
+#define WACKYENGINE_TESTS_PNG_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace WackyEngine::Test
+{
+    // Reference PNG decoder for checking ImageWriter, written from the specifications rather than shared with the
+    // encoder. 8-bit RGBA only. Inflate handles stored and fixed Huffman blocks and rejects dynamic ones, which the
+    // encoder never writes. Every CRC, the zlib header and the adler32 are checked.
+    struct DecodedPNG
+    {
+        std::uint32_t Width = 0;
+        std::uint32_t Height = 0;
+        std::vector<std::uint8_t> Pixels;
+
+        // How many rows used each filter type, so tests can tell which paths they covered.
+        std::uint32_t FilterCounts[5] = { };
+        std::uint32_t StoredBlocks = 0;
+        std::uint32_t FixedBlocks = 0;
+    };
+
+    namespace PNGDetail
+    {
+        inline std::uint32_t ReadU32(const std::uint8_t* bytes) noexcept
+        {
+            return (std::uint32_t(bytes[0]) << 24) | (std::uint32_t(bytes[1]) << 16) | (std::uint32_t(bytes[2]) << 8) | bytes[3];
+        }
+
+        // Bit at a time, deliberately not the table driven version the encoder uses.
+        inline std::uint32_t CRC(const std::uint8_t* data, std::size_t size) noexcept
+        {
+            std::uint32_t crc = 0xFFFFFFFFu;
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                crc ^= data[i];
+
+                for (int k = 0; k < 8; ++k)
+                {
+                    crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+                }
+            }
+
+            return crc ^ 0xFFFFFFFFu;
+        }
+
+        class BitReader
+        {
+        private:
+            const std::vector<std::uint8_t>& m_Data;
+            std::size_t m_Bit;
+
+        public:
+            bool Overrun = false;
+
+            BitReader(const std::vector<std::uint8_t>& data, std::size_t byteOffset) : m_Data(data), m_Bit(byteOffset * 8) { }
+
+            std::uint32_t Read(std::uint32_t count)
+            {
+                std::uint32_t value = 0;
+
+                for (std::uint32_t i = 0; i < count; ++i, ++m_Bit)
+                {
+                    if (m_Bit / 8 >= m_Data.size())
+                    {
+                        Overrun = true;
+                        return 0;
+                    }
+
+                    value |= ((m_Data[m_Bit / 8] >> (m_Bit % 8)) & 1u) << i;
+                }
+
+                return value;
+            }
+
+            // Huffman codes arrive most significant bit first.
+            std::uint32_t ReadCode(std::uint32_t count)
+            {
+                std::uint32_t value = 0;
+
+                for (std::uint32_t i = 0; i < count; ++i)
+                {
+                    value = (value << 1) | Read(1);
+                }
+
+                return value;
+            }
+
+            void AlignToByte() noexcept { m_Bit = (m_Bit + 7) & ~std::size_t(7); }
+            std::size_t GetByte() const noexcept { return m_Bit / 8; }
+            void SkipBytes(std::size_t count) noexcept { m_Bit += count * 8; }
+        };
+
+        // Fixed literal/length alphabet: 7 bit codes 0-23, 8 bit codes 48-191 and 192-199, 9 bit codes 400-511.
+        inline int ReadFixedSymbol(BitReader& reader)
+        {
+            std::uint32_t code = reader.ReadCode(7);
+
+            if (code <= 23)
+            {
+                return static_cast<int>(256 + code);
+            }
+
+            code = (code << 1) | reader.ReadCode(1);
+
+            if (code >= 48 && code <= 191)
+            {
+                return static_cast<int>(code - 48);
+            }
+
+            if (code >= 192 && code <= 199)
+            {
+                return static_cast<int>(280 + code - 192);
+            }
+
+            code = (code << 1) | reader.ReadCode(1);
+            return code >= 400 && code <= 511 ? static_cast<int>(144 + code - 400) : -1;
+        }
+
+        inline bool Inflate(const std::vector<std::uint8_t>& stream, std::vector<std::uint8_t>& output, DecodedPNG& result)
+        {
+            static constexpr std::uint16_t LENGTH_BASES[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+            static constexpr std::uint16_t DISTANCE_BASES[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+
+            // CM 8, a window of at most 32K, no preset dictionary, and the header check bits.
+            if (stream.size() < 6 || (stream[0] & 0x0F) != 8 || (stream[0] >> 4) > 7 || (stream[1] & 0x20) || ((stream[0] << 8) | stream[1]) % 31 != 0)
+            {
+                return false;
+            }
+
+            BitReader reader(stream, 2);
+            bool final = false;
+
+            while (!final)
+            {
+                final = reader.Read(1) != 0;
+                std::uint32_t type = reader.Read(2);
+
+                if (type == 0)
+                {
+                    reader.AlignToByte();
+                    std::size_t at = reader.GetByte();
+
+                    if (at + 4 > stream.size())
+                    {
+                        return false;
+                    }
+
+                    std::uint32_t length = stream[at] | (stream[at + 1] << 8);
+                    std::uint32_t inverse = stream[at + 2] | (stream[at + 3] << 8);
+
+                    if ((length ^ 0xFFFFu) != inverse || at + 4 + length > stream.size())
+                    {
+                        return false;
+                    }
+
+                    output.insert(output.end(), stream.begin() + at + 4, stream.begin() + at + 4 + length);
+                    reader.SkipBytes(4 + length);
+                    ++result.StoredBlocks;
+                }
+                else if (type == 1)
+                {
+                    for (;;)
+                    {
+                        int symbol = ReadFixedSymbol(reader);
+
+                        if (symbol < 0 || symbol > 285 || reader.Overrun)
+                        {
+                            return false;
+                        }
+
+                        if (symbol < 256)
+                        {
+                            output.push_back(static_cast<std::uint8_t>(symbol));
+                            continue;
+                        }
+
+                        if (symbol == 256)
+                        {
+                            break;
+                        }
+
+                        std::uint32_t lengthCode = static_cast<std::uint32_t>(symbol - 257);
+                        std::uint32_t lengthExtra = lengthCode < 8 || lengthCode == 28 ? 0 : (lengthCode - 4) / 4;
+                        std::uint32_t length = LENGTH_BASES[lengthCode] + reader.Read(lengthExtra);
+
+                        std::uint32_t distanceCode = reader.ReadCode(5);
+
+                        if (distanceCode >= 30)
+                        {
+                            return false;
+                        }
+
+                        std::uint32_t distanceExtra = distanceCode < 4 ? 0 : (distanceCode - 2) / 2;
+                        std::uint32_t distance = DISTANCE_BASES[distanceCode] + reader.Read(distanceExtra);
+
+                        if (distance > output.size() || distance > 32768)
+                        {
+                            return false;
+                        }
+
+                        // Byte by byte, a match may overlap the bytes it is producing.
+                        for (std::uint32_t i = 0; i < length; ++i)
+                        {
+                            output.push_back(output[output.size() - distance]);
+                        }
+                    }
+
+                    ++result.FixedBlocks;
+                }
+                else
+                {
+                    return false;
+                }
+
+                if (reader.Overrun)
+                {
+                    return false;
+                }
+            }
+
+            reader.AlignToByte();
+            std::size_t at = reader.GetByte();
+
+            if (at + 4 != stream.size())
+            {
+                return false;
+            }
+
+            std::uint32_t a = 1;
+            std::uint32_t b = 0;
+
+            for (std::uint8_t byte : output)
+            {
+                a = (a + byte) % 65521;
+                b = (b + a) % 65521;
+            }
+
+            return ReadU32(&stream[at]) == ((b << 16) | a);
+        }
+
+        inline std::uint8_t Paeth(int a, int b, int c) noexcept
+        {
+            int p = a + b - c;
+            int pa = std::abs(p - a);
+            int pb = std::abs(p - b);
+            int pc = std::abs(p - c);
+
+            return static_cast<std::uint8_t>(pa <= pb && pa <= pc ? a : pb <= pc ? b : c);
+        }
+    }
+
+    inline bool DecodePNG(const std::vector<std::uint8_t>& png, DecodedPNG& result)
+    {
+        using namespace PNGDetail;
+
+        static constexpr std::uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+        if (png.size() < 8 || !std::equal(SIGNATURE, SIGNATURE + 8, png.begin()))
+        {
+            return false;
+        }
+
+        std::vector<std::uint8_t> compressed;
+        bool sawHeader = false;
+        bool sawEnd = false;
+        std::size_t at = 8;
+
+        while (at + 12 <= png.size() && !sawEnd)
+        {
+            std::uint32_t length = ReadU32(&png[at]);
+
+            if (length > png.size() - at - 12)
+            {
+                return false;
+            }
+
+            const std::uint8_t* type = &png[at + 4];
+            const std::uint8_t* data = &png[at + 8];
+
+            if (CRC(type, length + 4) != ReadU32(data + length))
+            {
+                return false;
+            }
+
+            if (std::equal(type, type + 4, "IHDR"))
+            {
+                // 8-bit RGBA, deflate, adaptive filtering, not interlaced.
+                if (length != 13 || data[8] != 8 || data[9] != 6 || data[10] != 0 || data[11] != 0 || data[12] != 0)
+                {
+                    return false;
+                }
+
+                result.Width = ReadU32(data);
+                result.Height = ReadU32(data + 4);
+                sawHeader = true;
+            }
+            else if (std::equal(type, type + 4, "IDAT"))
+            {
+                compressed.insert(compressed.end(), data, data + length);
+            }
+            else if (std::equal(type, type + 4, "IEND"))
+            {
+                sawEnd = true;
+            }
+
+            at += 12 + length;
+        }
+
+        if (!sawHeader || !sawEnd || at != png.size())
+        {
+            return false;
+        }
+
+        std::vector<std::uint8_t> filtered;
+
+        if (!Inflate(compressed, filtered, result))
+        {
+            return false;
+        }
+
+        std::size_t stride = static_cast<std::size_t>(result.Width) * 4;
+
+        if (filtered.size() != (stride + 1) * result.Height)
+        {
+            return false;
+        }
+
+        result.Pixels.assign(stride * result.Height, 0);
+
+        for (std::uint32_t y = 0; y < result.Height; ++y)
+        {
+            std::uint8_t filter = filtered[y * (stride + 1)];
+            const std::uint8_t* source = &filtered[y * (stride + 1) + 1];
+            std::uint8_t* row = &result.Pixels[y * stride];
+            const std::uint8_t* above = y > 0 ? row - stride : nullptr;
+
+            if (filter > 4)
+            {
+                return false;
+            }
+
+            ++result.FilterCounts[filter];
+
+            for (std::size_t x = 0; x < stride; ++x)
+            {
+                int left = x >= 4 ? row[x - 4] : 0;
+                int up = above ? above[x] : 0;
+                int upLeft = above && x >= 4 ? above[x - 4] : 0;
+                int predicted = filter == 0 ? 0 : filter == 1 ? left : filter == 2 ? up : filter == 3 ? (left + up) / 2 : Paeth(left, up, upLeft);
+
+                row[x] = static_cast<std::uint8_t>(source[x] + predicted);
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif
\ No newline at end of file
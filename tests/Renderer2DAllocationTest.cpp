@@ -0,0 +1,152 @@
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <vector>
+
+#include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Graphics/ImageWriter.h"
+#include "WackyEngine/Graphics/RenderSystem.h"
+#include "WackyEngine/Graphics/Texture.h"
+#include "WackyEngine/Graphics/Renderers/Renderer2D.h"
+
+#include "Headless.h"
+#include "Test.h"
+
+using namespace WackyEngine;
+
+// Every global operator new is replaced so allocations can be counted while a frame is recorded.
+static std::atomic<bool> g_Counting = false;
+static std::atomic<std::uint64_t> g_Allocations = 0;
+
+static void* Allocate(std::size_t size, std::size_t alignment)
+{
+    if (g_Counting.load(std::memory_order_relaxed))
+    {
+        g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    size = size ? (size + alignment - 1) & ~(alignment - 1) : alignment;
+
+#ifdef _WIN32
+    void* memory = _aligned_malloc(size, alignment);
+#else
+    void* memory = alignment <= alignof(std::max_align_t) ? std::malloc(size) : std::aligned_alloc(alignment, size);
+#endif
+
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+static void Free(void* memory) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+void* operator new(std::size_t size) { return Allocate(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return Allocate(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return Allocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return Allocate(size, static_cast<std::size_t>(alignment)); }
+void operator delete(void* memory) noexcept { Free(memory); }
+void operator delete[](void* memory) noexcept { Free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { Free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { Free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { Free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { Free(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { Free(memory); }
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept { Free(memory); }
+
+static constexpr std::uint32_t WIDTH = 256;
+static constexpr std::uint32_t HEIGHT = 256;
+
+int main()
+{
+    if (!Test::InitialiseHeadless("Renderer2DAllocationTest", WIDTH, HEIGHT))
+    {
+        return Test::SKIPPED;
+    }
+
+    RenderSystem* renderSystem = new RenderSystem();
+    Renderer2D* renderer = new Renderer2D(renderSystem->GetSwapRenderPass());
+    renderer->SetResolution(WIDTH, HEIGHT);
+
+    std::array<std::uint8_t, 4 * 4 * 4> pixels;
+    pixels.fill(255);
+
+    std::filesystem::path texturePath = std::filesystem::temp_directory_path() / "Renderer2DAllocationTest.png";
+    ImageWriter::WritePNG(texturePath.string(), 4, 4, pixels.data());
+    Texture* texture = new Texture(texturePath.string());
+
+    // A mix of everything Begin/End handles: opaque and translucent quads on several layers, some off screen.
+    std::array<Rectangle, 256> rects;
+
+    for (std::size_t i = 0; i < rects.size(); ++i)
+    {
+        rects[i] = Rectangle(static_cast<int>(i % 32) * 10 - 16, static_cast<int>(i / 32) * 40, 12, 12);
+    }
+
+    auto recordFrame = [&](bool count)
+    {
+        VkCommandBuffer cmdBuffer = renderSystem->BeginFrame();
+
+        FrameData data;
+        data.CmdBuffer = cmdBuffer;
+        data.FrameIndex = renderSystem->GetCurrentFrame();
+        data.ImageIndex = renderSystem->GetCurrentIndex();
+        data.InterpolationAlpha = 1.0f;
+        data.Arena = renderSystem->GetFrameArena();
+
+        renderSystem->BeginRenderPass(cmdBuffer);
+
+        g_Counting.store(count, std::memory_order_relaxed);
+
+        renderer->Begin();
+        renderer->DrawRectangles(rects, Vector3(1.0f, 0.5f, 0.25f), texture);
+
+        for (std::size_t i = 0; i < rects.size(); i += 3)
+        {
+            renderer->DrawRectangle(rects[i], Vector4(0.2f, 0.4f, 0.8f, 0.5f), texture, Renderer2D::BlendMode::Alpha, static_cast<std::int32_t>(i % 5) - 2);
+            renderer->DrawRectangle(rects[i], Vector4(1.0f, 1.0f, 1.0f, 0.25f), texture, Renderer2D::BlendMode::Additive, static_cast<std::int32_t>(i % 3));
+        }
+
+        renderer->End(data);
+
+        g_Counting.store(false, std::memory_order_relaxed);
+
+        renderSystem->EndRenderPass(cmdBuffer);
+        renderSystem->EndFrame();
+    };
+
+    // Containers reach their steady state size over the first frames, and each frame arena gets used once.
+    for (std::uint32_t i = 0; i < Context::GetGraphicsInformation().FramesInFlight * 2; ++i)
+    {
+        recordFrame(false);
+    }
+
+    for (std::uint32_t i = 0; i < 16; ++i)
+    {
+        recordFrame(true);
+    }
+
+    Test::Check(g_Allocations.load() == 0, "Renderer2D Begin/End make no heap allocations once warmed up");
+    Test::Check(renderer->GetStatistics().DrawnQuads > 0 && renderer->GetStatistics().CulledQuads > 0, "Frames drew and culled quads");
+
+    vkDeviceWaitIdle(Context::GetDevice()->GetLogicalDevice());
+
+    delete texture;
+    delete renderer;
+    delete renderSystem;
+
+    std::filesystem::remove(texturePath);
+
+    return Test::Finish("Renderer2DAllocationTest");
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "WackyEngine/Core/Context.h"
+#include "WackyEngine/Graphics/ImageWriter.h"
+#include "WackyEngine/Graphics/OffscreenTarget.h"
+#include "WackyEngine/Graphics/RenderSystem.h"
+#include "WackyEngine/Graphics/Texture.h"
+#include "WackyEngine/Graphics/Renderers/Renderer2D.h"
+
+#include "Headless.h"
+#include "Test.h"
+
+using namespace WackyEngine;
+
+static constexpr std::uint32_t WIDTH = 64;
+static constexpr std::uint32_t HEIGHT = 64;
+
+int main()
+{
+    // Without a depth buffer draw order alone has to put higher layers on top, across blend modes too.
+    if (!Test::InitialiseHeadless("Renderer2DOrderTest", WIDTH, HEIGHT, false))
+    {
+        return Test::SKIPPED;
+    }
+
+    RenderSystem* renderSystem = new RenderSystem();
+    renderSystem->SetClearColour(Vector3(0.0f, 0.0f, 0.0f));
+
+    Renderer2D* renderer = new Renderer2D(renderSystem->GetSwapRenderPass());
+    renderer->SetResolution(WIDTH, HEIGHT);
+
+    std::array<std::uint8_t, 4 * 4 * 4> white;
+    white.fill(255);
+
+    std::filesystem::path texturePath = std::filesystem::temp_directory_path() / "Renderer2DOrderTest.png";
+    ImageWriter::WritePNG(texturePath.string(), 4, 4, white.data());
+    Texture* texture = new Texture(texturePath.string());
+
+    // Both quads are centred, so the centre pixel is inside their overlap whichever way Y points.
+    Rectangle outer(8, 8, 48, 48);
+    Rectangle inner(16, 16, 32, 32);
+
+    std::vector<std::uint8_t> pixels;
+
+    auto renderFrame = [&](std::int32_t opaqueLayer, std::int32_t translucentLayer, bool translucentFirst)
+    {
+        VkCommandBuffer cmdBuffer = renderSystem->BeginFrame();
+
+        FrameData data;
+        data.CmdBuffer = cmdBuffer;
+        data.FrameIndex = renderSystem->GetCurrentFrame();
+        data.ImageIndex = renderSystem->GetCurrentIndex();
+        data.InterpolationAlpha = 1.0f;
+        data.Arena = renderSystem->GetFrameArena();
+
+        renderSystem->BeginRenderPass(cmdBuffer);
+
+        renderer->Begin();
+
+        if (translucentFirst)
+        {
+            renderer->DrawRectangle(inner, Vector4(0.0f, 0.0f, 1.0f, 0.5f), texture, Renderer2D::BlendMode::Alpha, translucentLayer);
+            renderer->DrawRectangle(outer, Vector4(1.0f, 0.0f, 0.0f, 1.0f), texture, Renderer2D::BlendMode::Opaque, opaqueLayer);
+        }
+        else
+        {
+            renderer->DrawRectangle(outer, Vector4(1.0f, 0.0f, 0.0f, 1.0f), texture, Renderer2D::BlendMode::Opaque, opaqueLayer);
+            renderer->DrawRectangle(inner, Vector4(0.0f, 0.0f, 1.0f, 0.5f), texture, Renderer2D::BlendMode::Alpha, translucentLayer);
+        }
+
+        renderer->End(data);
+
+        renderSystem->EndRenderPass(cmdBuffer);
+        renderSystem->EndFrame();
+
+        renderSystem->GetOffscreenTarget()->Readback(pixels);
+    };
+
+    auto centre = [&]() -> const std::uint8_t*
+    {
+        return &pixels[((HEIGHT / 2) * WIDTH + WIDTH / 2) * 4];
+    };
+
+    // Opaque on the higher layer covers the translucent quad, even though it would be drawn first by blend mode.
+    renderFrame(5, 0, false);
+    Test::Check(centre()[0] == 255 && centre()[1] == 0 && centre()[2] == 0, "Opaque quad on a higher layer draws over a translucent one");
+    Test::Check(renderer->GetStatistics().DrawCalls == 2, "Blend mode change splits the quads into two draws");
+
+    renderFrame(5, 0, true);
+    Test::Check(centre()[0] == 255 && centre()[1] == 0 && centre()[2] == 0, "Layer order wins over submission order");
+
+    // Translucent on the higher layer blends over the opaque one.
+    renderFrame(0, 5, false);
+    Test::Check(centre()[0] > 0 && centre()[0] < 255 && centre()[2] > 0, "Translucent quad on a higher layer blends over an opaque one");
+
+    // Same layer keeps submission order.
+    renderFrame(0, 0, true);
+    Test::Check(centre()[0] == 255 && centre()[2] == 0, "Equal layers keep submission order across blend modes");
+
+    const std::uint8_t* corner = &pixels[0];
+    Test::Check(corner[0] == 0 && corner[1] == 0 && corner[2] == 0, "Pixels outside the quads keep the clear colour");
+
+    vkDeviceWaitIdle(Context::GetDevice()->GetLogicalDevice());
+
+    delete texture;
+    delete renderer;
+    delete renderSystem;
+
+    std::filesystem::remove(texturePath);
+
+    return Test::Finish("Renderer2DOrderTest");
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#ifndef WACKYENGINE_TESTS_TEST_H_
+#define WACKYENGINE_TESTS_TEST_H_
+
+#include <cstdio>
+
+// Minimal checks for the test executables, each one is a plain main registered with CTest.
+namespace WackyEngine::Test
+{
+    // CTest reports a test returning this as skipped, for GPU tests on machines without a Vulkan device.
+    static constexpr int SKIPPED = 77;
+
+    inline int g_Failures = 0;
+
+    inline void Check(bool condition, const char* description)
+    {
+        if (!condition)
+        {
+            std::fprintf(stderr, "FAILED: %s\n", description);
+            ++g_Failures;
+        }
+    }
+
+    inline int Finish(const char* name)
+    {
+        if (g_Failures == 0)
+        {
+            std::printf("%s passed\n", name);
+            return 0;
+        }
+
+        std::fprintf(stderr, "%s: %d check(s) failed\n", name, g_Failures);
+        return 1;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "WackyEngine/Core/JobSystem.h"
+#include "WackyEngine/Graphics/CookedMesh.h"
+#include "WackyEngine/Graphics/MeshLoader.h"
+
+using namespace WackyEngine;
+
+// MeshCooker <input.obj|input.glb> <output.wmesh>
+// Files holding more than one mesh are cooked to <output>_<index>.wmesh, one file per mesh.
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: MeshCooker <input.obj|input.glb> <output.wmesh>" << std::endl;
+        return 1;
+    }
+
+    std::string input = argv[1];
+    std::string output = argv[2];
+
+    try
+    {
+        std::uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        JobSystem jobSystem(hardwareThreads > 1 ? hardwareThreads - 1 : 0);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::vector<MeshData> meshes = MeshLoader::LoadData(input, &jobSystem);
+        double loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (meshes.empty())
+        {
+            std::cerr << "No triangle meshes in " << input << std::endl;
+            return 1;
+        }
+
+        std::cout << "Loaded " << meshes.size() << " mesh(es) from " << input << " in " << loadSeconds * 1000.0 << " ms" << std::endl;
+
+        std::string stem = output;
+        std::string extension = ".wmesh";
+        std::size_t dot = output.find_last_of('.');
+
+        if (dot != std::string::npos && output.find_first_of("/\\", dot) == std::string::npos)
+        {
+            stem = output.substr(0, dot);
+            extension = output.substr(dot);
+        }
+
+        for (std::size_t i = 0; i < meshes.size(); ++i)
+        {
+            std::string path = meshes.size() == 1 ? output : stem + "_" + std::to_string(i) + extension;
+            CookedMesh::Write(path, meshes[i]);
+
+            std::cout << "\t" << (meshes[i].Name.empty() ? "(unnamed)" : meshes[i].Name) << " -> " << path << ": "
+                      << meshes[i].Vertices.size() << " vertices, " << meshes[i].Indices.size() / 3 << " triangles" << std::endl;
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file